@@ -0,0 +1,167 @@
+#pragma once
+
+// Libmorton - Hilbert codes
+// This file contains inline functions which encode/decode Hilbert codes with the fastest Morton method (see morton.h),
+// followed by a state machine LUT conversion (see hilbert2D.h / hilbert3D.h), and which convert existing Morton codes.
+// Hilbert codes cover the same coordinates as the Morton codes of the same width: 16/32 bits per coordinate in 2D,
+// 10/21 bits per coordinate in 3D.
+
+#include <stddef.h>
+#include <stdint.h>
+#include "morton.h"
+#include "hilbert2D.h"
+#include "hilbert3D.h"
+
+namespace libmorton {
+
+	namespace hilbert_detail {
+		static const size_t block_size = 1024; // codes per batch block: the Morton pass and the conversion share the L1 cache
+	}
+
+	// CONVERT Morton codes to Hilbert codes and back
+	inline uint_fast32_t morton2D_32_to_hilbert(const uint_fast32_t m) {
+		return m2D_to_hilbert<uint_fast32_t, 16>(m);
+	}
+	inline uint_fast64_t morton2D_64_to_hilbert(const uint_fast64_t m) {
+		return m2D_to_hilbert<uint_fast64_t, 32>(m);
+	}
+	inline uint_fast32_t morton3D_32_to_hilbert(const uint_fast32_t m) {
+		return m3D_to_hilbert<uint_fast32_t, 10>(m);
+	}
+	inline uint_fast64_t morton3D_64_to_hilbert(const uint_fast64_t m) {
+		return m3D_to_hilbert<uint_fast64_t, 21>(m);
+	}
+	inline uint_fast32_t hilbert2D_32_to_morton(const uint_fast32_t h) {
+		return m2D_from_hilbert<uint_fast32_t, 16>(h);
+	}
+	inline uint_fast64_t hilbert2D_64_to_morton(const uint_fast64_t h) {
+		return m2D_from_hilbert<uint_fast64_t, 32>(h);
+	}
+	inline uint_fast32_t hilbert3D_32_to_morton(const uint_fast32_t h) {
+		return m3D_from_hilbert<uint_fast32_t, 10>(h);
+	}
+	inline uint_fast64_t hilbert3D_64_to_morton(const uint_fast64_t h) {
+		return m3D_from_hilbert<uint_fast64_t, 21>(h);
+	}
+
+	// ENCODING
+	inline uint_fast32_t hilbert2D_32_encode(const uint_fast16_t x, const uint_fast16_t y) {
+		return morton2D_32_to_hilbert(morton2D_32_encode(x, y));
+	}
+	inline uint_fast64_t hilbert2D_64_encode(const uint_fast32_t x, const uint_fast32_t y) {
+		return morton2D_64_to_hilbert(morton2D_64_encode(x, y));
+	}
+	inline uint_fast32_t hilbert3D_32_encode(const uint_fast16_t x, const uint_fast16_t y, const uint_fast16_t z) {
+		return morton3D_32_to_hilbert(morton3D_32_encode(x, y, z));
+	}
+	inline uint_fast64_t hilbert3D_64_encode(const uint_fast32_t x, const uint_fast32_t y, const uint_fast32_t z) {
+		return morton3D_64_to_hilbert(morton3D_64_encode(x, y, z));
+	}
+
+	// DECODING
+	inline void hilbert2D_32_decode(const uint_fast32_t h, uint_fast16_t& x, uint_fast16_t& y) {
+		morton2D_32_decode(hilbert2D_32_to_morton(h), x, y);
+	}
+	inline void hilbert2D_64_decode(const uint_fast64_t h, uint_fast32_t& x, uint_fast32_t& y) {
+		morton2D_64_decode(hilbert2D_64_to_morton(h), x, y);
+	}
+	inline void hilbert3D_32_decode(const uint_fast32_t h, uint_fast16_t& x, uint_fast16_t& y, uint_fast16_t& z) {
+		morton3D_32_decode(hilbert3D_32_to_morton(h), x, y, z);
+	}
+	inline void hilbert3D_64_decode(const uint_fast64_t h, uint_fast32_t& x, uint_fast32_t& y, uint_fast32_t& z) {
+		morton3D_64_decode(hilbert3D_64_to_morton(h), x, y, z);
+	}
+
+	// BATCH CONVERSION
+	// Convert n codes from in to out (in and out may be the same array)
+	inline void morton2D_32_to_hilbert_batch(const uint32_t* in, uint32_t* out, size_t n) {
+		for (size_t i = 0; i < n; ++i) { out[i] = m2D_to_hilbert<uint32_t, 16>(in[i]); }
+	}
+	inline void morton2D_64_to_hilbert_batch(const uint64_t* in, uint64_t* out, size_t n) {
+		for (size_t i = 0; i < n; ++i) { out[i] = m2D_to_hilbert<uint64_t, 32>(in[i]); }
+	}
+	inline void morton3D_32_to_hilbert_batch(const uint32_t* in, uint32_t* out, size_t n) {
+		for (size_t i = 0; i < n; ++i) { out[i] = m3D_to_hilbert<uint32_t, 10>(in[i]); }
+	}
+	inline void morton3D_64_to_hilbert_batch(const uint64_t* in, uint64_t* out, size_t n) {
+		for (size_t i = 0; i < n; ++i) { out[i] = m3D_to_hilbert<uint64_t, 21>(in[i]); }
+	}
+	inline void hilbert2D_32_to_morton_batch(const uint32_t* in, uint32_t* out, size_t n) {
+		for (size_t i = 0; i < n; ++i) { out[i] = m2D_from_hilbert<uint32_t, 16>(in[i]); }
+	}
+	inline void hilbert2D_64_to_morton_batch(const uint64_t* in, uint64_t* out, size_t n) {
+		for (size_t i = 0; i < n; ++i) { out[i] = m2D_from_hilbert<uint64_t, 32>(in[i]); }
+	}
+	inline void hilbert3D_32_to_morton_batch(const uint32_t* in, uint32_t* out, size_t n) {
+		for (size_t i = 0; i < n; ++i) { out[i] = m3D_from_hilbert<uint32_t, 10>(in[i]); }
+	}
+	inline void hilbert3D_64_to_morton_batch(const uint64_t* in, uint64_t* out, size_t n) {
+		for (size_t i = 0; i < n; ++i) { out[i] = m3D_from_hilbert<uint64_t, 21>(in[i]); }
+	}
+
+	// BATCH ENCODING
+	// Encode with the Morton batch methods, then convert every block while it's still in the cache
+	inline void hilbert2D_32_encode_batch(const uint16_t* x, const uint16_t* y, uint32_t* out, size_t n) {
+		for (size_t i = 0; i < n; i += hilbert_detail::block_size) {
+			const size_t count = (n - i < hilbert_detail::block_size) ? n - i : hilbert_detail::block_size;
+			morton2D_32_encode_batch(x + i, y + i, out + i, count);
+			morton2D_32_to_hilbert_batch(out + i, out + i, count);
+		}
+	}
+	inline void hilbert2D_64_encode_batch(const uint32_t* x, const uint32_t* y, uint64_t* out, size_t n) {
+		for (size_t i = 0; i < n; i += hilbert_detail::block_size) {
+			const size_t count = (n - i < hilbert_detail::block_size) ? n - i : hilbert_detail::block_size;
+			morton2D_64_encode_batch(x + i, y + i, out + i, count);
+			morton2D_64_to_hilbert_batch(out + i, out + i, count);
+		}
+	}
+	inline void hilbert3D_32_encode_batch(const uint16_t* x, const uint16_t* y, const uint16_t* z, uint32_t* out, size_t n) {
+		for (size_t i = 0; i < n; i += hilbert_detail::block_size) {
+			const size_t count = (n - i < hilbert_detail::block_size) ? n - i : hilbert_detail::block_size;
+			morton3D_32_encode_batch(x + i, y + i, z + i, out + i, count);
+			morton3D_32_to_hilbert_batch(out + i, out + i, count);
+		}
+	}
+	inline void hilbert3D_64_encode_batch(const uint32_t* x, const uint32_t* y, const uint32_t* z, uint64_t* out, size_t n) {
+		for (size_t i = 0; i < n; i += hilbert_detail::block_size) {
+			const size_t count = (n - i < hilbert_detail::block_size) ? n - i : hilbert_detail::block_size;
+			morton3D_64_encode_batch(x + i, y + i, z + i, out + i, count);
+			morton3D_64_to_hilbert_batch(out + i, out + i, count);
+		}
+	}
+
+	// BATCH DECODING
+	// Convert every block to Morton codes in a buffer on the stack, then decode it with the Morton batch methods
+	inline void hilbert2D_32_decode_batch(const uint32_t* h, uint16_t* x, uint16_t* y, size_t n) {
+		uint32_t m[hilbert_detail::block_size];
+		for (size_t i = 0; i < n; i += hilbert_detail::block_size) {
+			const size_t count = (n - i < hilbert_detail::block_size) ? n - i : hilbert_detail::block_size;
+			hilbert2D_32_to_morton_batch(h + i, m, count);
+			morton2D_32_decode_batch(m, x + i, y + i, count);
+		}
+	}
+	inline void hilbert2D_64_decode_batch(const uint64_t* h, uint32_t* x, uint32_t* y, size_t n) {
+		uint64_t m[hilbert_detail::block_size];
+		for (size_t i = 0; i < n; i += hilbert_detail::block_size) {
+			const size_t count = (n - i < hilbert_detail::block_size) ? n - i : hilbert_detail::block_size;
+			hilbert2D_64_to_morton_batch(h + i, m, count);
+			morton2D_64_decode_batch(m, x + i, y + i, count);
+		}
+	}
+	inline void hilbert3D_32_decode_batch(const uint32_t* h, uint16_t* x, uint16_t* y, uint16_t* z, size_t n) {
+		uint32_t m[hilbert_detail::block_size];
+		for (size_t i = 0; i < n; i += hilbert_detail::block_size) {
+			const size_t count = (n - i < hilbert_detail::block_size) ? n - i : hilbert_detail::block_size;
+			hilbert3D_32_to_morton_batch(h + i, m, count);
+			morton3D_32_decode_batch(m, x + i, y + i, z + i, count);
+		}
+	}
+	inline void hilbert3D_64_decode_batch(const uint64_t* h, uint32_t* x, uint32_t* y, uint32_t* z, size_t n) {
+		uint64_t m[hilbert_detail::block_size];
+		for (size_t i = 0; i < n; i += hilbert_detail::block_size) {
+			const size_t count = (n - i < hilbert_detail::block_size) ? n - i : hilbert_detail::block_size;
+			hilbert3D_64_to_morton_batch(h + i, m, count);
+			morton3D_64_decode_batch(m, x + i, y + i, z + i, count);
+		}
+	}
+}
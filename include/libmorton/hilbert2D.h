@@ -0,0 +1,42 @@
+#pragma once
+
+// Libmorton - Methods to convert 2D Morton codes to Hilbert codes and back
+// The Hilbert curve visits the cells in an order in which consecutive cells always share an edge, at the cost of a state
+// that depends on all levels above: a Morton code is converted from its highest level down, 4 levels (8 bits) per lookup
+// in a state machine LUT (see hilbert2D_LUTs.h). The curve starts at (0, 0) and ends at (2^levels - 1, 0).
+// levels is the number of bits per coordinate (16 for 32-bit codes, 32 for 64-bit codes) and has to be a multiple of 4.
+// Warning: hilbert.h will always point to the functions that use the fastest available method.
+
+#include <stdint.h>
+#include "hilbert2D_LUTs.h"
+
+namespace libmorton {
+
+	// CONVERT 2D Morton code to Hilbert code : state machine LUT
+	template<typename morton, unsigned int levels>
+	inline morton m2D_to_hilbert(const morton m) {
+		static_assert(levels % 4 == 0 && levels * 2 <= sizeof(morton) * 8, "levels has to be a multiple of 4 that fits in the code");
+		morton h = 0;
+		unsigned int state = 0;
+		for (int shift = static_cast<int>(levels * 2) - 8; shift >= 0; shift -= 8) {
+			const uint16_t entry = Hilbert2D_from_morton_256[(state << 8) | static_cast<unsigned int>((m >> shift) & 0xFF)];
+			h |= static_cast<morton>(entry & 0xFF) << shift;
+			state = entry >> 8;
+		}
+		return h;
+	}
+
+	// CONVERT Hilbert code to 2D Morton code : state machine LUT
+	template<typename morton, unsigned int levels>
+	inline morton m2D_from_hilbert(const morton h) {
+		static_assert(levels % 4 == 0 && levels * 2 <= sizeof(morton) * 8, "levels has to be a multiple of 4 that fits in the code");
+		morton m = 0;
+		unsigned int state = 0;
+		for (int shift = static_cast<int>(levels * 2) - 8; shift >= 0; shift -= 8) {
+			const uint16_t entry = Hilbert2D_to_morton_256[(state << 8) | static_cast<unsigned int>((h >> shift) & 0xFF)];
+			m |= static_cast<morton>(entry & 0xFF) << shift;
+			state = entry >> 8;
+		}
+		return m;
+	}
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <stdint.h>
+
+// Libmorton - State machine LUTs for converting between 2D Morton and Hilbert codes (see hilbert2D.h)
+// Index: state << 8 | a block of 4 levels (8 bits) of the code, highest level first. Entry: the converted block in the low
+// 8 bits, the state for the next block above them. There are 4 states, state 0 is the start state.
+// Generated by generateHilbert_LUT in test/morton_LUT_generators.h.
+
+namespace libmorton {
+
+	// LUT for Hilbert2D Morton -> Hilbert (4 levels)
+	static const uint16_t Hilbert2D_from_morton_256[1024] = {
+	0, 257, 771, 258, 526, 15, 525, 780, 260, 519, 5, 6, 264, 523, 9, 10,
+	272, 531, 17, 18, 20, 277, 791, 278, 798, 797, 287, 540, 24, 281, 795, 282,
+	826, 825, 315, 568, 822, 821, 311, 564, 60, 317, 831, 318, 562, 51, 561, 816,
+	288, 547, 33, 34, 36, 293, 807, 294, 814, 813, 303, 556, 40, 297, 811, 298,
+	746, 235, 745, 1000, 492, 751, 237, 238, 742, 231, 741, 996, 994, 993, 483, 736,
+	240, 497, 1011, 498, 766, 255, 765, 1020, 500, 759, 245, 246, 504, 763, 249, 250,
+	730, 219, 729, 984, 476, 735, 221, 222, 726, 215, 725, 980, 978, 977, 467, 720,
+	970, 969, 459, 712, 966, 965, 455, 708, 204, 461, 975, 462, 706, 195, 705, 960,
+	320, 579, 65, 66, 68, 325, 839, 326, 846, 845, 335, 588, 72, 329, 843, 330,
+	634, 123, 633, 888, 380, 639, 125, 126, 630, 119, 629, 884, 882, 881, 371, 624,
+	80, 337, 851, 338, 606, 95, 605, 860, 340, 599, 85, 86, 344, 603, 89, 90,
+	96, 353, 867, 354, 622, 111, 621, 876, 356, 615, 101, 102, 360, 619, 105, 106,
+	384, 643, 129, 130, 132, 389, 903, 390, 910, 909, 399, 652, 136, 393, 907, 394,
+	698, 187, 697, 952, 444, 703, 189, 190, 694, 183, 693, 948, 946, 945, 435, 688,
+	144, 401, 915, 402, 670, 159, 669, 924, 404, 663, 149, 150, 408, 667, 153, 154,
+	160, 417, 931, 418, 686, 175, 685, 940, 420, 679, 165, 166, 424, 683, 169, 170,
+	256, 515, 1, 2, 4, 261, 775, 262, 782, 781, 271, 524, 8, 265, 779, 266,
+	570, 59, 569, 824, 316, 575, 61, 62, 566, 55, 565, 820, 818, 817, 307, 560,
+	16, 273, 787, 274, 542, 31, 541, 796, 276, 535, 21, 22, 280, 539, 25, 26,
+	32, 289, 803, 290, 558, 47, 557, 812, 292, 551, 37, 38, 296, 555, 41, 42,
+	64, 321, 835, 322, 590, 79, 589, 844, 324, 583, 69, 70, 328, 587, 73, 74,
+	336, 595, 81, 82, 84, 341, 855, 342, 862, 861, 351, 604, 88, 345, 859, 346,
+	890, 889, 379, 632, 886, 885, 375, 628, 124, 381, 895, 382, 626, 115, 625, 880,
+	352, 611, 97, 98, 100, 357, 871, 358, 878, 877, 367, 620, 104, 361, 875, 362,
+	1002, 1001, 491, 744, 998, 997, 487, 740, 236, 493, 1007, 494, 738, 227, 737, 992,
+	986, 985, 475, 728, 982, 981, 471, 724, 220, 477, 991, 478, 722, 211, 721, 976,
+	496, 755, 241, 242, 244, 501, 1015, 502, 1022, 1021, 511, 764, 248, 505, 1019, 506,
+	714, 203, 713, 968, 460, 719, 205, 206, 710, 199, 709, 964, 962, 961, 451, 704,
+	128, 385, 899, 386, 654, 143, 653, 908, 388, 647, 133, 134, 392, 651, 137, 138,
+	400, 659, 145, 146, 148, 405, 919, 406, 926, 925, 415, 668, 152, 409, 923, 410,
+	954, 953, 443, 696, 950, 949, 439, 692, 188, 445, 959, 446, 690, 179, 689, 944,
+	416, 675, 161, 162, 164, 421, 935, 422, 942, 941, 431, 684, 168, 425, 939, 426,
+	682, 171, 681, 936, 428, 687, 173, 174, 678, 167, 677, 932, 930, 929, 419, 672,
+	176, 433, 947, 434, 702, 191, 701, 956, 436, 695, 181, 182, 440, 699, 185, 186,
+	666, 155, 665, 920, 412, 671, 157, 158, 662, 151, 661, 916, 914, 913, 403, 656,
+	906, 905, 395, 648, 902, 901, 391, 644, 140, 397, 911, 398, 642, 131, 641, 896,
+	448, 707, 193, 194, 196, 453, 967, 454, 974, 973, 463, 716, 200, 457, 971, 458,
+	762, 251, 761, 1016, 508, 767, 253, 254, 758, 247, 757, 1012, 1010, 1009, 499, 752,
+	208, 465, 979, 466, 734, 223, 733, 988, 468, 727, 213, 214, 472, 731, 217, 218,
+	224, 481, 995, 482, 750, 239, 749, 1004, 484, 743, 229, 230, 488, 747, 233, 234,
+	618, 107, 617, 872, 364, 623, 109, 110, 614, 103, 613, 868, 866, 865, 355, 608,
+	112, 369, 883, 370, 638, 127, 637, 892, 372, 631, 117, 118, 376, 635, 121, 122,
+	602, 91, 601, 856, 348, 607, 93, 94, 598, 87, 597, 852, 850, 849, 339, 592,
+	842, 841, 331, 584, 838, 837, 327, 580, 76, 333, 847, 334, 578, 67, 577, 832,
+	810, 809, 299, 552, 806, 805, 295, 548, 44, 301, 815, 302, 546, 35, 545, 800,
+	794, 793, 283, 536, 790, 789, 279, 532, 28, 285, 799, 286, 530, 19, 529, 784,
+	304, 563, 49, 50, 52, 309, 823, 310, 830, 829, 319, 572, 56, 313, 827, 314,
+	522, 11, 521, 776, 268, 527, 13, 14, 518, 7, 517, 772, 770, 769, 259, 512,
+	938, 937, 427, 680, 934, 933, 423, 676, 172, 429, 943, 430, 674, 163, 673, 928,
+	922, 921, 411, 664, 918, 917, 407, 660, 156, 413, 927, 414, 658, 147, 657, 912,
+	432, 691, 177, 178, 180, 437, 951, 438, 958, 957, 447, 700, 184, 441, 955, 442,
+	650, 139, 649, 904, 396, 655, 141, 142, 646, 135, 645, 900, 898, 897, 387, 640,
+	874, 873, 363, 616, 870, 869, 359, 612, 108, 365, 879, 366, 610, 99, 609, 864,
+	858, 857, 347, 600, 854, 853, 343, 596, 92, 349, 863, 350, 594, 83, 593, 848,
+	368, 627, 113, 114, 116, 373, 887, 374, 894, 893, 383, 636, 120, 377, 891, 378,
+	586, 75, 585, 840, 332, 591, 77, 78, 582, 71, 581, 836, 834, 833, 323, 576,
+	192, 449, 963, 450, 718, 207, 717, 972, 452, 711, 197, 198, 456, 715, 201, 202,
+	464, 723, 209, 210, 212, 469, 983, 470, 990, 989, 479, 732, 216, 473, 987, 474,
+	1018, 1017, 507, 760, 1014, 1013, 503, 756, 252, 509, 1023, 510, 754, 243, 753, 1008,
+	480, 739, 225, 226, 228, 485, 999, 486, 1006, 1005, 495, 748, 232, 489, 1003, 490,
+	554, 43, 553, 808, 300, 559, 45, 46, 550, 39, 549, 804, 802, 801, 291, 544,
+	48, 305, 819, 306, 574, 63, 573, 828, 308, 567, 53, 54, 312, 571, 57, 58,
+	538, 27, 537, 792, 284, 543, 29, 30, 534, 23, 533, 788, 786, 785, 275, 528,
+	778, 777, 267, 520, 774, 773, 263, 516, 12, 269, 783, 270, 514, 3, 513, 768
+	};
+
+	// LUT for Hilbert2D Hilbert -> Morton (4 levels)
+	static const uint16_t Hilbert2D_to_morton_256[1024] = {
+	0, 257, 259, 770, 264, 10, 11, 521, 268, 14, 15, 525, 775, 518, 516, 5,
+	272, 18, 19, 529, 20, 277, 279, 790, 28, 285, 287, 798, 539, 793, 792, 282,
+	304, 50, 51, 561, 52, 309, 311, 822, 60, 317, 319, 830, 571, 825, 824, 314,
+	815, 558, 556, 45, 551, 805, 804, 294, 547, 801, 800, 290, 40, 297, 299, 810,
+	384, 130, 131, 641, 132, 389, 391, 902, 140, 397, 399, 910, 651, 905, 904, 394,
+	160, 417, 419, 930, 424, 170, 171, 681, 428, 174, 175, 685, 935, 678, 676, 165,
+	176, 433, 435, 946, 440, 186, 187, 697, 444, 190, 191, 701, 951, 694, 692, 181,
+	671, 925, 924, 414, 923, 666, 664, 153, 915, 658, 656, 145, 404, 150, 151, 661,
+	448, 194, 195, 705, 196, 453, 455, 966, 204, 461, 463, 974, 715, 969, 968, 458,
+	224, 481, 483, 994, 488, 234, 235, 745, 492, 238, 239, 749, 999, 742, 740, 229,
+	240, 497, 499, 1010, 504, 250, 251, 761, 508, 254, 255, 765, 1015, 758, 756, 245,
+	735, 989, 988, 478, 987, 730, 728, 217, 979, 722, 720, 209, 468, 214, 215, 725,
+	895, 638, 636, 125, 631, 885, 884, 374, 627, 881, 880, 370, 120, 377, 379, 890,
+	623, 877, 876, 366, 875, 618, 616, 105, 867, 610, 608, 97, 356, 102, 103, 613,
+	591, 845, 844, 334, 843, 586, 584, 73, 835, 578, 576, 65, 324, 70, 71, 581,
+	80, 337, 339, 850, 344, 90, 91, 601, 348, 94, 95, 605, 855, 598, 596, 85,
+	256, 2, 3, 513, 4, 261, 263, 774, 12, 269, 271, 782, 523, 777, 776, 266,
+	32, 289, 291, 802, 296, 42, 43, 553, 300, 46, 47, 557, 807, 550, 548, 37,
+	48, 305, 307, 818, 312, 58, 59, 569, 316, 62, 63, 573, 823, 566, 564, 53,
+	543, 797, 796, 286, 795, 538, 536, 25, 787, 530, 528, 17, 276, 22, 23, 533,
+	64, 321, 323, 834, 328, 74, 75, 585, 332, 78, 79, 589, 839, 582, 580, 69,
+	336, 82, 83, 593, 84, 341, 343, 854, 92, 349, 351, 862, 603, 857, 856, 346,
+	368, 114, 115, 625, 116, 373, 375, 886, 124, 381, 383, 894, 635, 889, 888, 378,
+	879, 622, 620, 109, 615, 869, 868, 358, 611, 865, 864, 354, 104, 361, 363, 874,
+	192, 449, 451, 962, 456, 202, 203, 713, 460, 206, 207, 717, 967, 710, 708, 197,
+	464, 210, 211, 721, 212, 469, 471, 982, 220, 477, 479, 990, 731, 985, 984, 474,
+	496, 242, 243, 753, 244, 501, 503, 1014, 252, 509, 511, 1022, 763, 1017, 1016, 506,
+	1007, 750, 748, 237, 743, 997, 996, 486, 739, 993, 992, 482, 232, 489, 491, 1002,
+	703, 957, 956, 446, 955, 698, 696, 185, 947, 690, 688, 177, 436, 182, 183, 693,
+	927, 670, 668, 157, 663, 917, 916, 406, 659, 913, 912, 402, 152, 409, 411, 922,
+	911, 654, 652, 141, 647, 901, 900, 390, 643, 897, 896, 386, 136, 393, 395, 906,
+	416, 162, 163, 673, 164, 421, 423, 934, 172, 429, 431, 942, 683, 937, 936, 426,
+	767, 1021, 1020, 510, 1019, 762, 760, 249, 1011, 754, 752, 241, 500, 246, 247, 757,
+	991, 734, 732, 221, 727, 981, 980, 470, 723, 977, 976, 466, 216, 473, 475, 986,
+	975, 718, 716, 205, 711, 965, 964, 454, 707, 961, 960, 450, 200, 457, 459, 970,
+	480, 226, 227, 737, 228, 485, 487, 998, 236, 493, 495, 1006, 747, 1001, 1000, 490,
+	959, 702, 700, 189, 695, 949, 948, 438, 691, 945, 944, 434, 184, 441, 443, 954,
+	687, 941, 940, 430, 939, 682, 680, 169, 931, 674, 672, 161, 420, 166, 167, 677,
+	655, 909, 908, 398, 907, 650, 648, 137, 899, 642, 640, 129, 388, 134, 135, 645,
+	144, 401, 403, 914, 408, 154, 155, 665, 412, 158, 159, 669, 919, 662, 660, 149,
+	831, 574, 572, 61, 567, 821, 820, 310, 563, 817, 816, 306, 56, 313, 315, 826,
+	559, 813, 812, 302, 811, 554, 552, 41, 803, 546, 544, 33, 292, 38, 39, 549,
+	527, 781, 780, 270, 779, 522, 520, 9, 771, 514, 512, 1, 260, 6, 7, 517,
+	16, 273, 275, 786, 280, 26, 27, 537, 284, 30, 31, 541, 791, 534, 532, 21,
+	320, 66, 67, 577, 68, 325, 327, 838, 76, 333, 335, 846, 587, 841, 840, 330,
+	96, 353, 355, 866, 360, 106, 107, 617, 364, 110, 111, 621, 871, 614, 612, 101,
+	112, 369, 371, 882, 376, 122, 123, 633, 380, 126, 127, 637, 887, 630, 628, 117,
+	607, 861, 860, 350, 859, 602, 600, 89, 851, 594, 592, 81, 340, 86, 87, 597,
+	1023, 766, 764, 253, 759, 1013, 1012, 502, 755, 1009, 1008, 498, 248, 505, 507, 1018,
+	751, 1005, 1004, 494, 1003, 746, 744, 233, 995, 738, 736, 225, 484, 230, 231, 741,
+	719, 973, 972, 462, 971, 714, 712, 201, 963, 706, 704, 193, 452, 198, 199, 709,
+	208, 465, 467, 978, 472, 218, 219, 729, 476, 222, 223, 733, 983, 726, 724, 213,
+	639, 893, 892, 382, 891, 634, 632, 121, 883, 626, 624, 113, 372, 118, 119, 629,
+	863, 606, 604, 93, 599, 853, 852, 342, 595, 849, 848, 338, 88, 345, 347, 858,
+	847, 590, 588, 77, 583, 837, 836, 326, 579, 833, 832, 322, 72, 329, 331, 842,
+	352, 98, 99, 609, 100, 357, 359, 870, 108, 365, 367, 878, 619, 873, 872, 362,
+	575, 829, 828, 318, 827, 570, 568, 57, 819, 562, 560, 49, 308, 54, 55, 565,
+	799, 542, 540, 29, 535, 789, 788, 278, 531, 785, 784, 274, 24, 281, 283, 794,
+	783, 526, 524, 13, 519, 773, 772, 262, 515, 769, 768, 258, 8, 265, 267, 778,
+	288, 34, 35, 545, 36, 293, 295, 806, 44, 301, 303, 814, 555, 809, 808, 298,
+	128, 385, 387, 898, 392, 138, 139, 649, 396, 142, 143, 653, 903, 646, 644, 133,
+	400, 146, 147, 657, 148, 405, 407, 918, 156, 413, 415, 926, 667, 921, 920, 410,
+	432, 178, 179, 689, 180, 437, 439, 950, 188, 445, 447, 958, 699, 953, 952, 442,
+	943, 686, 684, 173, 679, 933, 932, 422, 675, 929, 928, 418, 168, 425, 427, 938
+	};
+}
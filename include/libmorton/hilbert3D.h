@@ -0,0 +1,59 @@
+#pragma once
+
+// Libmorton - Methods to convert 3D Morton codes to Hilbert codes and back
+// The Hilbert curve visits the cells in an order in which consecutive cells always share a face, at the cost of a state
+// that depends on all levels above: a Morton code is converted from its highest level down, 3 levels (9 bits) per lookup
+// in a state machine LUT (see hilbert3D_LUTs.h). Levels that don't fill a block of 3 (the top one of 32-bit codes) go
+// through the single level LUT first. The curve starts at (0, 0, 0) and ends at (2^levels - 1, 0, 0).
+// levels is the number of bits per coordinate (10 for 32-bit codes, 21 for 64-bit codes).
+// Warning: hilbert.h will always point to the functions that use the fastest available method.
+
+#include <stdint.h>
+#include "hilbert3D_LUTs.h"
+
+namespace libmorton {
+
+	// CONVERT 3D Morton code to Hilbert code : state machine LUT
+	template<typename morton, unsigned int levels>
+	inline morton m3D_to_hilbert(const morton m) {
+		static_assert(levels * 3 <= sizeof(morton) * 8, "levels has to fit in the code");
+		morton h = 0;
+		unsigned int state = 0;
+		int shift = static_cast<int>(levels * 3);
+		for (unsigned int i = 0; i < levels % 3; ++i) {
+			shift -= 3;
+			const uint16_t entry = Hilbert3D_from_morton_8[(state << 3) | static_cast<unsigned int>((m >> shift) & 0x7)];
+			h |= static_cast<morton>(entry & 0x7) << shift;
+			state = entry >> 3;
+		}
+		while (shift > 0) {
+			shift -= 9;
+			const uint16_t entry = Hilbert3D_from_morton_512[(state << 9) | static_cast<unsigned int>((m >> shift) & 0x1FF)];
+			h |= static_cast<morton>(entry & 0x1FF) << shift;
+			state = entry >> 9;
+		}
+		return h;
+	}
+
+	// CONVERT Hilbert code to 3D Morton code : state machine LUT
+	template<typename morton, unsigned int levels>
+	inline morton m3D_from_hilbert(const morton h) {
+		static_assert(levels * 3 <= sizeof(morton) * 8, "levels has to fit in the code");
+		morton m = 0;
+		unsigned int state = 0;
+		int shift = static_cast<int>(levels * 3);
+		for (unsigned int i = 0; i < levels % 3; ++i) {
+			shift -= 3;
+			const uint16_t entry = Hilbert3D_to_morton_8[(state << 3) | static_cast<unsigned int>((h >> shift) & 0x7)];
+			m |= static_cast<morton>(entry & 0x7) << shift;
+			state = entry >> 3;
+		}
+		while (shift > 0) {
+			shift -= 9;
+			const uint16_t entry = Hilbert3D_to_morton_512[(state << 9) | static_cast<unsigned int>((h >> shift) & 0x1FF)];
+			m |= static_cast<morton>(entry & 0x1FF) << shift;
+			state = entry >> 9;
+		}
+		return m;
+	}
+}
@@ -0,0 +1,820 @@
+#pragma once
+
+#include <stdint.h>
+
+// Libmorton - State machine LUTs for converting between 3D Morton and Hilbert codes (see hilbert3D.h)
+// Index: state << 9 | a block of 3 levels (9 bits) of the code, highest level first. Entry: the converted block in the low
+// 9 bits, the state for the next block above them. There are 12 states, state 0 is the start state.
+// The single level tables (index: state << 3 | 3 bits, next state above bit 3) take care of the levels that don't fill a block.
+// Generated by generateHilbert_LUT in test/morton_LUT_generators.h.
+
+namespace libmorton {
+
+	// LUT for Hilbert3D Morton -> Hilbert (3 levels)
+	static const uint16_t Hilbert3D_from_morton_512[6144] = {
+	0, 513, 5123, 514, 5639, 4614, 5124, 4613, 5658, 5657, 2589, 2590, 539, 2072, 540, 5151,
+	2108, 573, 4159, 574, 2107, 4666, 2616, 4665, 5666, 5665, 2597, 2598, 547, 2080, 548, 5159,
+	520, 1039, 1545, 2062, 2571, 2572, 1546, 2061, 528, 1047, 1553, 2070, 2579, 2580, 1554, 2069,
+	3638, 5169, 567, 1072, 3637, 5170, 5684, 5683, 3630, 5161, 559, 1064, 3629, 5162, 5676, 5675,
+	6118, 6117, 3041, 3042, 2023, 1508, 4064, 1507, 1534, 511, 1533, 4092, 3577, 6136, 3578, 4091,
+	6110, 6109, 3033, 3034, 2015, 1500, 4056, 1499, 1474, 1987, 1473, 4544, 3525, 1988, 3526, 3015,
+	1000, 1519, 2025, 2542, 3051, 3052, 2026, 2541, 1008, 1527, 2033, 2550, 3059, 3060, 2034, 2549,
+	4054, 5585, 983, 1488, 4053, 5586, 6100, 6099, 4046, 5577, 975, 1480, 4045, 5578, 6092, 6091,
+	576, 1095, 1601, 2118, 2627, 2628, 1602, 2117, 1608, 3147, 3663, 3148, 73, 74, 4174, 4173,
+	1114, 1627, 1113, 4184, 3165, 1628, 3166, 2655, 1616, 3155, 3671, 3156, 81, 82, 4182, 4181,
+	4220, 4219, 1661, 2170, 4735, 3192, 1662, 2169, 5750, 5749, 2673, 2674, 1655, 1140, 3696, 1139,
+	1122, 1635, 1121, 4192, 3173, 1636, 3174, 2663, 5742, 5741, 2665, 2666, 1647, 1132, 3688, 1131,
+	5044, 2487, 5043, 5552, 437, 438, 4530, 4529, 952, 1471, 1977, 2494, 3003, 3004, 1978, 2493,
+	5036, 2479, 5035, 5544, 429, 430, 4522, 4521, 2468, 933, 4519, 934, 2467, 5026, 2976, 5025,
+	6026, 6025, 2957, 2958, 907, 2440, 908, 5519, 4484, 4483, 1925, 2434, 4999, 3456, 1926, 2433,
+	6034, 6033, 2965, 2966, 915, 2448, 916, 5527, 2460, 925, 4511, 926, 2459, 5018, 2968, 5017,
+	2260, 725, 4311, 726, 2259, 4818, 2768, 4817, 1258, 1771, 1257, 4328, 3309, 1772, 3310, 2799,
+	728, 1247, 1753, 2270, 2779, 2780, 1754, 2269, 736, 1255, 1761, 2278, 2787, 2788, 1762, 2277,
+	2252, 717, 4303, 718, 2251, 4810, 2760, 4809, 1266, 1779, 1265, 4336, 3317, 1780, 3318, 2807,
+	5830, 5829, 2753, 2754, 1735, 1220, 3776, 1219, 5882, 5881, 2813, 2814, 763, 2296, 764, 5375,
+	2324, 789, 4375, 790, 2323, 4882, 2832, 4881, 1322, 1835, 1321, 4392, 3373, 1836, 3374, 2863,
+	792, 1311, 1817, 2334, 2843, 2844, 1818, 2333, 800, 1319, 1825, 2342, 2851, 2852, 1826, 2341,
+	2316, 781, 4367, 782, 2315, 4874, 2824, 4873, 1330, 1843, 1329, 4400, 3381, 1844, 3382, 2871,
+	5894, 5893, 2817, 2818, 1799, 1284, 3840, 1283, 5946, 5945, 2877, 2878, 827, 2360, 828, 5439,
+	640, 1159, 1665, 2182, 2691, 2692, 1666, 2181, 1672, 3211, 3727, 3212, 137, 138, 4238, 4237,
+	1178, 1691, 1177, 4248, 3229, 1692, 3230, 2719, 1680, 3219, 3735, 3220, 145, 146, 4246, 4245,
+	4284, 4283, 1725, 2234, 4799, 3256, 1726, 2233, 5814, 5813, 2737, 2738, 1719, 1204, 3760, 1203,
+	1186, 1699, 1185, 4256, 3237, 1700, 3238, 2727, 5806, 5805, 2729, 2730, 1711, 1196, 3752, 1195,
+	4980, 2423, 4979, 5488, 373, 374, 4466, 4465, 888, 1407, 1913, 2430, 2939, 2940, 1914, 2429,
+	4972, 2415, 4971, 5480, 365, 366, 4458, 4457, 2404, 869, 4455, 870, 2403, 4962, 2912, 4961,
+	5962, 5961, 2893, 2894, 843, 2376, 844, 5455, 4420, 4419, 1861, 2370, 4935, 3392, 1862, 2369,
+	5970, 5969, 2901, 2902, 851, 2384, 852, 5463, 2396, 861, 4447, 862, 2395, 4954, 2904, 4953,
+	512, 1031, 1537, 2054, 2563, 2564, 1538, 2053, 1544, 3083, 3599, 3084, 9, 10, 4110, 4109,
+	1050, 1563, 1049, 4120, 3101, 1564, 3102, 2591, 1552, 3091, 3607, 3092, 17, 18, 4118, 4117,
+	4156, 4155, 1597, 2106, 4671, 3128, 1598, 2105, 5686, 5685, 2609, 2610, 1591, 1076, 3632, 1075,
+	1058, 1571, 1057, 4128, 3109, 1572, 3110, 2599, 5678, 5677, 2601, 2602, 1583, 1068, 3624, 1067,
+	4308, 4307, 1749, 2258, 4823, 3280, 1750, 2257, 4300, 4299, 1741, 2250, 4815, 3272, 1742, 2249,
+	3818, 5357, 235, 236, 3817, 5358, 4840, 3311, 3826, 5365, 243, 244, 3825, 5366, 4848, 3319,
+	1752, 3291, 3807, 3292, 217, 218, 4318, 4317, 1222, 199, 1221, 3780, 3265, 5824, 3266, 3779,
+	1760, 3299, 3815, 3300, 225, 226, 4326, 4325, 1274, 1787, 1273, 4344, 3325, 1788, 3326, 2815,
+	1510, 487, 1509, 4068, 3553, 6112, 3554, 4067, 2024, 3563, 4079, 3564, 489, 490, 4590, 4589,
+	4094, 5625, 1023, 1528, 4093, 5626, 6140, 6139, 2032, 3571, 4087, 3572, 497, 498, 4598, 4597,
+	1502, 479, 1501, 4060, 3545, 6104, 3546, 4059, 6102, 6101, 3025, 3026, 2007, 1492, 4048, 1491,
+	4034, 5573, 451, 452, 4033, 5574, 5056, 3527, 6094, 6093, 3017, 3018, 1999, 1484, 4040, 1483,
+	4372, 4371, 1813, 2322, 4887, 3344, 1814, 2321, 4364, 4363, 1805, 2314, 4879, 3336, 1806, 2313,
+	3882, 5421, 299, 300, 3881, 5422, 4904, 3375, 3890, 5429, 307, 308, 3889, 5430, 4912, 3383,
+	1816, 3355, 3871, 3356, 281, 282, 4382, 4381, 1286, 263, 1285, 3844, 3329, 5888, 3330, 3843,
+	1824, 3363, 3879, 3364, 289, 290, 4390, 4389, 1338, 1851, 1337, 4408, 3389, 1852, 3390, 2879,
+	1600, 3139, 3655, 3140, 65, 66, 4166, 4165, 4732, 2175, 4731, 5240, 125, 126, 4218, 4217,
+	72, 585, 5195, 586, 5711, 4686, 5196, 4685, 1142, 119, 1141, 3700, 3185, 5744, 3186, 3699,
+	3674, 5213, 91, 92, 3673, 5214, 4696, 3167, 3682, 5221, 99, 100, 3681, 5222, 4704, 3175,
+	80, 593, 5203, 594, 5719, 4694, 5204, 4693, 1134, 111, 1133, 3692, 3177, 5736, 3178, 3691,
+	1664, 3203, 3719, 3204, 129, 130, 4230, 4229, 4796, 2239, 4795, 5304, 189, 190, 4282, 4281,
+	136, 649, 5259, 650, 5775, 4750, 5260, 4749, 1206, 183, 1205, 3764, 3249, 5808, 3250, 3763,
+	3738, 5277, 155, 156, 3737, 5278, 4760, 3231, 3746, 5285, 163, 164, 3745, 5286, 4768, 3239,
+	144, 657, 5267, 658, 5783, 4758, 5268, 4757, 1198, 175, 1197, 3756, 3241, 5800, 3242, 3755,
+	2484, 949, 4535, 950, 2483, 5042, 2992, 5041, 1418, 1931, 1417, 4488, 3469, 1932, 3470, 2959,
+	1976, 3515, 4031, 3516, 441, 442, 4542, 4541, 4996, 2439, 4995, 5504, 389, 390, 4482, 4481,
+	2476, 941, 4527, 942, 2475, 5034, 2984, 5033, 1426, 1939, 1425, 4496, 3477, 1940, 3478, 2967,
+	4516, 4515, 1957, 2466, 5031, 3488, 1958, 2465, 4508, 4507, 1949, 2458, 5023, 3480, 1950, 2457,
+	2420, 885, 4471, 886, 2419, 4978, 2928, 4977, 1354, 1867, 1353, 4424, 3405, 1868, 3406, 2895,
+	1912, 3451, 3967, 3452, 377, 378, 4478, 4477, 4932, 2375, 4931, 5440, 325, 326, 4418, 4417,
+	2412, 877, 4463, 878, 2411, 4970, 2920, 4969, 1362, 1875, 1361, 4432, 3413, 1876, 3414, 2903,
+	4452, 4451, 1893, 2402, 4967, 3424, 1894, 2401, 4444, 4443, 1885, 2394, 4959, 3416, 1886, 2393,
+	4404, 4403, 1845, 2354, 4919, 3376, 1846, 2353, 4396, 4395, 1837, 2346, 4911, 3368, 1838, 2345,
+	3850, 5389, 267, 268, 3849, 5390, 4872, 3343, 3858, 5397, 275, 276, 3857, 5398, 4880, 3351,
+	312, 825, 5435, 826, 5951, 4926, 5436, 4925, 4900, 2343, 4899, 5408, 293, 294, 4386, 4385,
+	2308, 773, 4359, 774, 2307, 4866, 2816, 4865, 4892, 2335, 4891, 5400, 285, 286, 4378, 4377,
+	5108, 2551, 5107, 5616, 501, 502, 4594, 4593, 1016, 1535, 2041, 2558, 3067, 3068, 2042, 2557,
+	5100, 2543, 5099, 5608, 493, 494, 4586, 4585, 2532, 997, 4583, 998, 2531, 5090, 3040, 5089,
+	6090, 6089, 3021, 3022, 971, 2504, 972, 5583, 4548, 4547, 1989, 2498, 5063, 3520, 1990, 2497,
+	6098, 6097, 3029, 3030, 979, 2512, 980, 5591, 2524, 989, 4575, 990, 2523, 5082, 3032, 5081,
+	4340, 4339, 1781, 2290, 4855, 3312, 1782, 2289, 4332, 4331, 1773, 2282, 4847, 3304, 1774, 2281,
+	3786, 5325, 203, 204, 3785, 5326, 4808, 3279, 3794, 5333, 211, 212, 3793, 5334, 4816, 3287,
+	248, 761, 5371, 762, 5887, 4862, 5372, 4861, 4836, 2279, 4835, 5344, 229, 230, 4322, 4321,
+	2244, 709, 4295, 710, 2243, 4802, 2752, 4801, 4828, 2271, 4827, 5336, 221, 222, 4314, 4313,
+	4628, 2071, 4627, 5136, 21, 22, 4114, 4113, 24, 537, 5147, 538, 5663, 4638, 5148, 4637,
+	4620, 2063, 4619, 5128, 13, 14, 4106, 4105, 3590, 5121, 519, 1024, 3589, 5122, 5636, 5635,
+	5674, 5673, 2605, 2606, 555, 2088, 556, 5167, 32, 545, 5155, 546, 5671, 4646, 5156, 4645,
+	5682, 5681, 2613, 2614, 563, 2096, 564, 5175, 3642, 5181, 59, 60, 3641, 5182, 4664, 3135,
+	1856, 3395, 3911, 3396, 321, 322, 4422, 4421, 4988, 2431, 4987, 5496, 381, 382, 4474, 4473,
+	328, 841, 5451, 842, 5967, 4942, 5452, 4941, 1398, 375, 1397, 3956, 3441, 6000, 3442, 3955,
+	3930, 5469, 347, 348, 3929, 5470, 4952, 3423, 3938, 5477, 355, 356, 3937, 5478, 4960, 3431,
+	336, 849, 5459, 850, 5975, 4950, 5460, 4949, 1390, 367, 1389, 3948, 3433, 5992, 3434, 3947,
+	1920, 3459, 3975, 3460, 385, 386, 4486, 4485, 5052, 2495, 5051, 5560, 445, 446, 4538, 4537,
+	392, 905, 5515, 906, 6031, 5006, 5516, 5005, 1462, 439, 1461, 4020, 3505, 6064, 3506, 4019,
+	3994, 5533, 411, 412, 3993, 5534, 5016, 3487, 4002, 5541, 419, 420, 4001, 5542, 5024, 3495,
+	400, 913, 5523, 914, 6039, 5014, 5524, 5013, 1454, 431, 1453, 4012, 3497, 6056, 3498, 4011,
+	2228, 693, 4279, 694, 2227, 4786, 2736, 4785, 1162, 1675, 1161, 4232, 3213, 1676, 3214, 2703,
+	1720, 3259, 3775, 3260, 185, 186, 4286, 4285, 4740, 2183, 4739, 5248, 133, 134, 4226, 4225,
+	2220, 685, 4271, 686, 2219, 4778, 2728, 4777, 1170, 1683, 1169, 4240, 3221, 1684, 3222, 2711,
+	4260, 4259, 1701, 2210, 4775, 3232, 1702, 2209, 4252, 4251, 1693, 2202, 4767, 3224, 1694, 2201,
+	2164, 629, 4215, 630, 2163, 4722, 2672, 4721, 1098, 1611, 1097, 4168, 3149, 1612, 3150, 2639,
+	1656, 3195, 3711, 3196, 121, 122, 4222, 4221, 4676, 2119, 4675, 5184, 69, 70, 4162, 4161,
+	2156, 621, 4207, 622, 2155, 4714, 2664, 4713, 1106, 1619, 1105, 4176, 3157, 1620, 3158, 2647,
+	4196, 4195, 1637, 2146, 4711, 3168, 1638, 2145, 4188, 4187, 1629, 2138, 4703, 3160, 1630, 2137,
+	1536, 3075, 3591, 3076, 1, 2, 4102, 4101, 4668, 2111, 4667, 5176, 61, 62, 4154, 4153,
+	8, 521, 5131, 522, 5647, 4622, 5132, 4621, 1078, 55, 1077, 3636, 3121, 5680, 3122, 3635,
+	3610, 5149, 27, 28, 3609, 5150, 4632, 3103, 3618, 5157, 35, 36, 3617, 5158, 4640, 3111,
+	16, 529, 5139, 530, 5655, 4630, 5140, 4629, 1070, 47, 1069, 3628, 3113, 5672, 3114, 3627,
+	64, 577, 5187, 578, 5703, 4678, 5188, 4677, 5722, 5721, 2653, 2654, 603, 2136, 604, 5215,
+	2172, 637, 4223, 638, 2171, 4730, 2680, 4729, 5730, 5729, 2661, 2662, 611, 2144, 612, 5223,
+	584, 1103, 1609, 2126, 2635, 2636, 1610, 2125, 592, 1111, 1617, 2134, 2643, 2644, 1618, 2133,
+	3702, 5233, 631, 1136, 3701, 5234, 5748, 5747, 3694, 5225, 623, 1128, 3693, 5226, 5740, 5739,
+	4820, 2263, 4819, 5328, 213, 214, 4306, 4305, 216, 729, 5339, 730, 5855, 4830, 5340, 4829,
+	4812, 2255, 4811, 5320, 205, 206, 4298, 4297, 3782, 5313, 711, 1216, 3781, 5314, 5828, 5827,
+	5866, 5865, 2797, 2798, 747, 2280, 748, 5359, 224, 737, 5347, 738, 5863, 4838, 5348, 4837,
+	5874, 5873, 2805, 2806, 755, 2288, 756, 5367, 3834, 5373, 251, 252, 3833, 5374, 4856, 3327,
+	128, 641, 5251, 642, 5767, 4742, 5252, 4741, 5786, 5785, 2717, 2718, 667, 2200, 668, 5279,
+	2236, 701, 4287, 702, 2235, 4794, 2744, 4793, 5794, 5793, 2725, 2726, 675, 2208, 676, 5287,
+	648, 1167, 1673, 2190, 2699, 2700, 1674, 2189, 656, 1175, 1681, 2198, 2707, 2708, 1682, 2197,
+	3766, 5297, 695, 1200, 3765, 5298, 5812, 5811, 3758, 5289, 687, 1192, 3757, 5290, 5804, 5803,
+	4070, 5601, 999, 1504, 4069, 5602, 6116, 6115, 4062, 5593, 991, 1496, 4061, 5594, 6108, 6107,
+	488, 1001, 5611, 1002, 6127, 5102, 5612, 5101, 1494, 471, 1493, 4052, 3537, 6096, 3538, 4051,
+	6142, 6141, 3065, 3066, 2047, 1532, 4088, 1531, 6082, 6081, 3013, 3014, 963, 2496, 964, 5575,
+	496, 1009, 5619, 1010, 6135, 5110, 5620, 5109, 1486, 463, 1485, 4044, 3529, 6088, 3530, 4043,
+	4532, 4531, 1973, 2482, 5047, 3504, 1974, 2481, 4524, 4523, 1965, 2474, 5039, 3496, 1966, 2473,
+	3978, 5517, 395, 396, 3977, 5518, 5000, 3471, 3986, 5525, 403, 404, 3985, 5526, 5008, 3479,
+	440, 953, 5563, 954, 6079, 5054, 5564, 5053, 5028, 2471, 5027, 5536, 421, 422, 4514, 4513,
+	2436, 901, 4487, 902, 2435, 4994, 2944, 4993, 5020, 2463, 5019, 5528, 413, 414, 4506, 4505,
+	4884, 2327, 4883, 5392, 277, 278, 4370, 4369, 280, 793, 5403, 794, 5919, 4894, 5404, 4893,
+	4876, 2319, 4875, 5384, 269, 270, 4362, 4361, 3846, 5377, 775, 1280, 3845, 5378, 5892, 5891,
+	5930, 5929, 2861, 2862, 811, 2344, 812, 5423, 288, 801, 5411, 802, 5927, 4902, 5412, 4901,
+	5938, 5937, 2869, 2870, 819, 2352, 820, 5431, 3898, 5437, 315, 316, 3897, 5438, 4920, 3391,
+	4468, 4467, 1909, 2418, 4983, 3440, 1910, 2417, 4460, 4459, 1901, 2410, 4975, 3432, 1902, 2409,
+	3914, 5453, 331, 332, 3913, 5454, 4936, 3407, 3922, 5461, 339, 340, 3921, 5462, 4944, 3415,
+	376, 889, 5499, 890, 6015, 4990, 5500, 4989, 4964, 2407, 4963, 5472, 357, 358, 4450, 4449,
+	2372, 837, 4423, 838, 2371, 4930, 2880, 4929, 4956, 2399, 4955, 5464, 349, 350, 4442, 4441,
+	6054, 6053, 2977, 2978, 1959, 1444, 4000, 1443, 1470, 447, 1469, 4028, 3513, 6072, 3514, 4027,
+	6046, 6045, 2969, 2970, 1951, 1436, 3992, 1435, 1410, 1923, 1409, 4480, 3461, 1924, 3462, 2951,
+	936, 1455, 1961, 2478, 2987, 2988, 1962, 2477, 944, 1463, 1969, 2486, 2995, 2996, 1970, 2485,
+	3990, 5521, 919, 1424, 3989, 5522, 6036, 6035, 3982, 5513, 911, 1416, 3981, 5514, 6028, 6027,
+	1984, 3523, 4039, 3524, 449, 450, 4550, 4549, 5116, 2559, 5115, 5624, 509, 510, 4602, 4601,
+	456, 969, 5579, 970, 6095, 5070, 5580, 5069, 1526, 503, 1525, 4084, 3569, 6128, 3570, 4083,
+	4058, 5597, 475, 476, 4057, 5598, 5080, 3551, 4066, 5605, 483, 484, 4065, 5606, 5088, 3559,
+	464, 977, 5587, 978, 6103, 5078, 5588, 5077, 1518, 495, 1517, 4076, 3561, 6120, 3562, 4075,
+	5990, 5989, 2913, 2914, 1895, 1380, 3936, 1379, 1406, 383, 1405, 3964, 3449, 6008, 3450, 3963,
+	5982, 5981, 2905, 2906, 1887, 1372, 3928, 1371, 1346, 1859, 1345, 4416, 3397, 1860, 3398, 2887,
+	872, 1391, 1897, 2414, 2923, 2924, 1898, 2413, 880, 1399, 1905, 2422, 2931, 2932, 1906, 2421,
+	3926, 5457, 855, 1360, 3925, 5458, 5972, 5971, 3918, 5449, 847, 1352, 3917, 5450, 5964, 5963,
+	1318, 295, 1317, 3876, 3361, 5920, 3362, 3875, 1832, 3371, 3887, 3372, 297, 298, 4398, 4397,
+	3902, 5433, 831, 1336, 3901, 5434, 5948, 5947, 1840, 3379, 3895, 3380, 305, 306, 4406, 4405,
+	1310, 287, 1309, 3868, 3353, 5912, 3354, 3867, 5910, 5909, 2833, 2834, 1815, 1300, 3856, 1299,
+	3842, 5381, 259, 260, 3841, 5382, 4864, 3335, 5902, 5901, 2825, 2826, 1807, 1292, 3848, 1291,
+	4180, 4179, 1621, 2130, 4695, 3152, 1622, 2129, 4172, 4171, 1613, 2122, 4687, 3144, 1614, 2121,
+	3690, 5229, 107, 108, 3689, 5230, 4712, 3183, 3698, 5237, 115, 116, 3697, 5238, 4720, 3191,
+	1624, 3163, 3679, 3164, 89, 90, 4190, 4189, 1094, 71, 1093, 3652, 3137, 5696, 3138, 3651,
+	1632, 3171, 3687, 3172, 97, 98, 4198, 4197, 1146, 1659, 1145, 4216, 3197, 1660, 3198, 2687,
+	3622, 5153, 551, 1056, 3621, 5154, 5668, 5667, 3614, 5145, 543, 1048, 3613, 5146, 5660, 5659,
+	40, 553, 5163, 554, 5679, 4654, 5164, 4653, 1046, 23, 1045, 3604, 3089, 5648, 3090, 3603,
+	5694, 5693, 2617, 2618, 1599, 1084, 3640, 1083, 5634, 5633, 2565, 2566, 515, 2048, 516, 5127,
+	48, 561, 5171, 562, 5687, 4662, 5172, 4661, 1038, 15, 1037, 3596, 3081, 5640, 3082, 3595,
+	4244, 4243, 1685, 2194, 4759, 3216, 1686, 2193, 4236, 4235, 1677, 2186, 4751, 3208, 1678, 2185,
+	3754, 5293, 171, 172, 3753, 5294, 4776, 3247, 3762, 5301, 179, 180, 3761, 5302, 4784, 3255,
+	1688, 3227, 3743, 3228, 153, 154, 4254, 4253, 1158, 135, 1157, 3716, 3201, 5760, 3202, 3715,
+	1696, 3235, 3751, 3236, 161, 162, 4262, 4261, 1210, 1723, 1209, 4280, 3261, 1724, 3262, 2751,
+	1254, 231, 1253, 3812, 3297, 5856, 3298, 3811, 1768, 3307, 3823, 3308, 233, 234, 4334, 4333,
+	3838, 5369, 767, 1272, 3837, 5370, 5884, 5883, 1776, 3315, 3831, 3316, 241, 242, 4342, 4341,
+	1246, 223, 1245, 3804, 3289, 5848, 3290, 3803, 5846, 5845, 2769, 2770, 1751, 1236, 3792, 1235,
+	3778, 5317, 195, 196, 3777, 5318, 4800, 3271, 5838, 5837, 2761, 2762, 1743, 1228, 3784, 1227,
+	1190, 167, 1189, 3748, 3233, 5792, 3234, 3747, 1704, 3243, 3759, 3244, 169, 170, 4270, 4269,
+	3774, 5305, 703, 1208, 3773, 5306, 5820, 5819, 1712, 3251, 3767, 3252, 177, 178, 4278, 4277,
+	1182, 159, 1181, 3740, 3225, 5784, 3226, 3739, 5782, 5781, 2705, 2706, 1687, 1172, 3728, 1171,
+	3714, 5253, 131, 132, 3713, 5254, 4736, 3207, 5774, 5773, 2697, 2698, 1679, 1164, 3720, 1163,
+	4948, 2391, 4947, 5456, 341, 342, 4434, 4433, 344, 857, 5467, 858, 5983, 4958, 5468, 4957,
+	4940, 2383, 4939, 5448, 333, 334, 4426, 4425, 3910, 5441, 839, 1344, 3909, 5442, 5956, 5955,
+	5994, 5993, 2925, 2926, 875, 2408, 876, 5487, 352, 865, 5475, 866, 5991, 4966, 5476, 4965,
+	6002, 6001, 2933, 2934, 883, 2416, 884, 5495, 3962, 5501, 379, 380, 3961, 5502, 4984, 3455,
+	1728, 3267, 3783, 3268, 193, 194, 4294, 4293, 4860, 2303, 4859, 5368, 253, 254, 4346, 4345,
+	200, 713, 5323, 714, 5839, 4814, 5324, 4813, 1270, 247, 1269, 3828, 3313, 5872, 3314, 3827,
+	3802, 5341, 219, 220, 3801, 5342, 4824, 3295, 3810, 5349, 227, 228, 3809, 5350, 4832, 3303,
+	208, 721, 5331, 722, 5847, 4822, 5332, 4821, 1262, 239, 1261, 3820, 3305, 5864, 3306, 3819,
+	1792, 3331, 3847, 3332, 257, 258, 4358, 4357, 4924, 2367, 4923, 5432, 317, 318, 4410, 4409,
+	264, 777, 5387, 778, 5903, 4878, 5388, 4877, 1334, 311, 1333, 3892, 3377, 5936, 3378, 3891,
+	3866, 5405, 283, 284, 3865, 5406, 4888, 3359, 3874, 5413, 291, 292, 3873, 5414, 4896, 3367,
+	272, 785, 5395, 786, 5911, 4886, 5396, 4885, 1326, 303, 1325, 3884, 3369, 5928, 3370, 3883,
+	1126, 103, 1125, 3684, 3169, 5728, 3170, 3683, 1640, 3179, 3695, 3180, 105, 106, 4206, 4205,
+	3710, 5241, 639, 1144, 3709, 5242, 5756, 5755, 1648, 3187, 3703, 3188, 113, 114, 4214, 4213,
+	1118, 95, 1117, 3676, 3161, 5720, 3162, 3675, 5718, 5717, 2641, 2642, 1623, 1108, 3664, 1107,
+	3650, 5189, 67, 68, 3649, 5190, 4672, 3143, 5710, 5709, 2633, 2634, 1615, 1100, 3656, 1099,
+	5012, 2455, 5011, 5520, 405, 406, 4498, 4497, 408, 921, 5531, 922, 6047, 5022, 5532, 5021,
+	5004, 2447, 5003, 5512, 397, 398, 4490, 4489, 3974, 5505, 903, 1408, 3973, 5506, 6020, 6019,
+	6058, 6057, 2989, 2990, 939, 2472, 940, 5551, 416, 929, 5539, 930, 6055, 5030, 5540, 5029,
+	6066, 6065, 2997, 2998, 947, 2480, 948, 5559, 4026, 5565, 443, 444, 4025, 5566, 5048, 3519,
+	4148, 4147, 1589, 2098, 4663, 3120, 1590, 2097, 4140, 4139, 1581, 2090, 4655, 3112, 1582, 2089,
+	3594, 5133, 11, 12, 3593, 5134, 4616, 3087, 3602, 5141, 19, 20, 3601, 5142, 4624, 3095,
+	56, 569, 5179, 570, 5695, 4670, 5180, 4669, 4644, 2087, 4643, 5152, 37, 38, 4130, 4129,
+	2052, 517, 4103, 518, 2051, 4610, 2560, 4609, 4636, 2079, 4635, 5144, 29, 30, 4122, 4121,
+	4564, 4563, 2005, 2514, 5079, 3536, 2006, 2513, 4556, 4555, 1997, 2506, 5071, 3528, 1998, 2505,
+	4074, 5613, 491, 492, 4073, 5614, 5096, 3567, 4082, 5621, 499, 500, 4081, 5622, 5104, 3575,
+	2008, 3547, 4063, 3548, 473, 474, 4574, 4573, 1478, 455, 1477, 4036, 3521, 6080, 3522, 4035,
+	2016, 3555, 4071, 3556, 481, 482, 4582, 4581, 1530, 2043, 1529, 4600, 3581, 2044, 3582, 3071,
+	3750, 5281, 679, 1184, 3749, 5282, 5796, 5795, 3742, 5273, 671, 1176, 3741, 5274, 5788, 5787,
+	168, 681, 5291, 682, 5807, 4782, 5292, 4781, 1174, 151, 1173, 3732, 3217, 5776, 3218, 3731,
+	5822, 5821, 2745, 2746, 1727, 1212, 3768, 1211, 5762, 5761, 2693, 2694, 643, 2176, 644, 5255,
+	176, 689, 5299, 690, 5815, 4790, 5300, 4789, 1166, 143, 1165, 3724, 3209, 5768, 3210, 3723,
+	3686, 5217, 615, 1120, 3685, 5218, 5732, 5731, 3678, 5209, 607, 1112, 3677, 5210, 5724, 5723,
+	104, 617, 5227, 618, 5743, 4718, 5228, 4717, 1110, 87, 1109, 3668, 3153, 5712, 3154, 3667,
+	5758, 5757, 2681, 2682, 1663, 1148, 3704, 1147, 5698, 5697, 2629, 2630, 579, 2112, 580, 5191,
+	112, 625, 5235, 626, 5751, 4726, 5236, 4725, 1102, 79, 1101, 3660, 3145, 5704, 3146, 3659,
+	2388, 853, 4439, 854, 2387, 4946, 2896, 4945, 1386, 1899, 1385, 4456, 3437, 1900, 3438, 2927,
+	856, 1375, 1881, 2398, 2907, 2908, 1882, 2397, 864, 1383, 1889, 2406, 2915, 2916, 1890, 2405,
+	2380, 845, 4431, 846, 2379, 4938, 2888, 4937, 1394, 1907, 1393, 4464, 3445, 1908, 3446, 2935,
+	5958, 5957, 2881, 2882, 1863, 1348, 3904, 1347, 6010, 6009, 2941, 2942, 891, 2424, 892, 5503,
+	2452, 917, 4503, 918, 2451, 5010, 2960, 5009, 1450, 1963, 1449, 4520, 3501, 1964, 3502, 2991,
+	920, 1439, 1945, 2462, 2971, 2972, 1946, 2461, 928, 1447, 1953, 2470, 2979, 2980, 1954, 2469,
+	2444, 909, 4495, 910, 2443, 5002, 2952, 5001, 1458, 1971, 1457, 4528, 3509, 1972, 3510, 2999,
+	6022, 6021, 2945, 2946, 1927, 1412, 3968, 1411, 6074, 6073, 3005, 3006, 955, 2488, 956, 5567,
+	192, 705, 5315, 706, 5831, 4806, 5316, 4805, 5850, 5849, 2781, 2782, 731, 2264, 732, 5343,
+	2300, 765, 4351, 766, 2299, 4858, 2808, 4857, 5858, 5857, 2789, 2790, 739, 2272, 740, 5351,
+	712, 1231, 1737, 2254, 2763, 2764, 1738, 2253, 720, 1239, 1745, 2262, 2771, 2772, 1746, 2261,
+	3830, 5361, 759, 1264, 3829, 5362, 5876, 5875, 3822, 5353, 751, 1256, 3821, 5354, 5868, 5867,
+	4660, 2103, 4659, 5168, 53, 54, 4146, 4145, 568, 1087, 1593, 2110, 2619, 2620, 1594, 2109,
+	4652, 2095, 4651, 5160, 45, 46, 4138, 4137, 2084, 549, 4135, 550, 2083, 4642, 2592, 4641,
+	5642, 5641, 2573, 2574, 523, 2056, 524, 5135, 4100, 4099, 1541, 2050, 4615, 3072, 1542, 2049,
+	5650, 5649, 2581, 2582, 531, 2064, 532, 5143, 2076, 541, 4127, 542, 2075, 4634, 2584, 4633,
+	256, 769, 5379, 770, 5895, 4870, 5380, 4869, 5914, 5913, 2845, 2846, 795, 2328, 796, 5407,
+	2364, 829, 4415, 830, 2363, 4922, 2872, 4921, 5922, 5921, 2853, 2854, 803, 2336, 804, 5415,
+	776, 1295, 1801, 2318, 2827, 2828, 1802, 2317, 784, 1303, 1809, 2326, 2835, 2836, 1810, 2325,
+	3894, 5425, 823, 1328, 3893, 5426, 5940, 5939, 3886, 5417, 815, 1320, 3885, 5418, 5932, 5931,
+	5076, 2519, 5075, 5584, 469, 470, 4562, 4561, 472, 985, 5595, 986, 6111, 5086, 5596, 5085,
+	5068, 2511, 5067, 5576, 461, 462, 4554, 4553, 4038, 5569, 967, 1472, 4037, 5570, 6084, 6083,
+	6122, 6121, 3053, 3054, 1003, 2536, 1004, 5615, 480, 993, 5603, 994, 6119, 5094, 5604, 5093,
+	6130, 6129, 3061, 3062, 1011, 2544, 1012, 5623, 4090, 5629, 507, 508, 4089, 5630, 5112, 3583,
+	4916, 2359, 4915, 5424, 309, 310, 4402, 4401, 824, 1343, 1849, 2366, 2875, 2876, 1850, 2365,
+	4908, 2351, 4907, 5416, 301, 302, 4394, 4393, 2340, 805, 4391, 806, 2339, 4898, 2848, 4897,
+	5898, 5897, 2829, 2830, 779, 2312, 780, 5391, 4356, 4355, 1797, 2306, 4871, 3328, 1798, 2305,
+	5906, 5905, 2837, 2838, 787, 2320, 788, 5399, 2332, 797, 4383, 798, 2331, 4890, 2840, 4889,
+	320, 833, 5443, 834, 5959, 4934, 5444, 4933, 5978, 5977, 2909, 2910, 859, 2392, 860, 5471,
+	2428, 893, 4479, 894, 2427, 4986, 2936, 4985, 5986, 5985, 2917, 2918, 867, 2400, 868, 5479,
+	840, 1359, 1865, 2382, 2891, 2892, 1866, 2381, 848, 1367, 1873, 2390, 2899, 2900, 1874, 2389,
+	3958, 5489, 887, 1392, 3957, 5490, 6004, 6003, 3950, 5481, 879, 1384, 3949, 5482, 5996, 5995,
+	2548, 1013, 4599, 1014, 2547, 5106, 3056, 5105, 1482, 1995, 1481, 4552, 3533, 1996, 3534, 3023,
+	2040, 3579, 4095, 3580, 505, 506, 4606, 4605, 5060, 2503, 5059, 5568, 453, 454, 4546, 4545,
+	2540, 1005, 4591, 1006, 2539, 5098, 3048, 5097, 1490, 2003, 1489, 4560, 3541, 2004, 3542, 3031,
+	4580, 4579, 2021, 2530, 5095, 3552, 2022, 2529, 4572, 4571, 2013, 2522, 5087, 3544, 2014, 2521,
+	384, 897, 5507, 898, 6023, 4998, 5508, 4997, 6042, 6041, 2973, 2974, 923, 2456, 924, 5535,
+	2492, 957, 4543, 958, 2491, 5050, 3000, 5049, 6050, 6049, 2981, 2982, 931, 2464, 932, 5543,
+	904, 1423, 1929, 2446, 2955, 2956, 1930, 2445, 912, 1431, 1937, 2454, 2963, 2964, 1938, 2453,
+	4022, 5553, 951, 1456, 4021, 5554, 6068, 6067, 4014, 5545, 943, 1448, 4013, 5546, 6060, 6059,
+	4852, 2295, 4851, 5360, 245, 246, 4338, 4337, 760, 1279, 1785, 2302, 2811, 2812, 1786, 2301,
+	4844, 2287, 4843, 5352, 237, 238, 4330, 4329, 2276, 741, 4327, 742, 2275, 4834, 2784, 4833,
+	5834, 5833, 2765, 2766, 715, 2248, 716, 5327, 4292, 4291, 1733, 2242, 4807, 3264, 1734, 2241,
+	5842, 5841, 2773, 2774, 723, 2256, 724, 5335, 2268, 733, 4319, 734, 2267, 4826, 2776, 4825,
+	4276, 4275, 1717, 2226, 4791, 3248, 1718, 2225, 4268, 4267, 1709, 2218, 4783, 3240, 1710, 2217,
+	3722, 5261, 139, 140, 3721, 5262, 4744, 3215, 3730, 5269, 147, 148, 3729, 5270, 4752, 3223,
+	184, 697, 5307, 698, 5823, 4798, 5308, 4797, 4772, 2215, 4771, 5280, 165, 166, 4258, 4257,
+	2180, 645, 4231, 646, 2179, 4738, 2688, 4737, 4764, 2207, 4763, 5272, 157, 158, 4250, 4249,
+	2068, 533, 4119, 534, 2067, 4626, 2576, 4625, 1066, 1579, 1065, 4136, 3117, 1580, 3118, 2607,
+	536, 1055, 1561, 2078, 2587, 2588, 1562, 2077, 544, 1063, 1569, 2086, 2595, 2596, 1570, 2085,
+	2060, 525, 4111, 526, 2059, 4618, 2568, 4617, 1074, 1587, 1073, 4144, 3125, 1588, 3126, 2615,
+	5638, 5637, 2561, 2562, 1543, 1028, 3584, 1027, 5690, 5689, 2621, 2622, 571, 2104, 572, 5183,
+	4212, 4211, 1653, 2162, 4727, 3184, 1654, 2161, 4204, 4203, 1645, 2154, 4719, 3176, 1646, 2153,
+	3658, 5197, 75, 76, 3657, 5198, 4680, 3151, 3666, 5205, 83, 84, 3665, 5206, 4688, 3159,
+	120, 633, 5243, 634, 5759, 4734, 5244, 4733, 4708, 2151, 4707, 5216, 101, 102, 4194, 4193,
+	2116, 581, 4167, 582, 2115, 4674, 2624, 4673, 4700, 2143, 4699, 5208, 93, 94, 4186, 4185,
+	1446, 423, 1445, 4004, 3489, 6048, 3490, 4003, 1960, 3499, 4015, 3500, 425, 426, 4526, 4525,
+	4030, 5561, 959, 1464, 4029, 5562, 6076, 6075, 1968, 3507, 4023, 3508, 433, 434, 4534, 4533,
+	1438, 415, 1437, 3996, 3481, 6040, 3482, 3995, 6038, 6037, 2961, 2962, 1943, 1428, 3984, 1427,
+	3970, 5509, 387, 388, 3969, 5510, 4992, 3463, 6030, 6029, 2953, 2954, 1935, 1420, 3976, 1419,
+	4692, 2135, 4691, 5200, 85, 86, 4178, 4177, 88, 601, 5211, 602, 5727, 4702, 5212, 4701,
+	4684, 2127, 4683, 5192, 77, 78, 4170, 4169, 3654, 5185, 583, 1088, 3653, 5186, 5700, 5699,
+	5738, 5737, 2669, 2670, 619, 2152, 620, 5231, 96, 609, 5219, 610, 5735, 4710, 5220, 4709,
+	5746, 5745, 2677, 2678, 627, 2160, 628, 5239, 3706, 5245, 123, 124, 3705, 5246, 4728, 3199,
+	448, 961, 5571, 962, 6087, 5062, 5572, 5061, 6106, 6105, 3037, 3038, 987, 2520, 988, 5599,
+	2556, 1021, 4607, 1022, 2555, 5114, 3064, 5113, 6114, 6113, 3045, 3046, 995, 2528, 996, 5607,
+	968, 1487, 1993, 2510, 3019, 3020, 1994, 2509, 976, 1495, 2001, 2518, 3027, 3028, 2002, 2517,
+	4086, 5617, 1015, 1520, 4085, 5618, 6132, 6131, 4078, 5609, 1007, 1512, 4077, 5610, 6124, 6123,
+	5670, 5669, 2593, 2594, 1575, 1060, 3616, 1059, 1086, 63, 1085, 3644, 3129, 5688, 3130, 3643,
+	5662, 5661, 2585, 2586, 1567, 1052, 3608, 1051, 1026, 1539, 1025, 4096, 3077, 1540, 3078, 2567,
+	552, 1071, 1577, 2094, 2603, 2604, 1578, 2093, 560, 1079, 1585, 2102, 2611, 2612, 1586, 2101,
+	3606, 5137, 535, 1040, 3605, 5138, 5652, 5651, 3598, 5129, 527, 1032, 3597, 5130, 5644, 5643,
+	1382, 359, 1381, 3940, 3425, 5984, 3426, 3939, 1896, 3435, 3951, 3436, 361, 362, 4462, 4461,
+	3966, 5497, 895, 1400, 3965, 5498, 6012, 6011, 1904, 3443, 3959, 3444, 369, 370, 4470, 4469,
+	1374, 351, 1373, 3932, 3417, 5976, 3418, 3931, 5974, 5973, 2897, 2898, 1879, 1364, 3920, 1363,
+	3906, 5445, 323, 324, 3905, 5446, 4928, 3399, 5966, 5965, 2889, 2890, 1871, 1356, 3912, 1355,
+	4756, 2199, 4755, 5264, 149, 150, 4242, 4241, 152, 665, 5275, 666, 5791, 4766, 5276, 4765,
+	4748, 2191, 4747, 5256, 141, 142, 4234, 4233, 3718, 5249, 647, 1152, 3717, 5250, 5764, 5763,
+	5802, 5801, 2733, 2734, 683, 2216, 684, 5295, 160, 673, 5283, 674, 5799, 4774, 5284, 4773,
+	5810, 5809, 2741, 2742, 691, 2224, 692, 5303, 3770, 5309, 187, 188, 3769, 5310, 4792, 3263,
+	3878, 5409, 807, 1312, 3877, 5410, 5924, 5923, 3870, 5401, 799, 1304, 3869, 5402, 5916, 5915,
+	296, 809, 5419, 810, 5935, 4910, 5420, 4909, 1302, 279, 1301, 3860, 3345, 5904, 3346, 3859,
+	5950, 5949, 2873, 2874, 1855, 1340, 3896, 1339, 5890, 5889, 2821, 2822, 771, 2304, 772, 5383,
+	304, 817, 5427, 818, 5943, 4918, 5428, 4917, 1294, 271, 1293, 3852, 3337, 5896, 3338, 3851,
+	3814, 5345, 743, 1248, 3813, 5346, 5860, 5859, 3806, 5337, 735, 1240, 3805, 5338, 5852, 5851,
+	232, 745, 5355, 746, 5871, 4846, 5356, 4845, 1238, 215, 1237, 3796, 3281, 5840, 3282, 3795,
+	5886, 5885, 2809, 2810, 1791, 1276, 3832, 1275, 5826, 5825, 2757, 2758, 707, 2240, 708, 5319,
+	240, 753, 5363, 754, 5879, 4854, 5364, 4853, 1230, 207, 1229, 3788, 3273, 5832, 3274, 3787,
+	4006, 5537, 935, 1440, 4005, 5538, 6052, 6051, 3998, 5529, 927, 1432, 3997, 5530, 6044, 6043,
+	424, 937, 5547, 938, 6063, 5038, 5548, 5037, 1430, 407, 1429, 3988, 3473, 6032, 3474, 3987,
+	6078, 6077, 3001, 3002, 1983, 1468, 4024, 1467, 6018, 6017, 2949, 2950, 899, 2432, 900, 5511,
+	432, 945, 5555, 946, 6071, 5046, 5556, 5045, 1422, 399, 1421, 3980, 3465, 6024, 3466, 3979,
+	3942, 5473, 871, 1376, 3941, 5474, 5988, 5987, 3934, 5465, 863, 1368, 3933, 5466, 5980, 5979,
+	360, 873, 5483, 874, 5999, 4974, 5484, 4973, 1366, 343, 1365, 3924, 3409, 5968, 3410, 3923,
+	6014, 6013, 2937, 2938, 1919, 1404, 3960, 1403, 5954, 5953, 2885, 2886, 835, 2368, 836, 5447,
+	368, 881, 5491, 882, 6007, 4982, 5492, 4981, 1358, 335, 1357, 3916, 3401, 5960, 3402, 3915,
+	2132, 597, 4183, 598, 2131, 4690, 2640, 4689, 1130, 1643, 1129, 4200, 3181, 1644, 3182, 2671,
+	600, 1119, 1625, 2142, 2651, 2652, 1626, 2141, 608, 1127, 1633, 2150, 2659, 2660, 1634, 2149,
+	2124, 589, 4175, 590, 2123, 4682, 2632, 4681, 1138, 1651, 1137, 4208, 3189, 1652, 3190, 2679,
+	5702, 5701, 2625, 2626, 1607, 1092, 3648, 1091, 5754, 5753, 2685, 2686, 635, 2168, 636, 5247,
+	2196, 661, 4247, 662, 2195, 4754, 2704, 4753, 1194, 1707, 1193, 4264, 3245, 1708, 3246, 2735,
+	664, 1183, 1689, 2206, 2715, 2716, 1690, 2205, 672, 1191, 1697, 2214, 2723, 2724, 1698, 2213,
+	2188, 653, 4239, 654, 2187, 4746, 2696, 4745, 1202, 1715, 1201, 4272, 3253, 1716, 3254, 2743,
+	5766, 5765, 2689, 2690, 1671, 1156, 3712, 1155, 5818, 5817, 2749, 2750, 699, 2232, 700, 5311,
+	960, 1479, 1985, 2502, 3011, 3012, 1986, 2501, 1992, 3531, 4047, 3532, 457, 458, 4558, 4557,
+	1498, 2011, 1497, 4568, 3549, 2012, 3550, 3039, 2000, 3539, 4055, 3540, 465, 466, 4566, 4565,
+	4604, 4603, 2045, 2554, 5119, 3576, 2046, 2553, 6134, 6133, 3057, 3058, 2039, 1524, 4080, 1523,
+	1506, 2019, 1505, 4576, 3557, 2020, 3558, 3047, 6126, 6125, 3049, 3050, 2031, 1516, 4072, 1515,
+	5926, 5925, 2849, 2850, 1831, 1316, 3872, 1315, 1342, 319, 1341, 3900, 3385, 5944, 3386, 3899,
+	5918, 5917, 2841, 2842, 1823, 1308, 3864, 1307, 1282, 1795, 1281, 4352, 3333, 1796, 3334, 2823,
+	808, 1327, 1833, 2350, 2859, 2860, 1834, 2349, 816, 1335, 1841, 2358, 2867, 2868, 1842, 2357,
+	3862, 5393, 791, 1296, 3861, 5394, 5908, 5907, 3854, 5385, 783, 1288, 3853, 5386, 5900, 5899,
+	1062, 39, 1061, 3620, 3105, 5664, 3106, 3619, 1576, 3115, 3631, 3116, 41, 42, 4142, 4141,
+	3646, 5177, 575, 1080, 3645, 5178, 5692, 5691, 1584, 3123, 3639, 3124, 49, 50, 4150, 4149,
+	1054, 31, 1053, 3612, 3097, 5656, 3098, 3611, 5654, 5653, 2577, 2578, 1559, 1044, 3600, 1043,
+	3586, 5125, 3, 4, 3585, 5126, 4608, 3079, 5646, 5645, 2569, 2570, 1551, 1036, 3592, 1035,
+	5862, 5861, 2785, 2786, 1767, 1252, 3808, 1251, 1278, 255, 1277, 3836, 3321, 5880, 3322, 3835,
+	5854, 5853, 2777, 2778, 1759, 1244, 3800, 1243, 1218, 1731, 1217, 4288, 3269, 1732, 3270, 2759,
+	744, 1263, 1769, 2286, 2795, 2796, 1770, 2285, 752, 1271, 1777, 2294, 2803, 2804, 1778, 2293,
+	3798, 5329, 727, 1232, 3797, 5330, 5844, 5843, 3790, 5321, 719, 1224, 3789, 5322, 5836, 5835,
+	5798, 5797, 2721, 2722, 1703, 1188, 3744, 1187, 1214, 191, 1213, 3772, 3257, 5816, 3258, 3771,
+	5790, 5789, 2713, 2714, 1695, 1180, 3736, 1179, 1154, 1667, 1153, 4224, 3205, 1668, 3206, 2695,
+	680, 1199, 1705, 2222, 2731, 2732, 1706, 2221, 688, 1207, 1713, 2230, 2739, 2740, 1714, 2229,
+	3734, 5265, 663, 1168, 3733, 5266, 5780, 5779, 3726, 5257, 655, 1160, 3725, 5258, 5772, 5771,
+	704, 1223, 1729, 2246, 2755, 2756, 1730, 2245, 1736, 3275, 3791, 3276, 201, 202, 4302, 4301,
+	1242, 1755, 1241, 4312, 3293, 1756, 3294, 2783, 1744, 3283, 3799, 3284, 209, 210, 4310, 4309,
+	4348, 4347, 1789, 2298, 4863, 3320, 1790, 2297, 5878, 5877, 2801, 2802, 1783, 1268, 3824, 1267,
+	1250, 1763, 1249, 4320, 3301, 1764, 3302, 2791, 5870, 5869, 2793, 2794, 1775, 1260, 3816, 1259,
+	5734, 5733, 2657, 2658, 1639, 1124, 3680, 1123, 1150, 127, 1149, 3708, 3193, 5752, 3194, 3707,
+	5726, 5725, 2649, 2650, 1631, 1116, 3672, 1115, 1090, 1603, 1089, 4160, 3141, 1604, 3142, 2631,
+	616, 1135, 1641, 2158, 2667, 2668, 1642, 2157, 624, 1143, 1649, 2166, 2675, 2676, 1650, 2165,
+	3670, 5201, 599, 1104, 3669, 5202, 5716, 5715, 3662, 5193, 591, 1096, 3661, 5194, 5708, 5707,
+	2100, 565, 4151, 566, 2099, 4658, 2608, 4657, 1034, 1547, 1033, 4104, 3085, 1548, 3086, 2575,
+	1592, 3131, 3647, 3132, 57, 58, 4158, 4157, 4612, 2055, 4611, 5120, 5, 6, 4098, 4097,
+	2092, 557, 4143, 558, 2091, 4650, 2600, 4649, 1042, 1555, 1041, 4112, 3093, 1556, 3094, 2583,
+	4132, 4131, 1573, 2082, 4647, 3104, 1574, 2081, 4124, 4123, 1565, 2074, 4639, 3096, 1566, 2073,
+	4436, 4435, 1877, 2386, 4951, 3408, 1878, 2385, 4428, 4427, 1869, 2378, 4943, 3400, 1870, 2377,
+	3946, 5485, 363, 364, 3945, 5486, 4968, 3439, 3954, 5493, 371, 372, 3953, 5494, 4976, 3447,
+	1880, 3419, 3935, 3420, 345, 346, 4446, 4445, 1350, 327, 1349, 3908, 3393, 5952, 3394, 3907,
+	1888, 3427, 3943, 3428, 353, 354, 4454, 4453, 1402, 1915, 1401, 4472, 3453, 1916, 3454, 2943,
+	768, 1287, 1793, 2310, 2819, 2820, 1794, 2309, 1800, 3339, 3855, 3340, 265, 266, 4366, 4365,
+	1306, 1819, 1305, 4376, 3357, 1820, 3358, 2847, 1808, 3347, 3863, 3348, 273, 274, 4374, 4373,
+	4412, 4411, 1853, 2362, 4927, 3384, 1854, 2361, 5942, 5941, 2865, 2866, 1847, 1332, 3888, 1331,
+	1314, 1827, 1313, 4384, 3365, 1828, 3366, 2855, 5934, 5933, 2857, 2858, 1839, 1324, 3880, 1323,
+	4500, 4499, 1941, 2450, 5015, 3472, 1942, 2449, 4492, 4491, 1933, 2442, 5007, 3464, 1934, 2441,
+	4010, 5549, 427, 428, 4009, 5550, 5032, 3503, 4018, 5557, 435, 436, 4017, 5558, 5040, 3511,
+	1944, 3483, 3999, 3484, 409, 410, 4510, 4509, 1414, 391, 1413, 3972, 3457, 6016, 3458, 3971,
+	1952, 3491, 4007, 3492, 417, 418, 4518, 4517, 1466, 1979, 1465, 4536, 3517, 1980, 3518, 3007,
+	2516, 981, 4567, 982, 2515, 5074, 3024, 5073, 1514, 2027, 1513, 4584, 3565, 2028, 3566, 3055,
+	984, 1503, 2009, 2526, 3035, 3036, 2010, 2525, 992, 1511, 2017, 2534, 3043, 3044, 2018, 2533,
+	2508, 973, 4559, 974, 2507, 5066, 3016, 5065, 1522, 2035, 1521, 4592, 3573, 2036, 3574, 3063,
+	6086, 6085, 3009, 3010, 1991, 1476, 4032, 1475, 6138, 6137, 3069, 3070, 1019, 2552, 1020, 5631,
+	2356, 821, 4407, 822, 2355, 4914, 2864, 4913, 1290, 1803, 1289, 4360, 3341, 1804, 3342, 2831,
+	1848, 3387, 3903, 3388, 313, 314, 4414, 4413, 4868, 2311, 4867, 5376, 261, 262, 4354, 4353,
+	2348, 813, 4399, 814, 2347, 4906, 2856, 4905, 1298, 1811, 1297, 4368, 3349, 1812, 3350, 2839,
+	4388, 4387, 1829, 2338, 4903, 3360, 1830, 2337, 4380, 4379, 1821, 2330, 4895, 3352, 1822, 2329,
+	2292, 757, 4343, 758, 2291, 4850, 2800, 4849, 1226, 1739, 1225, 4296, 3277, 1740, 3278, 2767,
+	1784, 3323, 3839, 3324, 249, 250, 4350, 4349, 4804, 2247, 4803, 5312, 197, 198, 4290, 4289,
+	2284, 749, 4335, 750, 2283, 4842, 2792, 4841, 1234, 1747, 1233, 4304, 3285, 1748, 3286, 2775,
+	4324, 4323, 1765, 2274, 4839, 3296, 1766, 2273, 4316, 4315, 1757, 2266, 4831, 3288, 1758, 2265,
+	832, 1351, 1857, 2374, 2883, 2884, 1858, 2373, 1864, 3403, 3919, 3404, 329, 330, 4430, 4429,
+	1370, 1883, 1369, 4440, 3421, 1884, 3422, 2911, 1872, 3411, 3927, 3412, 337, 338, 4438, 4437,
+	4476, 4475, 1917, 2426, 4991, 3448, 1918, 2425, 6006, 6005, 2929, 2930, 1911, 1396, 3952, 1395,
+	1378, 1891, 1377, 4448, 3429, 1892, 3430, 2919, 5998, 5997, 2921, 2922, 1903, 1388, 3944, 1387,
+	4788, 2231, 4787, 5296, 181, 182, 4274, 4273, 696, 1215, 1721, 2238, 2747, 2748, 1722, 2237,
+	4780, 2223, 4779, 5288, 173, 174, 4266, 4265, 2212, 677, 4263, 678, 2211, 4770, 2720, 4769,
+	5770, 5769, 2701, 2702, 651, 2184, 652, 5263, 4228, 4227, 1669, 2178, 4743, 3200, 1670, 2177,
+	5778, 5777, 2709, 2710, 659, 2192, 660, 5271, 2204, 669, 4255, 670, 2203, 4762, 2712, 4761,
+	4596, 4595, 2037, 2546, 5111, 3568, 2038, 2545, 4588, 4587, 2029, 2538, 5103, 3560, 2030, 2537,
+	4042, 5581, 459, 460, 4041, 5582, 5064, 3535, 4050, 5589, 467, 468, 4049, 5590, 5072, 3543,
+	504, 1017, 5627, 1018, 6143, 5118, 5628, 5117, 5092, 2535, 5091, 5600, 485, 486, 4578, 4577,
+	2500, 965, 4551, 966, 2499, 5058, 3008, 5057, 5084, 2527, 5083, 5592, 477, 478, 4570, 4569,
+	4116, 4115, 1557, 2066, 4631, 3088, 1558, 2065, 4108, 4107, 1549, 2058, 4623, 3080, 1550, 2057,
+	3626, 5165, 43, 44, 3625, 5166, 4648, 3119, 3634, 5173, 51, 52, 3633, 5174, 4656, 3127,
+	1560, 3099, 3615, 3100, 25, 26, 4126, 4125, 1030, 7, 1029, 3588, 3073, 5632, 3074, 3587,
+	1568, 3107, 3623, 3108, 33, 34, 4134, 4133, 1082, 1595, 1081, 4152, 3133, 1596, 3134, 2623,
+	896, 1415, 1921, 2438, 2947, 2948, 1922, 2437, 1928, 3467, 3983, 3468, 393, 394, 4494, 4493,
+	1434, 1947, 1433, 4504, 3485, 1948, 3486, 2975, 1936, 3475, 3991, 3476, 401, 402, 4502, 4501,
+	4540, 4539, 1981, 2490, 5055, 3512, 1982, 2489, 6070, 6069, 2993, 2994, 1975, 1460, 4016, 1459,
+	1442, 1955, 1441, 4512, 3493, 1956, 3494, 2983, 6062, 6061, 2985, 2986, 1967, 1452, 4008, 1451,
+	4724, 2167, 4723, 5232, 117, 118, 4210, 4209, 632, 1151, 1657, 2174, 2683, 2684, 1658, 2173,
+	4716, 2159, 4715, 5224, 109, 110, 4202, 4201, 2148, 613, 4199, 614, 2147, 4706, 2656, 4705,
+	5706, 5705, 2637, 2638, 587, 2120, 588, 5199, 4164, 4163, 1605, 2114, 4679, 3136, 1606, 2113,
+	5714, 5713, 2645, 2646, 595, 2128, 596, 5207, 2140, 605, 4191, 606, 2139, 4698, 2648, 4697
+	};
+
+	// LUT for Hilbert3D Hilbert -> Morton (3 levels)
+	static const uint16_t Hilbert3D_to_morton_512[6144] = {
+	0, 513, 515, 5122, 5126, 4615, 4613, 5636, 544, 1570, 1574, 2596, 2597, 2087, 2083, 1057,
+	552, 1578, 1582, 2604, 2605, 2095, 2091, 1065, 2061, 5641, 5640, 524, 526, 2570, 2571, 5135,
+	2077, 5657, 5656, 540, 542, 2586, 2587, 5151, 1083, 5177, 5181, 5695, 5694, 3644, 3640, 570,
+	1075, 5169, 5173, 5687, 5686, 3636, 3632, 562, 2582, 4631, 4629, 2068, 2064, 529, 531, 4114,
+	640, 1666, 1670, 2692, 2693, 2183, 2179, 1153, 1672, 140, 141, 3209, 3211, 4239, 4238, 3722,
+	1688, 156, 157, 3225, 3227, 4255, 4254, 3738, 4243, 1170, 1168, 1681, 1685, 3220, 3222, 2711,
+	4275, 1202, 1200, 1713, 1717, 3252, 3254, 2743, 3774, 2746, 2747, 1215, 1213, 5817, 5816, 1724,
+	3758, 2730, 2731, 1199, 1197, 5801, 5800, 1708, 3237, 2215, 2211, 4257, 4256, 1698, 1702, 4772,
+	896, 1922, 1926, 2948, 2949, 2439, 2435, 1409, 1928, 396, 397, 3465, 3467, 4495, 4494, 3978,
+	1944, 412, 413, 3481, 3483, 4511, 4510, 3994, 4499, 1426, 1424, 1937, 1941, 3476, 3478, 2967,
+	4531, 1458, 1456, 1969, 1973, 3508, 3510, 2999, 4030, 3002, 3003, 1471, 1469, 6073, 6072, 1980,
+	4014, 2986, 2987, 1455, 1453, 6057, 6056, 1964, 3493, 2471, 2467, 4513, 4512, 1954, 1958, 5028,
+	3894, 2866, 2867, 1335, 1333, 5937, 5936, 1844, 2854, 4903, 4901, 2340, 2336, 801, 803, 4386,
+	2822, 4871, 4869, 2308, 2304, 769, 771, 4354, 784, 1810, 1814, 2836, 2837, 2327, 2323, 1297,
+	792, 1818, 1822, 2844, 2845, 2335, 2331, 1305, 4363, 1290, 1288, 1801, 1805, 3340, 3342, 2831,
+	4395, 1322, 1320, 1833, 1837, 3372, 3374, 2863, 2365, 5945, 5944, 828, 830, 2874, 2875, 5439,
+	3958, 2930, 2931, 1399, 1397, 6001, 6000, 1908, 2918, 4967, 4965, 2404, 2400, 865, 867, 4450,
+	2886, 4935, 4933, 2372, 2368, 833, 835, 4418, 848, 1874, 1878, 2900, 2901, 2391, 2387, 1361,
+	856, 1882, 1886, 2908, 2909, 2399, 2395, 1369, 4427, 1354, 1352, 1865, 1869, 3404, 3406, 2895,
+	4459, 1386, 1384, 1897, 1901, 3436, 3438, 2927, 2429, 6009, 6008, 892, 894, 2938, 2939, 5503,
+	3565, 2543, 2539, 4585, 4584, 2026, 2030, 5100, 2533, 6113, 6112, 996, 998, 3042, 3043, 5607,
+	2549, 6129, 6128, 1012, 1014, 3058, 3059, 5623, 3070, 5119, 5117, 2556, 2552, 1017, 1019, 4602,
+	3038, 5087, 5085, 2524, 2520, 985, 987, 4570, 5587, 4567, 4566, 5074, 5072, 468, 469, 2513,
+	5571, 4551, 4550, 5058, 5056, 452, 453, 2497, 968, 1994, 1998, 3020, 3021, 2511, 2507, 1481,
+	3309, 2287, 2283, 4329, 4328, 1770, 1774, 4844, 2277, 5857, 5856, 740, 742, 2786, 2787, 5351,
+	2293, 5873, 5872, 756, 758, 2802, 2803, 5367, 2814, 4863, 4861, 2300, 2296, 761, 763, 4346,
+	2782, 4831, 4829, 2268, 2264, 729, 731, 4314, 5331, 4311, 4310, 4818, 4816, 212, 213, 2257,
+	5315, 4295, 4294, 4802, 4800, 196, 197, 2241, 712, 1738, 1742, 2764, 2765, 2255, 2251, 1225,
+	4187, 1114, 1112, 1625, 1629, 3164, 3166, 2655, 1147, 5241, 5245, 5759, 5758, 3708, 3704, 634,
+	1139, 5233, 5237, 5751, 5750, 3700, 3696, 626, 3670, 2642, 2643, 1111, 1109, 5713, 5712, 1620,
+	3654, 2626, 2627, 1095, 1093, 5697, 5696, 1604, 608, 1634, 1638, 2660, 2661, 2151, 2147, 1121,
+	616, 1642, 1646, 2668, 2669, 2159, 2155, 1129, 5709, 3148, 3150, 3663, 3659, 1098, 1096, 73,
+	512, 1538, 1542, 2564, 2565, 2055, 2051, 1025, 1544, 12, 13, 3081, 3083, 4111, 4110, 3594,
+	1560, 28, 29, 3097, 3099, 4127, 4126, 3610, 4115, 1042, 1040, 1553, 1557, 3092, 3094, 2583,
+	4147, 1074, 1072, 1585, 1589, 3124, 3126, 2615, 3646, 2618, 2619, 1087, 1085, 5689, 5688, 1596,
+	3630, 2602, 2603, 1071, 1069, 5673, 5672, 1580, 3109, 2087, 2083, 4129, 4128, 1570, 1574, 4644,
+	1792, 260, 261, 3329, 3331, 4359, 4358, 3842, 272, 785, 787, 5394, 5398, 4887, 4885, 5908,
+	304, 817, 819, 5426, 5430, 4919, 4917, 5940, 4902, 3876, 3872, 290, 291, 5409, 5413, 3367,
+	4910, 3884, 3880, 298, 299, 5417, 5421, 3375, 5949, 3388, 3390, 3903, 3899, 1338, 1336, 313,
+	5917, 3356, 3358, 3871, 3867, 1306, 1304, 281, 5387, 4367, 4366, 4874, 4872, 268, 269, 2313,
+	1856, 324, 325, 3393, 3395, 4423, 4422, 3906, 336, 849, 851, 5458, 5462, 4951, 4949, 5972,
+	368, 881, 883, 5490, 5494, 4983, 4981, 6004, 4966, 3940, 3936, 354, 355, 5473, 5477, 3431,
+	4974, 3948, 3944, 362, 363, 5481, 5485, 3439, 6013, 3452, 3454, 3967, 3963, 1402, 1400, 377,
+	5981, 3420, 3422, 3935, 3931, 1370, 1368, 345, 5451, 4431, 4430, 4938, 4936, 332, 333, 2377,
+	5741, 3180, 3182, 3695, 3691, 1130, 1128, 105, 3149, 2127, 2123, 4169, 4168, 1610, 1614, 4684,
+	3141, 2119, 2115, 4161, 4160, 1602, 1606, 4676, 1632, 100, 101, 3169, 3171, 4199, 4198, 3682,
+	1648, 116, 117, 3185, 3187, 4215, 4214, 3698, 4694, 3668, 3664, 82, 83, 5201, 5205, 3159,
+	4702, 3676, 3672, 90, 91, 5209, 5213, 3167, 4219, 1146, 1144, 1657, 1661, 3196, 3198, 2687,
+	5869, 3308, 3310, 3823, 3819, 1258, 1256, 233, 3277, 2255, 2251, 4297, 4296, 1738, 1742, 4812,
+	3269, 2247, 2243, 4289, 4288, 1730, 1734, 4804, 1760, 228, 229, 3297, 3299, 4327, 4326, 3810,
+	1776, 244, 245, 3313, 3315, 4343, 4342, 3826, 4822, 3796, 3792, 210, 211, 5329, 5333, 3287,
+	4830, 3804, 3800, 218, 219, 5337, 5341, 3295, 4347, 1274, 1272, 1785, 1789, 3324, 3326, 2815,
+	5595, 4575, 4574, 5082, 5080, 476, 477, 2521, 4555, 1482, 1480, 1993, 1997, 3532, 3534, 3023,
+	4587, 1514, 1512, 2025, 2029, 3564, 3566, 3055, 3581, 2559, 2555, 4601, 4600, 2042, 2046, 5116,
+	3573, 2551, 2547, 4593, 4592, 2034, 2038, 5108, 3046, 5095, 5093, 2532, 2528, 993, 995, 4578,
+	3014, 5063, 5061, 2500, 2496, 961, 963, 4546, 2000, 468, 469, 3537, 3539, 4567, 4566, 4050,
+	5531, 4511, 4510, 5018, 5016, 412, 413, 2457, 4491, 1418, 1416, 1929, 1933, 3468, 3470, 2959,
+	4523, 1450, 1448, 1961, 1965, 3500, 3502, 2991, 3517, 2495, 2491, 4537, 4536, 1978, 1982, 5052,
+	3509, 2487, 2483, 4529, 4528, 1970, 1974, 5044, 2982, 5031, 5029, 2468, 2464, 929, 931, 4514,
+	2950, 4999, 4997, 2436, 2432, 897, 899, 4482, 1936, 404, 405, 3473, 3475, 4503, 4502, 3986,
+	4790, 3764, 3760, 178, 179, 5297, 5301, 3255, 3774, 2746, 2747, 1215, 1213, 5817, 5816, 1724,
+	3758, 2730, 2731, 1199, 1197, 5801, 5800, 1708, 5797, 3236, 3238, 3751, 3747, 1186, 1184, 161,
+	5765, 3204, 3206, 3719, 3715, 1154, 1152, 129, 1672, 140, 141, 3209, 3211, 4239, 4238, 3722,
+	1688, 156, 157, 3225, 3227, 4255, 4254, 3738, 1171, 5265, 5269, 5783, 5782, 3732, 3728, 658,
+	1243, 5337, 5341, 5855, 5854, 3804, 3800, 730, 5331, 4311, 4310, 4818, 4816, 212, 213, 2257,
+	5315, 4295, 4294, 4802, 4800, 196, 197, 2241, 200, 713, 715, 5322, 5326, 4815, 4813, 5836,
+	232, 745, 747, 5354, 5358, 4847, 4845, 5868, 2277, 5857, 5856, 740, 742, 2786, 2787, 5351,
+	2293, 5873, 5872, 756, 758, 2802, 2803, 5367, 4862, 3836, 3832, 250, 251, 5369, 5373, 3327,
+	5595, 4575, 4574, 5082, 5080, 476, 477, 2521, 4555, 1482, 1480, 1993, 1997, 3532, 3534, 3023,
+	4587, 1514, 1512, 2025, 2029, 3564, 3566, 3055, 3581, 2559, 2555, 4601, 4600, 2042, 2046, 5116,
+	3573, 2551, 2547, 4593, 4592, 2034, 2038, 5108, 3046, 5095, 5093, 2532, 2528, 993, 995, 4578,
+	3014, 5063, 5061, 2500, 2496, 961, 963, 4546, 2000, 468, 469, 3537, 3539, 4567, 4566, 4050,
+	5531, 4511, 4510, 5018, 5016, 412, 413, 2457, 4491, 1418, 1416, 1929, 1933, 3468, 3470, 2959,
+	4523, 1450, 1448, 1961, 1965, 3500, 3502, 2991, 3517, 2495, 2491, 4537, 4536, 1978, 1982, 5052,
+	3509, 2487, 2483, 4529, 4528, 1970, 1974, 5044, 2982, 5031, 5029, 2468, 2464, 929, 931, 4514,
+	2950, 4999, 4997, 2436, 2432, 897, 899, 4482, 1936, 404, 405, 3473, 3475, 4503, 4502, 3986,
+	2742, 4791, 4789, 2228, 2224, 689, 691, 4274, 4758, 3732, 3728, 146, 147, 5265, 5269, 3223,
+	4766, 3740, 3736, 154, 155, 5273, 5277, 3231, 5307, 4287, 4286, 4794, 4792, 188, 189, 2233,
+	5291, 4271, 4270, 4778, 4776, 172, 173, 2217, 3213, 2191, 2187, 4233, 4232, 1674, 1678, 4748,
+	3205, 2183, 2179, 4225, 4224, 1666, 1670, 4740, 160, 673, 675, 5282, 5286, 4775, 4773, 5796,
+	2614, 4663, 4661, 2100, 2096, 561, 563, 4146, 4630, 3604, 3600, 18, 19, 5137, 5141, 3095,
+	4638, 3612, 3608, 26, 27, 5145, 5149, 3103, 5179, 4159, 4158, 4666, 4664, 60, 61, 2105,
+	5163, 4143, 4142, 4650, 4648, 44, 45, 2089, 3085, 2063, 2059, 4105, 4104, 1546, 1550, 4620,
+	3077, 2055, 2051, 4097, 4096, 1538, 1542, 4612, 32, 545, 547, 5154, 5158, 4647, 4645, 5668,
+	1792, 260, 261, 3329, 3331, 4359, 4358, 3842, 272, 785, 787, 5394, 5398, 4887, 4885, 5908,
+	304, 817, 819, 5426, 5430, 4919, 4917, 5940, 4902, 3876, 3872, 290, 291, 5409, 5413, 3367,
+	4910, 3884, 3880, 298, 299, 5417, 5421, 3375, 5949, 3388, 3390, 3903, 3899, 1338, 1336, 313,
+	5917, 3356, 3358, 3871, 3867, 1306, 1304, 281, 5387, 4367, 4366, 4874, 4872, 268, 269, 2313,
+	1856, 324, 325, 3393, 3395, 4423, 4422, 3906, 336, 849, 851, 5458, 5462, 4951, 4949, 5972,
+	368, 881, 883, 5490, 5494, 4983, 4981, 6004, 4966, 3940, 3936, 354, 355, 5473, 5477, 3431,
+	4974, 3948, 3944, 362, 363, 5481, 5485, 3439, 6013, 3452, 3454, 3967, 3963, 1402, 1400, 377,
+	5981, 3420, 3422, 3935, 3931, 1370, 1368, 345, 5451, 4431, 4430, 4938, 4936, 332, 333, 2377,
+	3181, 2159, 2155, 4201, 4200, 1642, 1646, 4716, 2149, 5729, 5728, 612, 614, 2658, 2659, 5223,
+	2165, 5745, 5744, 628, 630, 2674, 2675, 5239, 2686, 4735, 4733, 2172, 2168, 633, 635, 4218,
+	2654, 4703, 4701, 2140, 2136, 601, 603, 4186, 5203, 4183, 4182, 4690, 4688, 84, 85, 2129,
+	5187, 4167, 4166, 4674, 4672, 68, 69, 2113, 584, 1610, 1614, 2636, 2637, 2127, 2123, 1097,
+	1536, 4, 5, 3073, 3075, 4103, 4102, 3586, 16, 529, 531, 5138, 5142, 4631, 4629, 5652,
+	48, 561, 563, 5170, 5174, 4663, 4661, 5684, 4646, 3620, 3616, 34, 35, 5153, 5157, 3111,
+	4654, 3628, 3624, 42, 43, 5161, 5165, 3119, 5693, 3132, 3134, 3647, 3643, 1082, 1080, 57,
+	5661, 3100, 3102, 3615, 3611, 1050, 1048, 25, 5131, 4111, 4110, 4618, 4616, 12, 13, 2057,
+	64, 577, 579, 5186, 5190, 4679, 4677, 5700, 608, 1634, 1638, 2660, 2661, 2151, 2147, 1121,
+	616, 1642, 1646, 2668, 2669, 2159, 2155, 1129, 2125, 5705, 5704, 588, 590, 2634, 2635, 5199,
+	2141, 5721, 5720, 604, 606, 2650, 2651, 5215, 1147, 5241, 5245, 5759, 5758, 3708, 3704, 634,
+	1139, 5233, 5237, 5751, 5750, 3700, 3696, 626, 2646, 4695, 4693, 2132, 2128, 593, 595, 4178,
+	192, 705, 707, 5314, 5318, 4807, 4805, 5828, 736, 1762, 1766, 2788, 2789, 2279, 2275, 1249,
+	744, 1770, 1774, 2796, 2797, 2287, 2283, 1257, 2253, 5833, 5832, 716, 718, 2762, 2763, 5327,
+	2269, 5849, 5848, 732, 734, 2778, 2779, 5343, 1275, 5369, 5373, 5887, 5886, 3836, 3832, 762,
+	1267, 5361, 5365, 5879, 5878, 3828, 3824, 754, 2774, 4823, 4821, 2260, 2256, 721, 723, 4306,
+	1179, 5273, 5277, 5791, 5790, 3740, 3736, 666, 5267, 4247, 4246, 4754, 4752, 148, 149, 2193,
+	5251, 4231, 4230, 4738, 4736, 132, 133, 2177, 136, 649, 651, 5258, 5262, 4751, 4749, 5772,
+	168, 681, 683, 5290, 5294, 4783, 4781, 5804, 2213, 5793, 5792, 676, 678, 2722, 2723, 5287,
+	2229, 5809, 5808, 692, 694, 2738, 2739, 5303, 4798, 3772, 3768, 186, 187, 5305, 5309, 3263,
+	1435, 5529, 5533, 6047, 6046, 3996, 3992, 922, 5523, 4503, 4502, 5010, 5008, 404, 405, 2449,
+	5507, 4487, 4486, 4994, 4992, 388, 389, 2433, 392, 905, 907, 5514, 5518, 5007, 5005, 6028,
+	424, 937, 939, 5546, 5550, 5039, 5037, 6060, 2469, 6049, 6048, 932, 934, 2978, 2979, 5543,
+	2485, 6065, 6064, 948, 950, 2994, 2995, 5559, 5054, 4028, 4024, 442, 443, 5561, 5565, 3519,
+	3062, 5111, 5109, 2548, 2544, 1009, 1011, 4594, 5078, 4052, 4048, 466, 467, 5585, 5589, 3543,
+	5086, 4060, 4056, 474, 475, 5593, 5597, 3551, 5627, 4607, 4606, 5114, 5112, 508, 509, 2553,
+	5611, 4591, 4590, 5098, 5096, 492, 493, 2537, 3533, 2511, 2507, 4553, 4552, 1994, 1998, 5068,
+	3525, 2503, 2499, 4545, 4544, 1986, 1990, 5060, 480, 993, 995, 5602, 5606, 5095, 5093, 6116,
+	2934, 4983, 4981, 2420, 2416, 881, 883, 4466, 4950, 3924, 3920, 338, 339, 5457, 5461, 3415,
+	4958, 3932, 3928, 346, 347, 5465, 5469, 3423, 5499, 4479, 4478, 4986, 4984, 380, 381, 2425,
+	5483, 4463, 4462, 4970, 4968, 364, 365, 2409, 3405, 2383, 2379, 4425, 4424, 1866, 1870, 4940,
+	3397, 2375, 2371, 4417, 4416, 1858, 1862, 4932, 352, 865, 867, 5474, 5478, 4967, 4965, 5988,
+	2349, 5929, 5928, 812, 814, 2858, 2859, 5423, 5949, 3388, 3390, 3903, 3899, 1338, 1336, 313,
+	5917, 3356, 3358, 3871, 3867, 1306, 1304, 281, 1291, 5385, 5389, 5903, 5902, 3852, 3848, 778,
+	1283, 5377, 5381, 5895, 5894, 3844, 3840, 770, 272, 785, 787, 5394, 5398, 4887, 4885, 5908,
+	304, 817, 819, 5426, 5430, 4919, 4917, 5940, 3878, 2850, 2851, 1319, 1317, 5921, 5920, 1828,
+	2413, 5993, 5992, 876, 878, 2922, 2923, 5487, 6013, 3452, 3454, 3967, 3963, 1402, 1400, 377,
+	5981, 3420, 3422, 3935, 3931, 1370, 1368, 345, 1355, 5449, 5453, 5967, 5966, 3916, 3912, 842,
+	1347, 5441, 5445, 5959, 5958, 3908, 3904, 834, 336, 849, 851, 5458, 5462, 4951, 4949, 5972,
+	368, 881, 883, 5490, 5494, 4983, 4981, 6004, 3942, 2914, 2915, 1383, 1381, 5985, 5984, 1892,
+	5933, 3372, 3374, 3887, 3883, 1322, 1320, 297, 3341, 2319, 2315, 4361, 4360, 1802, 1806, 4876,
+	3333, 2311, 2307, 4353, 4352, 1794, 1798, 4868, 1824, 292, 293, 3361, 3363, 4391, 4390, 3874,
+	1840, 308, 309, 3377, 3379, 4407, 4406, 3890, 4886, 3860, 3856, 274, 275, 5393, 5397, 3351,
+	4894, 3868, 3864, 282, 283, 5401, 5405, 3359, 4411, 1338, 1336, 1849, 1853, 3388, 3390, 2879,
+	6061, 3500, 3502, 4015, 4011, 1450, 1448, 425, 3469, 2447, 2443, 4489, 4488, 1930, 1934, 5004,
+	3461, 2439, 2435, 4481, 4480, 1922, 1926, 4996, 1952, 420, 421, 3489, 3491, 4519, 4518, 4002,
+	1968, 436, 437, 3505, 3507, 4535, 4534, 4018, 5014, 3988, 3984, 402, 403, 5521, 5525, 3479,
+	5022, 3996, 3992, 410, 411, 5529, 5533, 3487, 4539, 1466, 1464, 1977, 1981, 3516, 3518, 3007,
+	5110, 4084, 4080, 498, 499, 5617, 5621, 3575, 4094, 3066, 3067, 1535, 1533, 6137, 6136, 2044,
+	4078, 3050, 3051, 1519, 1517, 6121, 6120, 2028, 6117, 3556, 3558, 4071, 4067, 1506, 1504, 481,
+	6085, 3524, 3526, 4039, 4035, 1474, 1472, 449, 1992, 460, 461, 3529, 3531, 4559, 4558, 4042,
+	2008, 476, 477, 3545, 3547, 4575, 4574, 4058, 1491, 5585, 5589, 6103, 6102, 4052, 4048, 978,
+	4854, 3828, 3824, 242, 243, 5361, 5365, 3319, 3838, 2810, 2811, 1279, 1277, 5881, 5880, 1788,
+	3822, 2794, 2795, 1263, 1261, 5865, 5864, 1772, 5861, 3300, 3302, 3815, 3811, 1250, 1248, 225,
+	5829, 3268, 3270, 3783, 3779, 1218, 1216, 193, 1736, 204, 205, 3273, 3275, 4303, 4302, 3786,
+	1752, 220, 221, 3289, 3291, 4319, 4318, 3802, 1235, 5329, 5333, 5847, 5846, 3796, 3792, 722,
+	4251, 1178, 1176, 1689, 1693, 3228, 3230, 2719, 1211, 5305, 5309, 5823, 5822, 3772, 3768, 698,
+	1203, 5297, 5301, 5815, 5814, 3764, 3760, 690, 3734, 2706, 2707, 1175, 1173, 5777, 5776, 1684,
+	3718, 2690, 2691, 1159, 1157, 5761, 5760, 1668, 672, 1698, 1702, 2724, 2725, 2215, 2211, 1185,
+	680, 1706, 1710, 2732, 2733, 2223, 2219, 1193, 5773, 3212, 3214, 3727, 3723, 1162, 1160, 137,
+	4123, 1050, 1048, 1561, 1565, 3100, 3102, 2591, 1083, 5177, 5181, 5695, 5694, 3644, 3640, 570,
+	1075, 5169, 5173, 5687, 5686, 3636, 3632, 562, 3606, 2578, 2579, 1047, 1045, 5649, 5648, 1556,
+	3590, 2562, 2563, 1031, 1029, 5633, 5632, 1540, 544, 1570, 1574, 2596, 2597, 2087, 2083, 1057,
+	552, 1578, 1582, 2604, 2605, 2095, 2091, 1065, 5645, 3084, 3086, 3599, 3595, 1034, 1032, 9,
+	1600, 68, 69, 3137, 3139, 4167, 4166, 3650, 80, 593, 595, 5202, 5206, 4695, 4693, 5716,
+	112, 625, 627, 5234, 5238, 4727, 4725, 5748, 4710, 3684, 3680, 98, 99, 5217, 5221, 3175,
+	4718, 3692, 3688, 106, 107, 5225, 5229, 3183, 5757, 3196, 3198, 3711, 3707, 1146, 1144, 121,
+	5725, 3164, 3166, 3679, 3675, 1114, 1112, 89, 5195, 4175, 4174, 4682, 4680, 76, 77, 2121,
+	2998, 5047, 5045, 2484, 2480, 945, 947, 4530, 5014, 3988, 3984, 402, 403, 5521, 5525, 3479,
+	5022, 3996, 3992, 410, 411, 5529, 5533, 3487, 5563, 4543, 4542, 5050, 5048, 444, 445, 2489,
+	5547, 4527, 4526, 5034, 5032, 428, 429, 2473, 3469, 2447, 2443, 4489, 4488, 1930, 1934, 5004,
+	3461, 2439, 2435, 4481, 4480, 1922, 1926, 4996, 416, 929, 931, 5538, 5542, 5031, 5029, 6052,
+	4918, 3892, 3888, 306, 307, 5425, 5429, 3383, 3902, 2874, 2875, 1343, 1341, 5945, 5944, 1852,
+	3886, 2858, 2859, 1327, 1325, 5929, 5928, 1836, 5925, 3364, 3366, 3879, 3875, 1314, 1312, 289,
+	5893, 3332, 3334, 3847, 3843, 1282, 1280, 257, 1800, 268, 269, 3337, 3339, 4367, 4366, 3850,
+	1816, 284, 285, 3353, 3355, 4383, 4382, 3866, 1299, 5393, 5397, 5911, 5910, 3860, 3856, 786,
+	4662, 3636, 3632, 50, 51, 5169, 5173, 3127, 3646, 2618, 2619, 1087, 1085, 5689, 5688, 1596,
+	3630, 2602, 2603, 1071, 1069, 5673, 5672, 1580, 5669, 3108, 3110, 3623, 3619, 1058, 1056, 33,
+	5637, 3076, 3078, 3591, 3587, 1026, 1024, 1, 1544, 12, 13, 3081, 3083, 4111, 4110, 3594,
+	1560, 28, 29, 3097, 3099, 4127, 4126, 3610, 1043, 5137, 5141, 5655, 5654, 3604, 3600, 530,
+	1664, 132, 133, 3201, 3203, 4231, 4230, 3714, 144, 657, 659, 5266, 5270, 4759, 4757, 5780,
+	176, 689, 691, 5298, 5302, 4791, 4789, 5812, 4774, 3748, 3744, 162, 163, 5281, 5285, 3239,
+	4782, 3756, 3752, 170, 171, 5289, 5293, 3247, 5821, 3260, 3262, 3775, 3771, 1210, 1208, 185,
+	5789, 3228, 3230, 3743, 3739, 1178, 1176, 153, 5259, 4239, 4238, 4746, 4744, 140, 141, 2185,
+	1728, 196, 197, 3265, 3267, 4295, 4294, 3778, 208, 721, 723, 5330, 5334, 4823, 4821, 5844,
+	240, 753, 755, 5362, 5366, 4855, 4853, 5876, 4838, 3812, 3808, 226, 227, 5345, 5349, 3303,
+	4846, 3820, 3816, 234, 235, 5353, 5357, 3311, 5885, 3324, 3326, 3839, 3835, 1274, 1272, 249,
+	5853, 3292, 3294, 3807, 3803, 1242, 1240, 217, 5323, 4303, 4302, 4810, 4808, 204, 205, 2249,
+	1115, 5209, 5213, 5727, 5726, 3676, 3672, 602, 5203, 4183, 4182, 4690, 4688, 84, 85, 2129,
+	5187, 4167, 4166, 4674, 4672, 68, 69, 2113, 72, 585, 587, 5194, 5198, 4687, 4685, 5708,
+	104, 617, 619, 5226, 5230, 4719, 4717, 5740, 2149, 5729, 5728, 612, 614, 2658, 2659, 5223,
+	2165, 5745, 5744, 628, 630, 2674, 2675, 5239, 4734, 3708, 3704, 122, 123, 5241, 5245, 3199,
+	1371, 5465, 5469, 5983, 5982, 3932, 3928, 858, 5459, 4439, 4438, 4946, 4944, 340, 341, 2385,
+	5443, 4423, 4422, 4930, 4928, 324, 325, 2369, 328, 841, 843, 5450, 5454, 4943, 4941, 5964,
+	360, 873, 875, 5482, 5486, 4975, 4973, 5996, 2405, 5985, 5984, 868, 870, 2914, 2915, 5479,
+	2421, 6001, 6000, 884, 886, 2930, 2931, 5495, 4990, 3964, 3960, 378, 379, 5497, 5501, 3455,
+	6125, 3564, 3566, 4079, 4075, 1514, 1512, 489, 3533, 2511, 2507, 4553, 4552, 1994, 1998, 5068,
+	3525, 2503, 2499, 4545, 4544, 1986, 1990, 5060, 2016, 484, 485, 3553, 3555, 4583, 4582, 4066,
+	2032, 500, 501, 3569, 3571, 4599, 4598, 4082, 5078, 4052, 4048, 466, 467, 5585, 5589, 3543,
+	5086, 4060, 4056, 474, 475, 5593, 5597, 3551, 4603, 1530, 1528, 2041, 2045, 3580, 3582, 3071,
+	3437, 2415, 2411, 4457, 4456, 1898, 1902, 4972, 2405, 5985, 5984, 868, 870, 2914, 2915, 5479,
+	2421, 6001, 6000, 884, 886, 2930, 2931, 5495, 2942, 4991, 4989, 2428, 2424, 889, 891, 4474,
+	2910, 4959, 4957, 2396, 2392, 857, 859, 4442, 5459, 4439, 4438, 4946, 4944, 340, 341, 2385,
+	5443, 4423, 4422, 4930, 4928, 324, 325, 2369, 840, 1866, 1870, 2892, 2893, 2383, 2379, 1353,
+	2157, 5737, 5736, 620, 622, 2666, 2667, 5231, 5757, 3196, 3198, 3711, 3707, 1146, 1144, 121,
+	5725, 3164, 3166, 3679, 3675, 1114, 1112, 89, 1099, 5193, 5197, 5711, 5710, 3660, 3656, 586,
+	1091, 5185, 5189, 5703, 5702, 3652, 3648, 578, 80, 593, 595, 5202, 5206, 4695, 4693, 5716,
+	112, 625, 627, 5234, 5238, 4727, 4725, 5748, 3686, 2658, 2659, 1127, 1125, 5729, 5728, 1636,
+	2093, 5673, 5672, 556, 558, 2602, 2603, 5167, 5693, 3132, 3134, 3647, 3643, 1082, 1080, 57,
+	5661, 3100, 3102, 3615, 3611, 1050, 1048, 25, 1035, 5129, 5133, 5647, 5646, 3596, 3592, 522,
+	1027, 5121, 5125, 5639, 5638, 3588, 3584, 514, 16, 529, 531, 5138, 5142, 4631, 4629, 5652,
+	48, 561, 563, 5170, 5174, 4663, 4661, 5684, 3622, 2594, 2595, 1063, 1061, 5665, 5664, 1572,
+	256, 769, 771, 5378, 5382, 4871, 4869, 5892, 800, 1826, 1830, 2852, 2853, 2343, 2339, 1313,
+	808, 1834, 1838, 2860, 2861, 2351, 2347, 1321, 2317, 5897, 5896, 780, 782, 2826, 2827, 5391,
+	2333, 5913, 5912, 796, 798, 2842, 2843, 5407, 1339, 5433, 5437, 5951, 5950, 3900, 3896, 826,
+	1331, 5425, 5429, 5943, 5942, 3892, 3888, 818, 2838, 4887, 4885, 2324, 2320, 785, 787, 4370,
+	384, 897, 899, 5506, 5510, 4999, 4997, 6020, 928, 1954, 1958, 2980, 2981, 2471, 2467, 1441,
+	936, 1962, 1966, 2988, 2989, 2479, 2475, 1449, 2445, 6025, 6024, 908, 910, 2954, 2955, 5519,
+	2461, 6041, 6040, 924, 926, 2970, 2971, 5535, 1467, 5561, 5565, 6079, 6078, 4028, 4024, 954,
+	1459, 5553, 5557, 6071, 6070, 4020, 4016, 946, 2966, 5015, 5013, 2452, 2448, 913, 915, 4498,
+	3766, 2738, 2739, 1207, 1205, 5809, 5808, 1716, 2726, 4775, 4773, 2212, 2208, 673, 675, 4258,
+	2694, 4743, 4741, 2180, 2176, 641, 643, 4226, 656, 1682, 1686, 2708, 2709, 2199, 2195, 1169,
+	664, 1690, 1694, 2716, 2717, 2207, 2203, 1177, 4235, 1162, 1160, 1673, 1677, 3212, 3214, 2703,
+	4267, 1194, 1192, 1705, 1709, 3244, 3246, 2735, 2237, 5817, 5816, 700, 702, 2746, 2747, 5311,
+	3830, 2802, 2803, 1271, 1269, 5873, 5872, 1780, 2790, 4839, 4837, 2276, 2272, 737, 739, 4322,
+	2758, 4807, 4805, 2244, 2240, 705, 707, 4290, 720, 1746, 1750, 2772, 2773, 2263, 2259, 1233,
+	728, 1754, 1758, 2780, 2781, 2271, 2267, 1241, 4299, 1226, 1224, 1737, 1741, 3276, 3278, 2767,
+	4331, 1258, 1256, 1769, 1773, 3308, 3310, 2799, 2301, 5881, 5880, 764, 766, 2810, 2811, 5375,
+	1499, 5593, 5597, 6111, 6110, 4060, 4056, 986, 5587, 4567, 4566, 5074, 5072, 468, 469, 2513,
+	5571, 4551, 4550, 5058, 5056, 452, 453, 2497, 456, 969, 971, 5578, 5582, 5071, 5069, 6092,
+	488, 1001, 1003, 5610, 5614, 5103, 5101, 6124, 2533, 6113, 6112, 996, 998, 3042, 3043, 5607,
+	2549, 6129, 6128, 1012, 1014, 3058, 3059, 5623, 5118, 4092, 4088, 506, 507, 5625, 5629, 3583,
+	4022, 2994, 2995, 1463, 1461, 6065, 6064, 1972, 2982, 5031, 5029, 2468, 2464, 929, 931, 4514,
+	2950, 4999, 4997, 2436, 2432, 897, 899, 4482, 912, 1938, 1942, 2964, 2965, 2455, 2451, 1425,
+	920, 1946, 1950, 2972, 2973, 2463, 2459, 1433, 4491, 1418, 1416, 1929, 1933, 3468, 3470, 2959,
+	4523, 1450, 1448, 1961, 1965, 3500, 3502, 2991, 2493, 6073, 6072, 956, 958, 3002, 3003, 5567,
+	3062, 5111, 5109, 2548, 2544, 1009, 1011, 4594, 5078, 4052, 4048, 466, 467, 5585, 5589, 3543,
+	5086, 4060, 4056, 474, 475, 5593, 5597, 3551, 5627, 4607, 4606, 5114, 5112, 508, 509, 2553,
+	5611, 4591, 4590, 5098, 5096, 492, 493, 2537, 3533, 2511, 2507, 4553, 4552, 1994, 1998, 5068,
+	3525, 2503, 2499, 4545, 4544, 1986, 1990, 5060, 480, 993, 995, 5602, 5606, 5095, 5093, 6116,
+	2934, 4983, 4981, 2420, 2416, 881, 883, 4466, 4950, 3924, 3920, 338, 339, 5457, 5461, 3415,
+	4958, 3932, 3928, 346, 347, 5465, 5469, 3423, 5499, 4479, 4478, 4986, 4984, 380, 381, 2425,
+	5483, 4463, 4462, 4970, 4968, 364, 365, 2409, 3405, 2383, 2379, 4425, 4424, 1866, 1870, 4940,
+	3397, 2375, 2371, 4417, 4416, 1858, 1862, 4932, 352, 865, 867, 5474, 5478, 4967, 4965, 5988,
+	3373, 2351, 2347, 4393, 4392, 1834, 1838, 4908, 2341, 5921, 5920, 804, 806, 2850, 2851, 5415,
+	2357, 5937, 5936, 820, 822, 2866, 2867, 5431, 2878, 4927, 4925, 2364, 2360, 825, 827, 4410,
+	2846, 4895, 4893, 2332, 2328, 793, 795, 4378, 5395, 4375, 4374, 4882, 4880, 276, 277, 2321,
+	5379, 4359, 4358, 4866, 4864, 260, 261, 2305, 776, 1802, 1806, 2828, 2829, 2319, 2315, 1289,
+	3117, 2095, 2091, 4137, 4136, 1578, 1582, 4652, 2085, 5665, 5664, 548, 550, 2594, 2595, 5159,
+	2101, 5681, 5680, 564, 566, 2610, 2611, 5175, 2622, 4671, 4669, 2108, 2104, 569, 571, 4154,
+	2590, 4639, 4637, 2076, 2072, 537, 539, 4122, 5139, 4119, 4118, 4626, 4624, 20, 21, 2065,
+	5123, 4103, 4102, 4610, 4608, 4, 5, 2049, 520, 1546, 1550, 2572, 2573, 2063, 2059, 1033,
+	64, 577, 579, 5186, 5190, 4679, 4677, 5700, 608, 1634, 1638, 2660, 2661, 2151, 2147, 1121,
+	616, 1642, 1646, 2668, 2669, 2159, 2155, 1129, 2125, 5705, 5704, 588, 590, 2634, 2635, 5199,
+	2141, 5721, 5720, 604, 606, 2650, 2651, 5215, 1147, 5241, 5245, 5759, 5758, 3708, 3704, 634,
+	1139, 5233, 5237, 5751, 5750, 3700, 3696, 626, 2646, 4695, 4693, 2132, 2128, 593, 595, 4178,
+	192, 705, 707, 5314, 5318, 4807, 4805, 5828, 736, 1762, 1766, 2788, 2789, 2279, 2275, 1249,
+	744, 1770, 1774, 2796, 2797, 2287, 2283, 1257, 2253, 5833, 5832, 716, 718, 2762, 2763, 5327,
+	2269, 5849, 5848, 732, 734, 2778, 2779, 5343, 1275, 5369, 5373, 5887, 5886, 3836, 3832, 762,
+	1267, 5361, 5365, 5879, 5878, 3828, 3824, 754, 2774, 4823, 4821, 2260, 2256, 721, 723, 4306,
+	5275, 4255, 4254, 4762, 4760, 156, 157, 2201, 4235, 1162, 1160, 1673, 1677, 3212, 3214, 2703,
+	4267, 1194, 1192, 1705, 1709, 3244, 3246, 2735, 3261, 2239, 2235, 4281, 4280, 1722, 1726, 4796,
+	3253, 2231, 2227, 4273, 4272, 1714, 1718, 4788, 2726, 4775, 4773, 2212, 2208, 673, 675, 4258,
+	2694, 4743, 4741, 2180, 2176, 641, 643, 4226, 1680, 148, 149, 3217, 3219, 4247, 4246, 3730,
+	4315, 1242, 1240, 1753, 1757, 3292, 3294, 2783, 1275, 5369, 5373, 5887, 5886, 3836, 3832, 762,
+	1267, 5361, 5365, 5879, 5878, 3828, 3824, 754, 3798, 2770, 2771, 1239, 1237, 5841, 5840, 1748,
+	3782, 2754, 2755, 1223, 1221, 5825, 5824, 1732, 736, 1762, 1766, 2788, 2789, 2279, 2275, 1249,
+	744, 1770, 1774, 2796, 2797, 2287, 2283, 1257, 5837, 3276, 3278, 3791, 3787, 1226, 1224, 201,
+	1115, 5209, 5213, 5727, 5726, 3676, 3672, 602, 5203, 4183, 4182, 4690, 4688, 84, 85, 2129,
+	5187, 4167, 4166, 4674, 4672, 68, 69, 2113, 72, 585, 587, 5194, 5198, 4687, 4685, 5708,
+	104, 617, 619, 5226, 5230, 4719, 4717, 5740, 2149, 5729, 5728, 612, 614, 2658, 2659, 5223,
+	2165, 5745, 5744, 628, 630, 2674, 2675, 5239, 4734, 3708, 3704, 122, 123, 5241, 5245, 3199,
+	1371, 5465, 5469, 5983, 5982, 3932, 3928, 858, 5459, 4439, 4438, 4946, 4944, 340, 341, 2385,
+	5443, 4423, 4422, 4930, 4928, 324, 325, 2369, 328, 841, 843, 5450, 5454, 4943, 4941, 5964,
+	360, 873, 875, 5482, 5486, 4975, 4973, 5996, 2405, 5985, 5984, 868, 870, 2914, 2915, 5479,
+	2421, 6001, 6000, 884, 886, 2930, 2931, 5495, 4990, 3964, 3960, 378, 379, 5497, 5501, 3455,
+	2541, 6121, 6120, 1004, 1006, 3050, 3051, 5615, 6141, 3580, 3582, 4095, 4091, 1530, 1528, 505,
+	6109, 3548, 3550, 4063, 4059, 1498, 1496, 473, 1483, 5577, 5581, 6095, 6094, 4044, 4040, 970,
+	1475, 5569, 5573, 6087, 6086, 4036, 4032, 962, 464, 977, 979, 5586, 5590, 5079, 5077, 6100,
+	496, 1009, 1011, 5618, 5622, 5111, 5109, 6132, 4070, 3042, 3043, 1511, 1509, 6113, 6112, 2020,
+	2477, 6057, 6056, 940, 942, 2986, 2987, 5551, 6077, 3516, 3518, 4031, 4027, 1466, 1464, 441,
+	6045, 3484, 3486, 3999, 3995, 1434, 1432, 409, 1419, 5513, 5517, 6031, 6030, 3980, 3976, 906,
+	1411, 5505, 5509, 6023, 6022, 3972, 3968, 898, 400, 913, 915, 5522, 5526, 5015, 5013, 6036,
+	432, 945, 947, 5554, 5558, 5047, 5045, 6068, 4006, 2978, 2979, 1447, 1445, 6049, 6048, 1956,
+	4918, 3892, 3888, 306, 307, 5425, 5429, 3383, 3902, 2874, 2875, 1343, 1341, 5945, 5944, 1852,
+	3886, 2858, 2859, 1327, 1325, 5929, 5928, 1836, 5925, 3364, 3366, 3879, 3875, 1314, 1312, 289,
+	5893, 3332, 3334, 3847, 3843, 1282, 1280, 257, 1800, 268, 269, 3337, 3339, 4367, 4366, 3850,
+	1816, 284, 285, 3353, 3355, 4383, 4382, 3866, 1299, 5393, 5397, 5911, 5910, 3860, 3856, 786,
+	4662, 3636, 3632, 50, 51, 5169, 5173, 3127, 3646, 2618, 2619, 1087, 1085, 5689, 5688, 1596,
+	3630, 2602, 2603, 1071, 1069, 5673, 5672, 1580, 5669, 3108, 3110, 3623, 3619, 1058, 1056, 33,
+	5637, 3076, 3078, 3591, 3587, 1026, 1024, 1, 1544, 12, 13, 3081, 3083, 4111, 4110, 3594,
+	1560, 28, 29, 3097, 3099, 4127, 4126, 3610, 1043, 5137, 5141, 5655, 5654, 3604, 3600, 530,
+	128, 641, 643, 5250, 5254, 4743, 4741, 5764, 672, 1698, 1702, 2724, 2725, 2215, 2211, 1185,
+	680, 1706, 1710, 2732, 2733, 2223, 2219, 1193, 2189, 5769, 5768, 652, 654, 2698, 2699, 5263,
+	2205, 5785, 5784, 668, 670, 2714, 2715, 5279, 1211, 5305, 5309, 5823, 5822, 3772, 3768, 698,
+	1203, 5297, 5301, 5815, 5814, 3764, 3760, 690, 2710, 4759, 4757, 2196, 2192, 657, 659, 4242,
+	5046, 4020, 4016, 434, 435, 5553, 5557, 3511, 4030, 3002, 3003, 1471, 1469, 6073, 6072, 1980,
+	4014, 2986, 2987, 1455, 1453, 6057, 6056, 1964, 6053, 3492, 3494, 4007, 4003, 1442, 1440, 417,
+	6021, 3460, 3462, 3975, 3971, 1410, 1408, 385, 1928, 396, 397, 3465, 3467, 4495, 4494, 3978,
+	1944, 412, 413, 3481, 3483, 4511, 4510, 3994, 1427, 5521, 5525, 6039, 6038, 3988, 3984, 914,
+	3766, 2738, 2739, 1207, 1205, 5809, 5808, 1716, 2726, 4775, 4773, 2212, 2208, 673, 675, 4258,
+	2694, 4743, 4741, 2180, 2176, 641, 643, 4226, 656, 1682, 1686, 2708, 2709, 2199, 2195, 1169,
+	664, 1690, 1694, 2716, 2717, 2207, 2203, 1177, 4235, 1162, 1160, 1673, 1677, 3212, 3214, 2703,
+	4267, 1194, 1192, 1705, 1709, 3244, 3246, 2735, 2237, 5817, 5816, 700, 702, 2746, 2747, 5311,
+	3830, 2802, 2803, 1271, 1269, 5873, 5872, 1780, 2790, 4839, 4837, 2276, 2272, 737, 739, 4322,
+	2758, 4807, 4805, 2244, 2240, 705, 707, 4290, 720, 1746, 1750, 2772, 2773, 2263, 2259, 1233,
+	728, 1754, 1758, 2780, 2781, 2271, 2267, 1241, 4299, 1226, 1224, 1737, 1741, 3276, 3278, 2767,
+	4331, 1258, 1256, 1769, 1773, 3308, 3310, 2799, 2301, 5881, 5880, 764, 766, 2810, 2811, 5375,
+	4571, 1498, 1496, 2009, 2013, 3548, 3550, 3039, 1531, 5625, 5629, 6143, 6142, 4092, 4088, 1018,
+	1523, 5617, 5621, 6135, 6134, 4084, 4080, 1010, 4054, 3026, 3027, 1495, 1493, 6097, 6096, 2004,
+	4038, 3010, 3011, 1479, 1477, 6081, 6080, 1988, 992, 2018, 2022, 3044, 3045, 2535, 2531, 1505,
+	1000, 2026, 2030, 3052, 3053, 2543, 2539, 1513, 6093, 3532, 3534, 4047, 4043, 1482, 1480, 457,
+	4443, 1370, 1368, 1881, 1885, 3420, 3422, 2911, 1403, 5497, 5501, 6015, 6014, 3964, 3960, 890,
+	1395, 5489, 5493, 6007, 6006, 3956, 3952, 882, 3926, 2898, 2899, 1367, 1365, 5969, 5968, 1876,
+	3910, 2882, 2883, 1351, 1349, 5953, 5952, 1860, 864, 1890, 1894, 2916, 2917, 2407, 2403, 1377,
+	872, 1898, 1902, 2924, 2925, 2415, 2411, 1385, 5965, 3404, 3406, 3919, 3915, 1354, 1352, 329,
+	2157, 5737, 5736, 620, 622, 2666, 2667, 5231, 5757, 3196, 3198, 3711, 3707, 1146, 1144, 121,
+	5725, 3164, 3166, 3679, 3675, 1114, 1112, 89, 1099, 5193, 5197, 5711, 5710, 3660, 3656, 586,
+	1091, 5185, 5189, 5703, 5702, 3652, 3648, 578, 80, 593, 595, 5202, 5206, 4695, 4693, 5716,
+	112, 625, 627, 5234, 5238, 4727, 4725, 5748, 3686, 2658, 2659, 1127, 1125, 5729, 5728, 1636,
+	2093, 5673, 5672, 556, 558, 2602, 2603, 5167, 5693, 3132, 3134, 3647, 3643, 1082, 1080, 57,
+	5661, 3100, 3102, 3615, 3611, 1050, 1048, 25, 1035, 5129, 5133, 5647, 5646, 3596, 3592, 522,
+	1027, 5121, 5125, 5639, 5638, 3588, 3584, 514, 16, 529, 531, 5138, 5142, 4631, 4629, 5652,
+	48, 561, 563, 5170, 5174, 4663, 4661, 5684, 3622, 2594, 2595, 1063, 1061, 5665, 5664, 1572,
+	768, 1794, 1798, 2820, 2821, 2311, 2307, 1281, 1800, 268, 269, 3337, 3339, 4367, 4366, 3850,
+	1816, 284, 285, 3353, 3355, 4383, 4382, 3866, 4371, 1298, 1296, 1809, 1813, 3348, 3350, 2839,
+	4403, 1330, 1328, 1841, 1845, 3380, 3382, 2871, 3902, 2874, 2875, 1343, 1341, 5945, 5944, 1852,
+	3886, 2858, 2859, 1327, 1325, 5929, 5928, 1836, 3365, 2343, 2339, 4385, 4384, 1826, 1830, 4900,
+	5339, 4319, 4318, 4826, 4824, 220, 221, 2265, 4299, 1226, 1224, 1737, 1741, 3276, 3278, 2767,
+	4331, 1258, 1256, 1769, 1773, 3308, 3310, 2799, 3325, 2303, 2299, 4345, 4344, 1786, 1790, 4860,
+	3317, 2295, 2291, 4337, 4336, 1778, 1782, 4852, 2790, 4839, 4837, 2276, 2272, 737, 739, 4322,
+	2758, 4807, 4805, 2244, 2240, 705, 707, 4290, 1744, 212, 213, 3281, 3283, 4311, 4310, 3794,
+	4251, 1178, 1176, 1689, 1693, 3228, 3230, 2719, 1211, 5305, 5309, 5823, 5822, 3772, 3768, 698,
+	1203, 5297, 5301, 5815, 5814, 3764, 3760, 690, 3734, 2706, 2707, 1175, 1173, 5777, 5776, 1684,
+	3718, 2690, 2691, 1159, 1157, 5761, 5760, 1668, 672, 1698, 1702, 2724, 2725, 2215, 2211, 1185,
+	680, 1706, 1710, 2732, 2733, 2223, 2219, 1193, 5773, 3212, 3214, 3727, 3723, 1162, 1160, 137,
+	4123, 1050, 1048, 1561, 1565, 3100, 3102, 2591, 1083, 5177, 5181, 5695, 5694, 3644, 3640, 570,
+	1075, 5169, 5173, 5687, 5686, 3636, 3632, 562, 3606, 2578, 2579, 1047, 1045, 5649, 5648, 1556,
+	3590, 2562, 2563, 1031, 1029, 5633, 5632, 1540, 544, 1570, 1574, 2596, 2597, 2087, 2083, 1057,
+	552, 1578, 1582, 2604, 2605, 2095, 2091, 1065, 5645, 3084, 3086, 3599, 3595, 1034, 1032, 9,
+	576, 1602, 1606, 2628, 2629, 2119, 2115, 1089, 1608, 76, 77, 3145, 3147, 4175, 4174, 3658,
+	1624, 92, 93, 3161, 3163, 4191, 4190, 3674, 4179, 1106, 1104, 1617, 1621, 3156, 3158, 2647,
+	4211, 1138, 1136, 1649, 1653, 3188, 3190, 2679, 3710, 2682, 2683, 1151, 1149, 5753, 5752, 1660,
+	3694, 2666, 2667, 1135, 1133, 5737, 5736, 1644, 3173, 2151, 2147, 4193, 4192, 1634, 1638, 4708,
+	832, 1858, 1862, 2884, 2885, 2375, 2371, 1345, 1864, 332, 333, 3401, 3403, 4431, 4430, 3914,
+	1880, 348, 349, 3417, 3419, 4447, 4446, 3930, 4435, 1362, 1360, 1873, 1877, 3412, 3414, 2903,
+	4467, 1394, 1392, 1905, 1909, 3444, 3446, 2935, 3966, 2938, 2939, 1407, 1405, 6009, 6008, 1916,
+	3950, 2922, 2923, 1391, 1389, 5993, 5992, 1900, 3429, 2407, 2403, 4449, 4448, 1890, 1894, 4964,
+	5933, 3372, 3374, 3887, 3883, 1322, 1320, 297, 3341, 2319, 2315, 4361, 4360, 1802, 1806, 4876,
+	3333, 2311, 2307, 4353, 4352, 1794, 1798, 4868, 1824, 292, 293, 3361, 3363, 4391, 4390, 3874,
+	1840, 308, 309, 3377, 3379, 4407, 4406, 3890, 4886, 3860, 3856, 274, 275, 5393, 5397, 3351,
+	4894, 3868, 3864, 282, 283, 5401, 5405, 3359, 4411, 1338, 1336, 1849, 1853, 3388, 3390, 2879,
+	6061, 3500, 3502, 4015, 4011, 1450, 1448, 425, 3469, 2447, 2443, 4489, 4488, 1930, 1934, 5004,
+	3461, 2439, 2435, 4481, 4480, 1922, 1926, 4996, 1952, 420, 421, 3489, 3491, 4519, 4518, 4002,
+	1968, 436, 437, 3505, 3507, 4535, 4534, 4018, 5014, 3988, 3984, 402, 403, 5521, 5525, 3479,
+	5022, 3996, 3992, 410, 411, 5529, 5533, 3487, 4539, 1466, 1464, 1977, 1981, 3516, 3518, 3007,
+	4086, 3058, 3059, 1527, 1525, 6129, 6128, 2036, 3046, 5095, 5093, 2532, 2528, 993, 995, 4578,
+	3014, 5063, 5061, 2500, 2496, 961, 963, 4546, 976, 2002, 2006, 3028, 3029, 2519, 2515, 1489,
+	984, 2010, 2014, 3036, 3037, 2527, 2523, 1497, 4555, 1482, 1480, 1993, 1997, 3532, 3534, 3023,
+	4587, 1514, 1512, 2025, 2029, 3564, 3566, 3055, 2557, 6137, 6136, 1020, 1022, 3066, 3067, 5631,
+	5997, 3436, 3438, 3951, 3947, 1386, 1384, 361, 3405, 2383, 2379, 4425, 4424, 1866, 1870, 4940,
+	3397, 2375, 2371, 4417, 4416, 1858, 1862, 4932, 1888, 356, 357, 3425, 3427, 4455, 4454, 3938,
+	1904, 372, 373, 3441, 3443, 4471, 4470, 3954, 4950, 3924, 3920, 338, 339, 5457, 5461, 3415,
+	4958, 3932, 3928, 346, 347, 5465, 5469, 3423, 4475, 1402, 1400, 1913, 1917, 3452, 3454, 2943,
+	3565, 2543, 2539, 4585, 4584, 2026, 2030, 5100, 2533, 6113, 6112, 996, 998, 3042, 3043, 5607,
+	2549, 6129, 6128, 1012, 1014, 3058, 3059, 5623, 3070, 5119, 5117, 2556, 2552, 1017, 1019, 4602,
+	3038, 5087, 5085, 2524, 2520, 985, 987, 4570, 5587, 4567, 4566, 5074, 5072, 468, 469, 2513,
+	5571, 4551, 4550, 5058, 5056, 452, 453, 2497, 968, 1994, 1998, 3020, 3021, 2511, 2507, 1481,
+	3309, 2287, 2283, 4329, 4328, 1770, 1774, 4844, 2277, 5857, 5856, 740, 742, 2786, 2787, 5351,
+	2293, 5873, 5872, 756, 758, 2802, 2803, 5367, 2814, 4863, 4861, 2300, 2296, 761, 763, 4346,
+	2782, 4831, 4829, 2268, 2264, 729, 731, 4314, 5331, 4311, 4310, 4818, 4816, 212, 213, 2257,
+	5315, 4295, 4294, 4802, 4800, 196, 197, 2241, 712, 1738, 1742, 2764, 2765, 2255, 2251, 1225,
+	5211, 4191, 4190, 4698, 4696, 92, 93, 2137, 4171, 1098, 1096, 1609, 1613, 3148, 3150, 2639,
+	4203, 1130, 1128, 1641, 1645, 3180, 3182, 2671, 3197, 2175, 2171, 4217, 4216, 1658, 1662, 4732,
+	3189, 2167, 2163, 4209, 4208, 1650, 1654, 4724, 2662, 4711, 4709, 2148, 2144, 609, 611, 4194,
+	2630, 4679, 4677, 2116, 2112, 577, 579, 4162, 1616, 84, 85, 3153, 3155, 4183, 4182, 3666,
+	5147, 4127, 4126, 4634, 4632, 28, 29, 2073, 4107, 1034, 1032, 1545, 1549, 3084, 3086, 2575,
+	4139, 1066, 1064, 1577, 1581, 3116, 3118, 2607, 3133, 2111, 2107, 4153, 4152, 1594, 1598, 4668,
+	3125, 2103, 2099, 4145, 4144, 1586, 1590, 4660, 2598, 4647, 4645, 2084, 2080, 545, 547, 4130,
+	2566, 4615, 4613, 2052, 2048, 513, 515, 4098, 1552, 20, 21, 3089, 3091, 4119, 4118, 3602,
+	640, 1666, 1670, 2692, 2693, 2183, 2179, 1153, 1672, 140, 141, 3209, 3211, 4239, 4238, 3722,
+	1688, 156, 157, 3225, 3227, 4255, 4254, 3738, 4243, 1170, 1168, 1681, 1685, 3220, 3222, 2711,
+	4275, 1202, 1200, 1713, 1717, 3252, 3254, 2743, 3774, 2746, 2747, 1215, 1213, 5817, 5816, 1724,
+	3758, 2730, 2731, 1199, 1197, 5801, 5800, 1708, 3237, 2215, 2211, 4257, 4256, 1698, 1702, 4772,
+	896, 1922, 1926, 2948, 2949, 2439, 2435, 1409, 1928, 396, 397, 3465, 3467, 4495, 4494, 3978,
+	1944, 412, 413, 3481, 3483, 4511, 4510, 3994, 4499, 1426, 1424, 1937, 1941, 3476, 3478, 2967,
+	4531, 1458, 1456, 1969, 1973, 3508, 3510, 2999, 4030, 3002, 3003, 1471, 1469, 6073, 6072, 1980,
+	4014, 2986, 2987, 1455, 1453, 6057, 6056, 1964, 3493, 2471, 2467, 4513, 4512, 1954, 1958, 5028,
+	2870, 4919, 4917, 2356, 2352, 817, 819, 4402, 4886, 3860, 3856, 274, 275, 5393, 5397, 3351,
+	4894, 3868, 3864, 282, 283, 5401, 5405, 3359, 5435, 4415, 4414, 4922, 4920, 316, 317, 2361,
+	5419, 4399, 4398, 4906, 4904, 300, 301, 2345, 3341, 2319, 2315, 4361, 4360, 1802, 1806, 4876,
+	3333, 2311, 2307, 4353, 4352, 1794, 1798, 4868, 288, 801, 803, 5410, 5414, 4903, 4901, 5924
+	};
+
+	// LUT for Hilbert3D Morton -> Hilbert (1 level)
+	static const uint16_t Hilbert3D_from_morton_8[96] = {
+	8, 23, 25, 38, 43, 44, 26, 37,
+	24, 51, 63, 52, 1, 2, 70, 69,
+	76, 39, 75, 80, 5, 6, 66, 65,
+	0, 9, 83, 10, 95, 78, 84, 77,
+	22, 7, 21, 60, 49, 88, 50, 59,
+	58, 85, 3, 4, 57, 86, 72, 55,
+	90, 89, 45, 46, 11, 32, 12, 87,
+	36, 13, 71, 14, 35, 74, 40, 73,
+	62, 81, 15, 16, 61, 82, 92, 91,
+	94, 93, 41, 42, 31, 20, 56, 19,
+	18, 27, 17, 64, 53, 28, 54, 47,
+	68, 67, 29, 34, 79, 48, 30, 33
+	};
+
+	// LUT for Hilbert3D Hilbert -> Morton (1 level)
+	static const uint16_t Hilbert3D_to_morton_8[96] = {
+	8, 26, 30, 44, 45, 39, 35, 17,
+	24, 4, 5, 49, 51, 71, 70, 58,
+	83, 71, 70, 74, 72, 4, 5, 33,
+	0, 9, 11, 82, 86, 79, 77, 92,
+	93, 52, 54, 63, 59, 18, 16, 1,
+	78, 60, 56, 2, 3, 81, 85, 55,
+	37, 89, 88, 12, 14, 42, 43, 87,
+	46, 79, 77, 36, 32, 9, 11, 66,
+	19, 81, 85, 95, 94, 60, 56, 10,
+	62, 42, 43, 23, 21, 89, 88, 28,
+	67, 18, 16, 25, 29, 52, 54, 47,
+	53, 39, 35, 65, 64, 26, 30, 76
+	};
+}
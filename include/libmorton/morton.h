@@ -6,101 +6,638 @@
 // If you want to experiment with alternative methods (which might be slower, all depending on hardware / your data set)
 // check the individual headers below.
 
+// Portable x86-64 builds pick the fastest method for the CPU at runtime instead (see morton_dispatch.h).
+// pdep/pext are microcoded on AMD Zen 1/Zen 2, so builds for those CPU's don't use BMI2.
+
+#include "morton_common.h"
 #include "morton2D.h"
 #include "morton3D.h"
+#include "mortonND.h"
+#include "morton128.h"
 
+#if defined(LIBMORTON_RUNTIME_DISPATCH)
+#include "morton_dispatch.h"
+#else
 #if defined(__BMI2__) || defined(__AVX2__)
 #include "morton_BMI.h"
 #elif defined(__AVX512BITALG__)
 #include "morton_AVX512BITALG.h"
 #endif
+#if defined(__AVX2__)
+#include "morton_AVX2.h"
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include "morton_SSE2.h"
+#endif
+#endif
+
+#if (defined(__BMI2__) || defined(__AVX2__)) && !defined(__znver1__) && !defined(__znver2__)
+#define LIBMORTON_USE_BMI2
+#endif
 
 namespace libmorton {
 	// Functions under this are stubs which will always point to fastest implementation at the moment
 	//-----------------------------------------------------------------------------------------------
 
+	// ENCODING / DECODING with exact-width types: uint16_t / uint32_t coordinates, uint32_t / uint64_t codes
+	// uint_fast16_t and uint_fast32_t are 8 bytes on some platforms (glibc x86-64), so with those types the LUT methods
+	// would do lookups for bytes the code has no room for. The uint_fast functions below forward to these.
+	namespace exact {
+#if defined(LIBMORTON_USE_BMI2)
+		inline uint32_t morton2D_32_encode(const uint16_t x, const uint16_t y) {
+			return m2D_e_BMI<uint32_t, uint16_t>(x, y);
+		}
+		inline uint64_t morton2D_64_encode(const uint32_t x, const uint32_t y) {
+			return m2D_e_BMI<uint64_t, uint32_t>(x, y);
+		}
+		inline uint32_t morton3D_32_encode(const uint16_t x, const uint16_t y, const uint16_t z) {
+			return m3D_e_BMI<uint32_t, uint16_t>(x, y, z);
+		}
+		inline uint64_t morton3D_64_encode(const uint32_t x, const uint32_t y, const uint32_t z) {
+			return m3D_e_BMI<uint64_t, uint32_t>(x, y, z);
+		}
+		inline void morton2D_32_decode(const uint32_t morton, uint16_t& x, uint16_t& y) {
+			m2D_d_BMI<uint32_t, uint16_t>(morton, x, y);
+		}
+		inline void morton2D_64_decode(const uint64_t morton, uint32_t& x, uint32_t& y) {
+			m2D_d_BMI<uint64_t, uint32_t>(morton, x, y);
+		}
+		inline void morton3D_32_decode(const uint32_t morton, uint16_t& x, uint16_t& y, uint16_t& z) {
+			m3D_d_BMI<uint32_t, uint16_t>(morton, x, y, z);
+		}
+		inline void morton3D_64_decode(const uint64_t morton, uint32_t& x, uint32_t& y, uint32_t& z) {
+			m3D_d_BMI<uint64_t, uint32_t>(morton, x, y, z);
+		}
+#elif defined(__AVX512BITALG__)
+		// (the BITALG methods pick the width of their bit shuffles from the types, these are the ones they were written for)
+		inline uint32_t morton2D_32_encode(const uint16_t x, const uint16_t y) {
+			return static_cast<uint32_t>(m2D_e_BITALG<uint_fast32_t, uint_fast16_t>(x, y));
+		}
+		inline uint64_t morton2D_64_encode(const uint32_t x, const uint32_t y) {
+			return static_cast<uint64_t>(m2D_e_BITALG<uint_fast64_t, uint_fast32_t>(x, y));
+		}
+		inline uint32_t morton3D_32_encode(const uint16_t x, const uint16_t y, const uint16_t z) {
+			return static_cast<uint32_t>(m3D_e_BITALG<uint_fast32_t, uint_fast16_t>(x, y, z));
+		}
+		inline uint64_t morton3D_64_encode(const uint32_t x, const uint32_t y, const uint32_t z) {
+			return static_cast<uint64_t>(m3D_e_BITALG<uint_fast64_t, uint_fast32_t>(x, y, z));
+		}
+		inline void morton2D_32_decode(const uint32_t morton, uint16_t& x, uint16_t& y) {
+			uint_fast16_t fx, fy;
+			m2D_d_BITALG<uint_fast32_t, uint_fast16_t>(morton, fx, fy);
+			x = static_cast<uint16_t>(fx); y = static_cast<uint16_t>(fy);
+		}
+		inline void morton2D_64_decode(const uint64_t morton, uint32_t& x, uint32_t& y) {
+			uint_fast32_t fx, fy;
+			m2D_d_BITALG<uint_fast64_t, uint_fast32_t>(morton, fx, fy);
+			x = static_cast<uint32_t>(fx); y = static_cast<uint32_t>(fy);
+		}
+		inline void morton3D_32_decode(const uint32_t morton, uint16_t& x, uint16_t& y, uint16_t& z) {
+			uint_fast16_t fx, fy, fz;
+			m3D_d_BITALG<uint_fast32_t, uint_fast16_t>(morton, fx, fy, fz);
+			x = static_cast<uint16_t>(fx); y = static_cast<uint16_t>(fy); z = static_cast<uint16_t>(fz);
+		}
+		inline void morton3D_64_decode(const uint64_t morton, uint32_t& x, uint32_t& y, uint32_t& z) {
+			uint_fast32_t fx, fy, fz;
+			m3D_d_BITALG<uint_fast64_t, uint_fast32_t>(morton, fx, fy, fz);
+			x = static_cast<uint32_t>(fx); y = static_cast<uint32_t>(fy); z = static_cast<uint32_t>(fz);
+		}
+#elif defined(LIBMORTON_RUNTIME_DISPATCH)
+		inline uint32_t morton2D_32_encode(const uint16_t x, const uint16_t y) {
+			return dispatch().m2D_32_encode(x, y);
+		}
+		inline uint64_t morton2D_64_encode(const uint32_t x, const uint32_t y) {
+			return dispatch().m2D_64_encode(x, y);
+		}
+		inline uint32_t morton3D_32_encode(const uint16_t x, const uint16_t y, const uint16_t z) {
+			return dispatch().m3D_32_encode(x, y, z);
+		}
+		inline uint64_t morton3D_64_encode(const uint32_t x, const uint32_t y, const uint32_t z) {
+			return dispatch().m3D_64_encode(x, y, z);
+		}
+		inline void morton2D_32_decode(const uint32_t morton, uint16_t& x, uint16_t& y) {
+			dispatch().m2D_32_decode(morton, x, y);
+		}
+		inline void morton2D_64_decode(const uint64_t morton, uint32_t& x, uint32_t& y) {
+			dispatch().m2D_64_decode(morton, x, y);
+		}
+		inline void morton3D_32_decode(const uint32_t morton, uint16_t& x, uint16_t& y, uint16_t& z) {
+			dispatch().m3D_32_decode(morton, x, y, z);
+		}
+		inline void morton3D_64_decode(const uint64_t morton, uint32_t& x, uint32_t& y, uint32_t& z) {
+			dispatch().m3D_64_decode(morton, x, y, z);
+		}
+#else
+		inline uint32_t morton2D_32_encode(const uint16_t x, const uint16_t y) {
+			return m2D_e_magicbits_combined<uint32_t, uint16_t>(x, y);
+		}
+		inline uint64_t morton2D_64_encode(const uint32_t x, const uint32_t y) {
+			return m2D_e_sLUT<uint64_t, uint32_t>(x, y);
+		}
+		inline uint32_t morton3D_32_encode(const uint16_t x, const uint16_t y, const uint16_t z) {
+			return m3D_e_sLUT<uint32_t, uint16_t>(x, y, z);
+		}
+		inline uint64_t morton3D_64_encode(const uint32_t x, const uint32_t y, const uint32_t z) {
+			return m3D_e_sLUT<uint64_t, uint32_t>(x, y, z);
+		}
+		inline void morton2D_32_decode(const uint32_t morton, uint16_t& x, uint16_t& y) {
+			m2D_d_magicbits_combined<uint32_t, uint16_t>(morton, x, y);
+		}
+		inline void morton2D_64_decode(const uint64_t morton, uint32_t& x, uint32_t& y) {
+			m2D_d_sLUT<uint64_t, uint32_t>(morton, x, y);
+		}
+		inline void morton3D_32_decode(const uint32_t morton, uint16_t& x, uint16_t& y, uint16_t& z) {
+			m3D_d_sLUT<uint32_t, uint16_t>(morton, x, y, z);
+		}
+		inline void morton3D_64_decode(const uint64_t morton, uint32_t& x, uint32_t& y, uint32_t& z) {
+			m3D_d_sLUT<uint64_t, uint32_t>(morton, x, y, z);
+		}
+#endif
+	}  // namespace exact
+
 	// ENCODING
-#if defined(__BMI2__) || defined(__AVX2__)
 	inline uint_fast32_t morton2D_32_encode(const uint_fast16_t x, const uint_fast16_t y) {
-		return m2D_e_BMI<uint_fast32_t, uint_fast16_t>(x, y);
+		return exact::morton2D_32_encode(static_cast<uint16_t>(x), static_cast<uint16_t>(y));
 	}
 	inline uint_fast64_t morton2D_64_encode(const uint_fast32_t x, const uint_fast32_t y) {
-		return m2D_e_BMI<uint_fast64_t, uint_fast32_t>(x, y);
+		return exact::morton2D_64_encode(static_cast<uint32_t>(x), static_cast<uint32_t>(y));
 	}
 	inline uint_fast32_t morton3D_32_encode(const uint_fast16_t x, const uint_fast16_t y, const uint_fast16_t z) {
-		return m3D_e_BMI<uint_fast32_t, uint_fast16_t>(x, y, z);
+		return exact::morton3D_32_encode(static_cast<uint16_t>(x), static_cast<uint16_t>(y), static_cast<uint16_t>(z));
 	}
 	inline uint_fast64_t morton3D_64_encode(const uint_fast32_t x, const uint_fast32_t y, const uint_fast32_t z) {
-		return m3D_e_BMI<uint_fast64_t, uint_fast32_t>(x, y, z);
+		return exact::morton3D_64_encode(static_cast<uint32_t>(x), static_cast<uint32_t>(y), static_cast<uint32_t>(z));
 	}
-#elif defined(__AVX512BITALG__)
-	inline uint_fast32_t morton2D_32_encode(const uint_fast16_t x, const uint_fast16_t y) {
-		return m2D_e_BITALG<uint_fast32_t, uint_fast16_t>(x, y);
+
+	// DECODING
+	inline void morton2D_32_decode(const uint_fast32_t morton, uint_fast16_t& x, uint_fast16_t& y) {
+		uint16_t ex, ey;
+		exact::morton2D_32_decode(static_cast<uint32_t>(morton), ex, ey);
+		x = ex; y = ey;
 	}
-	inline uint_fast64_t morton2D_64_encode(const uint_fast32_t x, const uint_fast32_t y) {
-		return m2D_e_BITALG<uint_fast64_t, uint_fast32_t>(x, y);
+	inline void morton2D_64_decode(const uint_fast64_t morton, uint_fast32_t& x, uint_fast32_t& y) {
+		uint32_t ex, ey;
+		exact::morton2D_64_decode(static_cast<uint64_t>(morton), ex, ey);
+		x = ex; y = ey;
 	}
-	inline uint_fast32_t morton3D_32_encode(const uint_fast16_t x, const uint_fast16_t y, const uint_fast16_t z) {
-		return m3D_e_BITALG<uint_fast32_t, uint_fast16_t>(x, y, z);
+	inline void morton3D_32_decode(const uint_fast32_t morton, uint_fast16_t& x, uint_fast16_t& y, uint_fast16_t& z) {
+		uint16_t ex, ey, ez;
+		exact::morton3D_32_decode(static_cast<uint32_t>(morton), ex, ey, ez);
+		x = ex; y = ey; z = ez;
 	}
-	inline uint_fast64_t morton3D_64_encode(const uint_fast32_t x, const uint_fast32_t y, const uint_fast32_t z) {
-		return m3D_e_BITALG<uint_fast64_t, uint_fast32_t>(x, y, z);
+	inline void morton3D_64_decode(const uint_fast64_t morton, uint_fast32_t& x, uint_fast32_t& y, uint_fast32_t& z) {
+		uint32_t ex, ey, ez;
+		exact::morton3D_64_decode(static_cast<uint64_t>(morton), ex, ey, ez);
+		x = ex; y = ey; z = ez;
+	}
+
+	// 128-BIT ENCODING / DECODING (2D: 64 bits per coordinate, 3D: 42 bits per coordinate, see morton128.h)
+	// Two 64-bit codes, one of the lower and one of the upper half of the coordinates
+	inline morton128_t morton2D_128_encode(const uint_fast64_t x, const uint_fast64_t y) {
+		using namespace morton128_detail;
+		return morton128_make(morton2D_64_encode(static_cast<uint_fast32_t>(x >> 32), static_cast<uint_fast32_t>(y >> 32)),
+			morton2D_64_encode(static_cast<uint_fast32_t>(x & mask2D), static_cast<uint_fast32_t>(y & mask2D)));
+	}
+	inline morton128_t morton3D_128_encode(const uint_fast64_t x, const uint_fast64_t y, const uint_fast64_t z) {
+		using namespace morton128_detail;
+		return join3D(morton3D_64_encode(static_cast<uint_fast32_t>(x & mask3D), static_cast<uint_fast32_t>(y & mask3D), static_cast<uint_fast32_t>(z & mask3D)),
+			morton3D_64_encode(static_cast<uint_fast32_t>((x >> 21) & mask3D), static_cast<uint_fast32_t>((y >> 21) & mask3D), static_cast<uint_fast32_t>((z >> 21) & mask3D)));
+	}
+	inline void morton2D_128_decode(const morton128_t m, uint_fast64_t& x, uint_fast64_t& y) {
+		using namespace morton128_detail;
+		uint_fast32_t xl, yl, xh, yh;
+		morton2D_64_decode(morton128_lo(m), xl, yl);
+		morton2D_64_decode(morton128_hi(m), xh, yh);
+		x = coord2D(xl, xh);
+		y = coord2D(yl, yh);
+	}
+	inline void morton3D_128_decode(const morton128_t m, uint_fast64_t& x, uint_fast64_t& y, uint_fast64_t& z) {
+		using namespace morton128_detail;
+		uint_fast32_t xl, yl, zl, xh, yh, zh;
+		morton3D_64_decode(lower3D(m), xl, yl, zl);
+		morton3D_64_decode(upper3D(m), xh, yh, zh);
+		x = coord3D(xl, xh);
+		y = coord3D(yl, yh);
+		z = coord3D(zl, zh);
+	}
+
+	// BATCH ENCODING
+	// Encode n coordinates given as separate x and y arrays into out (same results as m2D_e_magicbits)
+#if defined(LIBMORTON_RUNTIME_DISPATCH)
+	inline void morton2D_32_encode_batch(const uint16_t* x, const uint16_t* y, uint32_t* out, size_t n) {
+		dispatch().m2D_32_encode_batch(x, y, out, n);
+	}
+	inline void morton2D_64_encode_batch(const uint32_t* x, const uint32_t* y, uint64_t* out, size_t n) {
+		dispatch().m2D_64_encode_batch(x, y, out, n);
+	}
+#elif defined(__AVX2__)
+	inline void morton2D_32_encode_batch(const uint16_t* x, const uint16_t* y, uint32_t* out, size_t n) {
+		m2D_e_AVX2_batch(x, y, out, n);
+	}
+	inline void morton2D_64_encode_batch(const uint32_t* x, const uint32_t* y, uint64_t* out, size_t n) {
+		m2D_e_AVX2_batch(x, y, out, n);
+	}
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	inline void morton2D_32_encode_batch(const uint16_t* x, const uint16_t* y, uint32_t* out, size_t n) {
+		m2D_e_SSE2_batch(x, y, out, n);
+	}
+	inline void morton2D_64_encode_batch(const uint32_t* x, const uint32_t* y, uint64_t* out, size_t n) {
+		m2D_e_SSE2_batch(x, y, out, n);
 	}
 #else
-	inline uint_fast32_t morton2D_32_encode(const uint_fast16_t x, const uint_fast16_t y) {
-		return m2D_e_magicbits_combined(x, y);
+	inline void morton2D_32_encode_batch(const uint16_t* x, const uint16_t* y, uint32_t* out, size_t n) {
+		m2D_e_magicbits_batch<uint32_t, uint16_t>(x, y, out, n);
 	}
-	inline uint_fast64_t morton2D_64_encode(const uint_fast32_t x, const uint_fast32_t y) {
-		return m2D_e_sLUT<uint_fast64_t, uint_fast32_t>(x, y);
+	inline void morton2D_64_encode_batch(const uint32_t* x, const uint32_t* y, uint64_t* out, size_t n) {
+		m2D_e_magicbits_batch<uint64_t, uint32_t>(x, y, out, n);
 	}
-	inline uint_fast32_t morton3D_32_encode(const uint_fast16_t x, const uint_fast16_t y, const uint_fast16_t z) {
-		return m3D_e_sLUT<uint_fast32_t, uint_fast16_t>(x, y, z);
+#endif
+	// Encode n coordinates given as separate x, y and z arrays into out (same results as m3D_e_magicbits)
+#if defined(LIBMORTON_RUNTIME_DISPATCH)
+	inline void morton3D_32_encode_batch(const uint16_t* x, const uint16_t* y, const uint16_t* z, uint32_t* out, size_t n) {
+		dispatch().m3D_32_encode_batch(x, y, z, out, n);
 	}
-	inline uint_fast64_t morton3D_64_encode(const uint_fast32_t x, const uint_fast32_t y, const uint_fast32_t z) {
-		return m3D_e_sLUT<uint_fast64_t, uint_fast32_t>(x, y, z);
+	inline void morton3D_64_encode_batch(const uint32_t* x, const uint32_t* y, const uint32_t* z, uint64_t* out, size_t n) {
+		dispatch().m3D_64_encode_batch(x, y, z, out, n);
+	}
+#elif defined(__AVX2__)
+	inline void morton3D_32_encode_batch(const uint16_t* x, const uint16_t* y, const uint16_t* z, uint32_t* out, size_t n) {
+		m3D_e_AVX2_batch(x, y, z, out, n);
+	}
+	inline void morton3D_64_encode_batch(const uint32_t* x, const uint32_t* y, const uint32_t* z, uint64_t* out, size_t n) {
+		m3D_e_AVX2_batch(x, y, z, out, n);
+	}
+#else
+	inline void morton3D_32_encode_batch(const uint16_t* x, const uint16_t* y, const uint16_t* z, uint32_t* out, size_t n) {
+		m3D_e_magicbits_batch<uint32_t, uint16_t>(x, y, z, out, n);
+	}
+	inline void morton3D_64_encode_batch(const uint32_t* x, const uint32_t* y, const uint32_t* z, uint64_t* out, size_t n) {
+		m3D_e_magicbits_batch<uint64_t, uint32_t>(x, y, z, out, n);
 	}
 #endif
 
-	// DECODING
+	// BATCH DECODING
+	// Decode n codes into separate x and y arrays (same results as m2D_d_magicbits)
+#if defined(LIBMORTON_RUNTIME_DISPATCH)
+	inline void morton2D_32_decode_batch(const uint32_t* m, uint16_t* x, uint16_t* y, size_t n) {
+		dispatch().m2D_32_decode_batch(m, x, y, n);
+	}
+	inline void morton2D_64_decode_batch(const uint64_t* m, uint32_t* x, uint32_t* y, size_t n) {
+		dispatch().m2D_64_decode_batch(m, x, y, n);
+	}
+#elif defined(__AVX2__)
+	inline void morton2D_32_decode_batch(const uint32_t* m, uint16_t* x, uint16_t* y, size_t n) {
+		m2D_d_AVX2_batch(m, x, y, n);
+	}
+	inline void morton2D_64_decode_batch(const uint64_t* m, uint32_t* x, uint32_t* y, size_t n) {
+		m2D_d_AVX2_batch(m, x, y, n);
+	}
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	inline void morton2D_32_decode_batch(const uint32_t* m, uint16_t* x, uint16_t* y, size_t n) {
+		m2D_d_SSE2_batch(m, x, y, n);
+	}
+	inline void morton2D_64_decode_batch(const uint64_t* m, uint32_t* x, uint32_t* y, size_t n) {
+		m2D_d_SSE2_batch(m, x, y, n);
+	}
+#else
+	inline void morton2D_32_decode_batch(const uint32_t* m, uint16_t* x, uint16_t* y, size_t n) {
+		m2D_d_magicbits_batch<uint32_t, uint16_t>(m, x, y, n);
+	}
+	inline void morton2D_64_decode_batch(const uint64_t* m, uint32_t* x, uint32_t* y, size_t n) {
+		m2D_d_magicbits_batch<uint64_t, uint32_t>(m, x, y, n);
+	}
+#endif
+	// Decode n codes into separate x, y and z arrays (same results as m3D_d_magicbits)
+#if defined(LIBMORTON_RUNTIME_DISPATCH)
+	inline void morton3D_32_decode_batch(const uint32_t* m, uint16_t* x, uint16_t* y, uint16_t* z, size_t n) {
+		dispatch().m3D_32_decode_batch(m, x, y, z, n);
+	}
+	inline void morton3D_64_decode_batch(const uint64_t* m, uint32_t* x, uint32_t* y, uint32_t* z, size_t n) {
+		dispatch().m3D_64_decode_batch(m, x, y, z, n);
+	}
+#elif defined(__AVX2__)
+	inline void morton3D_32_decode_batch(const uint32_t* m, uint16_t* x, uint16_t* y, uint16_t* z, size_t n) {
+		m3D_d_AVX2_batch(m, x, y, z, n);
+	}
+	inline void morton3D_64_decode_batch(const uint64_t* m, uint32_t* x, uint32_t* y, uint32_t* z, size_t n) {
+		m3D_d_AVX2_batch(m, x, y, z, n);
+	}
+#else
+	inline void morton3D_32_decode_batch(const uint32_t* m, uint16_t* x, uint16_t* y, uint16_t* z, size_t n) {
+		m3D_d_magicbits_batch<uint32_t, uint16_t>(m, x, y, z, n);
+	}
+	inline void morton3D_64_decode_batch(const uint64_t* m, uint32_t* x, uint32_t* y, uint32_t* z, size_t n) {
+		m3D_d_magicbits_batch<uint64_t, uint32_t>(m, x, y, z, n);
+	}
+#endif
 
-#if defined(__BMI2__) || defined(__AVX2__)
-	inline void morton2D_32_decode(const uint_fast32_t morton, uint_fast16_t& x, uint_fast16_t& y) {
-		m2D_d_BMI<uint_fast32_t, uint_fast16_t>(morton, x, y);
+	// STRIDED ENCODING
+	// Encode n records of stride bytes (e.g. an array of point structs) in place, reading the coordinates
+	// at byte offsets offx, offy (and offz) of every record. Records and fields do not need to be aligned.
+#if defined(LIBMORTON_RUNTIME_DISPATCH)
+	inline void morton2D_32_encode_strided(const void* base, size_t stride, size_t offx, size_t offy, uint32_t* out, size_t n) {
+		dispatch().m2D_32_encode_strided(base, stride, offx, offy, out, n);
 	}
-	inline void morton2D_64_decode(const uint_fast64_t morton, uint_fast32_t& x, uint_fast32_t& y) {
-		m2D_d_BMI<uint_fast64_t, uint_fast32_t>(morton, x, y);
+	inline void morton2D_64_encode_strided(const void* base, size_t stride, size_t offx, size_t offy, uint64_t* out, size_t n) {
+		dispatch().m2D_64_encode_strided(base, stride, offx, offy, out, n);
 	}
-	inline void morton3D_32_decode(const uint_fast32_t morton, uint_fast16_t& x, uint_fast16_t& y, uint_fast16_t& z) {
-		m3D_d_BMI<uint_fast32_t, uint_fast16_t>(morton, x, y, z);
+	inline void morton3D_32_encode_strided(const void* base, size_t stride, size_t offx, size_t offy, size_t offz, uint32_t* out, size_t n) {
+		dispatch().m3D_32_encode_strided(base, stride, offx, offy, offz, out, n);
 	}
-	inline void morton3D_64_decode(const uint_fast64_t morton, uint_fast32_t& x, uint_fast32_t& y, uint_fast32_t& z) {
-		m3D_d_BMI<uint_fast64_t, uint_fast32_t>(morton, x, y, z);
+	inline void morton3D_64_encode_strided(const void* base, size_t stride, size_t offx, size_t offy, size_t offz, uint64_t* out, size_t n) {
+		dispatch().m3D_64_encode_strided(base, stride, offx, offy, offz, out, n);
 	}
-#elif defined(__AVX512BITALG__)
-	inline void morton2D_32_decode(const uint_fast32_t morton, uint_fast16_t& x, uint_fast16_t& y) {
-		m2D_d_BITALG<uint_fast32_t, uint_fast16_t>(morton, x, y);
+#elif defined(__AVX2__)
+	inline void morton2D_32_encode_strided(const void* base, size_t stride, size_t offx, size_t offy, uint32_t* out, size_t n) {
+		m2D_e_AVX2_strided(base, stride, offx, offy, out, n);
 	}
-	inline void morton2D_64_decode(const uint_fast64_t morton, uint_fast32_t& x, uint_fast32_t& y) {
-		m2D_d_BITALG<uint_fast64_t, uint_fast32_t>(morton, x, y);
+	inline void morton2D_64_encode_strided(const void* base, size_t stride, size_t offx, size_t offy, uint64_t* out, size_t n) {
+		m2D_e_AVX2_strided(base, stride, offx, offy, out, n);
 	}
-	inline void morton3D_32_decode(const uint_fast32_t morton, uint_fast16_t& x, uint_fast16_t& y, uint_fast16_t& z) {
-		m3D_d_BITALG<uint_fast32_t, uint_fast16_t>(morton, x, y, z);
+	inline void morton3D_32_encode_strided(const void* base, size_t stride, size_t offx, size_t offy, size_t offz, uint32_t* out, size_t n) {
+		m3D_e_AVX2_strided(base, stride, offx, offy, offz, out, n);
+	}
+	inline void morton3D_64_encode_strided(const void* base, size_t stride, size_t offx, size_t offy, size_t offz, uint64_t* out, size_t n) {
+		m3D_e_AVX2_strided(base, stride, offx, offy, offz, out, n);
 	}
-	inline void morton3D_64_decode(const uint_fast64_t morton, uint_fast32_t& x, uint_fast32_t& y, uint_fast32_t& z) {
-		m3D_d_BITALG<uint_fast64_t, uint_fast32_t>(morton, x, y, z);
-}
 #else
-	inline void morton2D_32_decode(const uint_fast32_t morton, uint_fast16_t& x, uint_fast16_t& y) {
-		m2D_d_magicbits_combined(morton, x, y);
+	inline void morton2D_32_encode_strided(const void* base, size_t stride, size_t offx, size_t offy, uint32_t* out, size_t n) {
+		m2D_e_magicbits_strided<uint32_t, uint16_t>(base, stride, offx, offy, out, n);
 	}
-	inline void morton2D_64_decode(const uint_fast64_t morton, uint_fast32_t& x, uint_fast32_t& y) {
-		m2D_d_sLUT<uint_fast64_t, uint_fast32_t>(morton, x, y);
+	inline void morton2D_64_encode_strided(const void* base, size_t stride, size_t offx, size_t offy, uint64_t* out, size_t n) {
+		m2D_e_magicbits_strided<uint64_t, uint32_t>(base, stride, offx, offy, out, n);
 	}
-	inline void morton3D_32_decode(const uint_fast32_t morton, uint_fast16_t& x, uint_fast16_t& y, uint_fast16_t& z) {
-		m3D_d_sLUT<uint_fast32_t, uint_fast16_t>(morton, x, y, z);
+	inline void morton3D_32_encode_strided(const void* base, size_t stride, size_t offx, size_t offy, size_t offz, uint32_t* out, size_t n) {
+		m3D_e_magicbits_strided<uint32_t, uint16_t>(base, stride, offx, offy, offz, out, n);
 	}
-	inline void morton3D_64_decode(const uint_fast64_t morton, uint_fast32_t& x, uint_fast32_t& y, uint_fast32_t& z) {
-		m3D_d_sLUT<uint_fast64_t, uint_fast32_t>(morton, x, y, z);
+	inline void morton3D_64_encode_strided(const void* base, size_t stride, size_t offx, size_t offy, size_t offz, uint64_t* out, size_t n) {
+		m3D_e_magicbits_strided<uint64_t, uint32_t>(base, stride, offx, offy, offz, out, n);
+	}
+#endif
+
+	// ENCODING FLOATING POINT POSITIONS
+	// Quantize n packed {x, y, z} positions to the cells of a grid of 2^level cells per axis over box (level up to 10 for
+	// 32-bit codes, 21 for 64-bit codes) and encode them in the same pass, without an intermediate buffer of coordinates.
+	// Positions outside the box are clamped to it, NaN goes to cell 0 (see mortonQuantize).
+#if defined(LIBMORTON_RUNTIME_DISPATCH)
+	inline void morton3D_32_encode_floats(const float* xyz, uint32_t* out, size_t n, const morton_aabb& box, unsigned int level) {
+		dispatch().m3D_32_encode_floats(xyz, out, n, box, level);
+	}
+	inline void morton3D_64_encode_floats(const float* xyz, uint64_t* out, size_t n, const morton_aabb& box, unsigned int level) {
+		dispatch().m3D_64_encode_floats(xyz, out, n, box, level);
+	}
+	inline void morton3D_32_encode_floats(const double* xyz, uint32_t* out, size_t n, const morton_box<double>& box, unsigned int level) {
+		dispatch().m3D_32_encode_doubles(xyz, out, n, box, level);
+	}
+	inline void morton3D_64_encode_floats(const double* xyz, uint64_t* out, size_t n, const morton_box<double>& box, unsigned int level) {
+		dispatch().m3D_64_encode_doubles(xyz, out, n, box, level);
+	}
+#elif defined(__AVX2__)
+	inline void morton3D_32_encode_floats(const float* xyz, uint32_t* out, size_t n, const morton_aabb& box, unsigned int level) {
+		m3D_e_AVX2_floats(xyz, out, n, box, level);
+	}
+	inline void morton3D_64_encode_floats(const float* xyz, uint64_t* out, size_t n, const morton_aabb& box, unsigned int level) {
+		m3D_e_AVX2_floats(xyz, out, n, box, level);
+	}
+	inline void morton3D_32_encode_floats(const double* xyz, uint32_t* out, size_t n, const morton_box<double>& box, unsigned int level) {
+		m3D_e_AVX2_floats(xyz, out, n, box, level);
+	}
+	inline void morton3D_64_encode_floats(const double* xyz, uint64_t* out, size_t n, const morton_box<double>& box, unsigned int level) {
+		m3D_e_AVX2_floats(xyz, out, n, box, level);
+	}
+#else
+	inline void morton3D_32_encode_floats(const float* xyz, uint32_t* out, size_t n, const morton_aabb& box, unsigned int level) {
+		m3D_e_magicbits_floats<uint32_t, uint16_t>(xyz, out, n, box, level);
+	}
+	inline void morton3D_64_encode_floats(const float* xyz, uint64_t* out, size_t n, const morton_aabb& box, unsigned int level) {
+		m3D_e_magicbits_floats<uint64_t, uint32_t>(xyz, out, n, box, level);
+	}
+	inline void morton3D_32_encode_floats(const double* xyz, uint32_t* out, size_t n, const morton_box<double>& box, unsigned int level) {
+		m3D_e_magicbits_floats<uint32_t, uint16_t>(xyz, out, n, box, level);
+	}
+	inline void morton3D_64_encode_floats(const double* xyz, uint64_t* out, size_t n, const morton_box<double>& box, unsigned int level) {
+		m3D_e_magicbits_floats<uint64_t, uint32_t>(xyz, out, n, box, level);
+	}
+#endif
+
+	// DECODING TO FLOATING POINT POSITIONS
+	// Write the centres of the cells of n codes to xyz as packed {x, y, z} positions (the inverse of the methods above)
+	inline void morton3D_32_decode_floats(const uint32_t* m, float* xyz, size_t n, const morton_aabb& box, unsigned int level) {
+		m3D_d_magicbits_floats<uint32_t, uint16_t>(m, xyz, n, box, level);
+	}
+	inline void morton3D_64_decode_floats(const uint64_t* m, float* xyz, size_t n, const morton_aabb& box, unsigned int level) {
+		m3D_d_magicbits_floats<uint64_t, uint32_t>(m, xyz, n, box, level);
+	}
+	inline void morton3D_32_decode_floats(const uint32_t* m, double* xyz, size_t n, const morton_box<double>& box, unsigned int level) {
+		m3D_d_magicbits_floats<uint32_t, uint16_t>(m, xyz, n, box, level);
+	}
+	inline void morton3D_64_decode_floats(const uint64_t* m, double* xyz, size_t n, const morton_box<double>& box, unsigned int level) {
+		m3D_d_magicbits_floats<uint64_t, uint32_t>(m, xyz, n, box, level);
+	}
+
+	// SIGNED COORDINATES
+	// Coordinates in [-2^(bits - 1), 2^(bits - 1)) for bits per axis: 16 (2D 32-bit codes), 32 (2D 64-bit), 10 (3D 32-bit)
+	// and 21 (3D 64-bit). The top bit of every axis is flipped (see mortonSignBits), so negative coordinates come before
+	// positive ones and the codes keep the spatial order across 0. Coordinates outside the range wrap around.
+	inline uint32_t morton2D_32_encode_signed(const int16_t x, const int16_t y) {
+		return exact::morton2D_32_encode(static_cast<uint16_t>(x), static_cast<uint16_t>(y)) ^ mortonSignBits<uint32_t>(2, 16);
+	}
+	inline uint64_t morton2D_64_encode_signed(const int32_t x, const int32_t y) {
+		return exact::morton2D_64_encode(static_cast<uint32_t>(x), static_cast<uint32_t>(y)) ^ mortonSignBits<uint64_t>(2, 32);
+	}
+	inline uint32_t morton3D_32_encode_signed(const int16_t x, const int16_t y, const int16_t z) {
+		// the LUT methods need the bits above the 10 of every axis cleared (the batch methods ignore them)
+		return exact::morton3D_32_encode(static_cast<uint16_t>(x & 0x3FF), static_cast<uint16_t>(y & 0x3FF), static_cast<uint16_t>(z & 0x3FF)) ^ mortonSignBits<uint32_t>(3, 10);
+	}
+	inline uint64_t morton3D_64_encode_signed(const int32_t x, const int32_t y, const int32_t z) {
+		return exact::morton3D_64_encode(static_cast<uint32_t>(x) & 0x1FFFFF, static_cast<uint32_t>(y) & 0x1FFFFF, static_cast<uint32_t>(z) & 0x1FFFFF) ^ mortonSignBits<uint64_t>(3, 21);
+	}
+	inline void morton2D_32_decode_signed(const uint32_t morton, int16_t& x, int16_t& y) {
+		uint16_t ux, uy;
+		exact::morton2D_32_decode(morton, ux, uy);
+		x = mortonUnbias<int16_t>(ux, 16);
+		y = mortonUnbias<int16_t>(uy, 16);
+	}
+	inline void morton2D_64_decode_signed(const uint64_t morton, int32_t& x, int32_t& y) {
+		uint32_t ux, uy;
+		exact::morton2D_64_decode(morton, ux, uy);
+		x = mortonUnbias<int32_t>(ux, 32);
+		y = mortonUnbias<int32_t>(uy, 32);
+	}
+	inline void morton3D_32_decode_signed(const uint32_t morton, int16_t& x, int16_t& y, int16_t& z) {
+		uint16_t ux, uy, uz;
+		exact::morton3D_32_decode(morton, ux, uy, uz);
+		x = mortonUnbias<int16_t>(ux, 10);
+		y = mortonUnbias<int16_t>(uy, 10);
+		z = mortonUnbias<int16_t>(uz, 10);
+	}
+	inline void morton3D_64_decode_signed(const uint64_t morton, int32_t& x, int32_t& y, int32_t& z) {
+		uint32_t ux, uy, uz;
+		exact::morton3D_64_decode(morton, ux, uy, uz);
+		x = mortonUnbias<int32_t>(ux, 21);
+		y = mortonUnbias<int32_t>(uy, 21);
+		z = mortonUnbias<int32_t>(uz, 21);
+	}
+
+	// SIGNED COORDINATES IN BATCH
+	// The batch methods above on the coordinates as unsigned values, one block that stays in the L1 cache at a time,
+	// flipping the sign bits of the codes (encode) or unbiasing the coordinates (decode) while the block is still there.
+	namespace signed_detail {
+		static const size_t block = 1024;
+	}
+	inline void morton2D_32_encode_signed_batch(const int16_t* x, const int16_t* y, uint32_t* out, size_t n) {
+		for (size_t i = 0; i < n; i += signed_detail::block) {
+			const size_t count = std::min(signed_detail::block, n - i);
+			morton2D_32_encode_batch(reinterpret_cast<const uint16_t*>(x + i), reinterpret_cast<const uint16_t*>(y + i), out + i, count);
+			for (size_t k = i; k < i + count; ++k) { out[k] ^= mortonSignBits<uint32_t>(2, 16); }
+		}
+	}
+	inline void morton2D_64_encode_signed_batch(const int32_t* x, const int32_t* y, uint64_t* out, size_t n) {
+		for (size_t i = 0; i < n; i += signed_detail::block) {
+			const size_t count = std::min(signed_detail::block, n - i);
+			morton2D_64_encode_batch(reinterpret_cast<const uint32_t*>(x + i), reinterpret_cast<const uint32_t*>(y + i), out + i, count);
+			for (size_t k = i; k < i + count; ++k) { out[k] ^= mortonSignBits<uint64_t>(2, 32); }
+		}
+	}
+	inline void morton3D_32_encode_signed_batch(const int16_t* x, const int16_t* y, const int16_t* z, uint32_t* out, size_t n) {
+		for (size_t i = 0; i < n; i += signed_detail::block) {
+			const size_t count = std::min(signed_detail::block, n - i);
+			morton3D_32_encode_batch(reinterpret_cast<const uint16_t*>(x + i), reinterpret_cast<const uint16_t*>(y + i), reinterpret_cast<const uint16_t*>(z + i), out + i, count);
+			for (size_t k = i; k < i + count; ++k) { out[k] ^= mortonSignBits<uint32_t>(3, 10); }
+		}
+	}
+	inline void morton3D_64_encode_signed_batch(const int32_t* x, const int32_t* y, const int32_t* z, uint64_t* out, size_t n) {
+		for (size_t i = 0; i < n; i += signed_detail::block) {
+			const size_t count = std::min(signed_detail::block, n - i);
+			morton3D_64_encode_batch(reinterpret_cast<const uint32_t*>(x + i), reinterpret_cast<const uint32_t*>(y + i), reinterpret_cast<const uint32_t*>(z + i), out + i, count);
+			for (size_t k = i; k < i + count; ++k) { out[k] ^= mortonSignBits<uint64_t>(3, 21); }
+		}
 	}
+	inline void morton2D_32_decode_signed_batch(const uint32_t* m, int16_t* x, int16_t* y, size_t n) {
+		for (size_t i = 0; i < n; i += signed_detail::block) {
+			const size_t count = std::min(signed_detail::block, n - i);
+			morton2D_32_decode_batch(m + i, reinterpret_cast<uint16_t*>(x + i), reinterpret_cast<uint16_t*>(y + i), count);
+			for (size_t k = i; k < i + count; ++k) {
+				x[k] = mortonUnbias<int16_t>(static_cast<uint16_t>(x[k]), 16);
+				y[k] = mortonUnbias<int16_t>(static_cast<uint16_t>(y[k]), 16);
+			}
+		}
+	}
+	inline void morton2D_64_decode_signed_batch(const uint64_t* m, int32_t* x, int32_t* y, size_t n) {
+		for (size_t i = 0; i < n; i += signed_detail::block) {
+			const size_t count = std::min(signed_detail::block, n - i);
+			morton2D_64_decode_batch(m + i, reinterpret_cast<uint32_t*>(x + i), reinterpret_cast<uint32_t*>(y + i), count);
+			for (size_t k = i; k < i + count; ++k) {
+				x[k] = mortonUnbias<int32_t>(static_cast<uint32_t>(x[k]), 32);
+				y[k] = mortonUnbias<int32_t>(static_cast<uint32_t>(y[k]), 32);
+			}
+		}
+	}
+	inline void morton3D_32_decode_signed_batch(const uint32_t* m, int16_t* x, int16_t* y, int16_t* z, size_t n) {
+		for (size_t i = 0; i < n; i += signed_detail::block) {
+			const size_t count = std::min(signed_detail::block, n - i);
+			morton3D_32_decode_batch(m + i, reinterpret_cast<uint16_t*>(x + i), reinterpret_cast<uint16_t*>(y + i), reinterpret_cast<uint16_t*>(z + i), count);
+			for (size_t k = i; k < i + count; ++k) {
+				x[k] = mortonUnbias<int16_t>(static_cast<uint16_t>(x[k]), 10);
+				y[k] = mortonUnbias<int16_t>(static_cast<uint16_t>(y[k]), 10);
+				z[k] = mortonUnbias<int16_t>(static_cast<uint16_t>(z[k]), 10);
+			}
+		}
+	}
+	inline void morton3D_64_decode_signed_batch(const uint64_t* m, int32_t* x, int32_t* y, int32_t* z, size_t n) {
+		for (size_t i = 0; i < n; i += signed_detail::block) {
+			const size_t count = std::min(signed_detail::block, n - i);
+			morton3D_64_decode_batch(m + i, reinterpret_cast<uint32_t*>(x + i), reinterpret_cast<uint32_t*>(y + i), reinterpret_cast<uint32_t*>(z + i), count);
+			for (size_t k = i; k < i + count; ++k) {
+				x[k] = mortonUnbias<int32_t>(static_cast<uint32_t>(x[k]), 21);
+				y[k] = mortonUnbias<int32_t>(static_cast<uint32_t>(y[k]), 21);
+				z[k] = mortonUnbias<int32_t>(static_cast<uint32_t>(z[k]), 21);
+			}
+		}
+	}
+
+	// NEIGHBOURS
+	// Write the 4/8 (2D) or 6/18/26 (3D) neighbours of n codes in a grid of 2^level cells per axis to out[i * connectivity ...],
+	// without leaving Morton space. See m2D_neighbours / m3D_neighbours for the order and mortonNeighbourOffsets for the offsets.
+	// Returns the number of neighbours per code (0 for an unsupported connectivity, and for 2D codes at the full width with
+	// morton_boundary::invalid, where the invalid marker is the code of the corner cell).
+#if defined(LIBMORTON_RUNTIME_DISPATCH)
+	inline size_t morton2D_32_neighbours(const uint32_t* m, uint32_t* out, size_t n, unsigned int level, unsigned int connectivity, morton_boundary boundary) {
+		return dispatch().m2D_32_neighbours(m, out, n, level, connectivity, boundary);
+	}
+	inline size_t morton2D_64_neighbours(const uint64_t* m, uint64_t* out, size_t n, unsigned int level, unsigned int connectivity, morton_boundary boundary) {
+		return dispatch().m2D_64_neighbours(m, out, n, level, connectivity, boundary);
+	}
+	inline size_t morton3D_32_neighbours(const uint32_t* m, uint32_t* out, size_t n, unsigned int level, unsigned int connectivity, morton_boundary boundary) {
+		return dispatch().m3D_32_neighbours(m, out, n, level, connectivity, boundary);
+	}
+	inline size_t morton3D_64_neighbours(const uint64_t* m, uint64_t* out, size_t n, unsigned int level, unsigned int connectivity, morton_boundary boundary) {
+		return dispatch().m3D_64_neighbours(m, out, n, level, connectivity, boundary);
+	}
+#elif defined(__AVX2__)
+	inline size_t morton2D_32_neighbours(const uint32_t* m, uint32_t* out, size_t n, unsigned int level, unsigned int connectivity, morton_boundary boundary) {
+		return m2D_neighbours_AVX2(m, out, n, level, connectivity, boundary);
+	}
+	inline size_t morton2D_64_neighbours(const uint64_t* m, uint64_t* out, size_t n, unsigned int level, unsigned int connectivity, morton_boundary boundary) {
+		return m2D_neighbours_AVX2(m, out, n, level, connectivity, boundary);
+	}
+	inline size_t morton3D_32_neighbours(const uint32_t* m, uint32_t* out, size_t n, unsigned int level, unsigned int connectivity, morton_boundary boundary) {
+		return m3D_neighbours_AVX2(m, out, n, level, connectivity, boundary);
+	}
+	inline size_t morton3D_64_neighbours(const uint64_t* m, uint64_t* out, size_t n, unsigned int level, unsigned int connectivity, morton_boundary boundary) {
+		return m3D_neighbours_AVX2(m, out, n, level, connectivity, boundary);
+	}
+#else
+	inline size_t morton2D_32_neighbours(const uint32_t* m, uint32_t* out, size_t n, unsigned int level, unsigned int connectivity, morton_boundary boundary) {
+		return m2D_neighbours<uint32_t>(m, out, n, level, connectivity, boundary);
+	}
+	inline size_t morton2D_64_neighbours(const uint64_t* m, uint64_t* out, size_t n, unsigned int level, unsigned int connectivity, morton_boundary boundary) {
+		return m2D_neighbours<uint64_t>(m, out, n, level, connectivity, boundary);
+	}
+	inline size_t morton3D_32_neighbours(const uint32_t* m, uint32_t* out, size_t n, unsigned int level, unsigned int connectivity, morton_boundary boundary) {
+		return m3D_neighbours<uint32_t>(m, out, n, level, connectivity, boundary);
+	}
+	inline size_t morton3D_64_neighbours(const uint64_t* m, uint64_t* out, size_t n, unsigned int level, unsigned int connectivity, morton_boundary boundary) {
+		return m3D_neighbours<uint64_t>(m, out, n, level, connectivity, boundary);
+	}
+#endif
+	// N-DIMENSIONAL ENCODING / DECODING
+	// libmorton::encode<4, uint64_t, uint16_t>(x, y, z, t) / libmorton::decode<4, uint64_t, uint16_t>(m, x, y, z, t)
+	// Bits per coordinate: sizeof(morton) * 8 / dims (see mortonND.h)
+	template<unsigned int dims, typename morton, typename coord, typename... coords>
+	inline morton encode(coords... c) {
+#if defined(LIBMORTON_USE_BMI2)
+		return mND_e_BMI<dims, morton, coord>(c...);
+#else
+		return mND_e_magicbits<dims, morton, coord>(c...);
+#endif
+	}
+	template<unsigned int dims, typename morton, typename coord, typename... coords>
+	inline void decode(const morton m, coords&... c) {
+#if defined(LIBMORTON_USE_BMI2)
+		mND_d_BMI<dims, morton, coord>(m, c...);
+#else
+		mND_d_magicbits<dims, morton, coord>(m, c...);
 #endif
-}
\ No newline at end of file
+	}
+
+	// ANISOTROPIC ENCODING / DECODING
+	// libmorton::encode_aniso<uint64_t, uint32_t, 24, 24, 16>(x, y, z) / libmorton::decode_aniso<uint64_t, uint32_t, 24, 24, 16>(m, x, y, z)
+	// Every axis gets its own number of bits, interleaved round-robin over the axes that have bits left (see mortonND.h)
+	template<typename morton, typename coord, unsigned int... bits>
+	inline morton encode_aniso(typename aniso_detail::axis_coord<coord, bits>::type... c) {
+#if defined(LIBMORTON_USE_BMI2)
+		return mAniso_e_BMI<morton, coord, bits...>(c...);
+#else
+		return mAniso_e_magicbits<morton, coord, bits...>(c...);
+#endif
+	}
+	template<typename morton, typename coord, unsigned int... bits>
+	inline void decode_aniso(const morton m, typename aniso_detail::axis_coord<coord, bits>::type&... c) {
+#if defined(LIBMORTON_USE_BMI2)
+		mAniso_d_BMI<morton, coord, bits...>(m, c...);
+#else
+		mAniso_d_magicbits<morton, coord, bits...>(m, c...);
+#endif
+	}
+}
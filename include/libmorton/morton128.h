@@ -0,0 +1,226 @@
+#pragma once
+
+// Libmorton - Methods to encode/decode 128-bit morton codes from/to 64-bit (x,y) and 42-bit (x,y,z) coordinates
+// A 128-bit code is two 64-bit codes: the lower half of every coordinate (32 bits in 2D, 21 bits in 3D) makes up the lower
+// 64 (2D) or 63 (3D) bits of the code, and the upper half the bits above that. Every method encodes a 128-bit code with
+// two calls to the 64-bit method (two pdep's per coordinate for BMI2), so it costs about twice as much as a 64-bit code.
+// morton128_t is unsigned __int128 on compilers that have it (GCC, Clang), and a struct of two 64-bit words with the same
+// operators elsewhere (or when LIBMORTON_NO_INT128 is defined). Both sort like the 128-bit number, with operator<.
+// The dilated arithmetic, BIGMIN / LITMAX, box scans, box intervals, box iterators and morton_sort take 128-bit codes too.
+// Warning: morton.h will always point to the functions that use the fastest available method.
+
+#include <stdint.h>
+#include <type_traits>
+#include "morton_common.h"
+#include "morton2D.h"
+#include "morton3D.h"
+#if defined(__BMI2__) || defined(__AVX2__) || defined(LIBMORTON_RUNTIME_DISPATCH)
+#include "morton_BMI.h"
+#endif
+
+namespace libmorton {
+
+#if defined(__SIZEOF_INT128__) && !defined(LIBMORTON_NO_INT128)
+	__extension__ typedef unsigned __int128 morton128_t;
+
+	// HELPER METHODS: build a 128-bit code from two 64-bit words, and get them back
+	inline morton128_t morton128_make(const uint64_t hi, const uint64_t lo) {
+		return (static_cast<morton128_t>(hi) << 64) | lo;
+	}
+	inline uint64_t morton128_hi(const morton128_t m) { return static_cast<uint64_t>(m >> 64); }
+	inline uint64_t morton128_lo(const morton128_t m) { return static_cast<uint64_t>(m); }
+#else
+	// A 128-bit unsigned integer, with the operators the morton code methods use
+	struct morton128_t {
+		uint64_t lo;
+		uint64_t hi;
+
+		morton128_t() : lo(0), hi(0) {}
+		morton128_t(const uint64_t lo) : lo(lo), hi(0) {}
+		morton128_t(const uint64_t hi, const uint64_t lo) : lo(lo), hi(hi) {}
+
+		explicit operator bool() const { return (lo | hi) != 0; }
+		// conversion to a narrower integer keeps the lower bits
+		template<typename T, typename = typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type>
+		explicit operator T() const { return static_cast<T>(lo); }
+
+		friend morton128_t operator~(const morton128_t a) { return morton128_t(~a.hi, ~a.lo); }
+		friend morton128_t operator&(const morton128_t a, const morton128_t b) { return morton128_t(a.hi & b.hi, a.lo & b.lo); }
+		friend morton128_t operator|(const morton128_t a, const morton128_t b) { return morton128_t(a.hi | b.hi, a.lo | b.lo); }
+		friend morton128_t operator^(const morton128_t a, const morton128_t b) { return morton128_t(a.hi ^ b.hi, a.lo ^ b.lo); }
+		friend morton128_t operator<<(const morton128_t a, const unsigned int s) {
+			if (s == 0) { return a; }
+			if (s >= 64) { return morton128_t(a.lo << (s - 64), 0); }
+			return morton128_t((a.hi << s) | (a.lo >> (64 - s)), a.lo << s);
+		}
+		friend morton128_t operator>>(const morton128_t a, const unsigned int s) {
+			if (s == 0) { return a; }
+			if (s >= 64) { return morton128_t(0, a.hi >> (s - 64)); }
+			return morton128_t(a.hi >> s, (a.lo >> s) | (a.hi << (64 - s)));
+		}
+		friend morton128_t operator+(const morton128_t a, const morton128_t b) {
+			const uint64_t lo = a.lo + b.lo;
+			return morton128_t(a.hi + b.hi + (lo < a.lo ? 1 : 0), lo);
+		}
+		friend morton128_t operator-(const morton128_t a, const morton128_t b) {
+			return morton128_t(a.hi - b.hi - (a.lo < b.lo ? 1 : 0), a.lo - b.lo);
+		}
+		friend bool operator==(const morton128_t a, const morton128_t b) { return a.lo == b.lo && a.hi == b.hi; }
+		friend bool operator!=(const morton128_t a, const morton128_t b) { return !(a == b); }
+		friend bool operator<(const morton128_t a, const morton128_t b) { return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo); }
+		friend bool operator>(const morton128_t a, const morton128_t b) { return b < a; }
+		friend bool operator<=(const morton128_t a, const morton128_t b) { return !(b < a); }
+		friend bool operator>=(const morton128_t a, const morton128_t b) { return !(a < b); }
+
+		morton128_t& operator&=(const morton128_t b) { return *this = *this & b; }
+		morton128_t& operator|=(const morton128_t b) { return *this = *this | b; }
+		morton128_t& operator^=(const morton128_t b) { return *this = *this ^ b; }
+		morton128_t& operator+=(const morton128_t b) { return *this = *this + b; }
+		morton128_t& operator-=(const morton128_t b) { return *this = *this - b; }
+		morton128_t& operator<<=(const unsigned int s) { return *this = *this << s; }
+		morton128_t& operator>>=(const unsigned int s) { return *this = *this >> s; }
+		morton128_t& operator++() { return *this += 1; }
+		morton128_t& operator--() { return *this -= 1; }
+		morton128_t operator++(int) { const morton128_t m = *this; *this += 1; return m; }
+		morton128_t operator--(int) { const morton128_t m = *this; *this -= 1; return m; }
+	};
+
+	// HELPER METHODS: build a 128-bit code from two 64-bit words, and get them back
+	inline morton128_t morton128_make(const uint64_t hi, const uint64_t lo) { return morton128_t(hi, lo); }
+	inline uint64_t morton128_hi(const morton128_t m) { return m.hi; }
+	inline uint64_t morton128_lo(const morton128_t m) { return m.lo; }
+#endif
+
+	// HELPER METHOD: the highest set bit of a 128-bit code, from the highest set bit of its words
+	template<>
+	inline bool findFirstSetBitZeroIdx<morton128_t>(const morton128_t x, unsigned long* firstbit_location) {
+		if (findFirstSetBitZeroIdx<uint64_t>(morton128_hi(x), firstbit_location)) {
+			*firstbit_location += 64;
+			return true;
+		}
+		return findFirstSetBitZeroIdx<uint64_t>(morton128_lo(x), firstbit_location);
+	}
+
+	namespace morton128_detail {
+		static const uint_fast64_t mask2D = 0xFFFFFFFF; // lower half of a 2D coordinate
+		static const uint_fast64_t mask3D = 0x1FFFFF; // lower half of a 3D coordinate
+
+		// A 3D code from the 64-bit codes of the lower and the upper halves of the coordinates (the upper one starts at bit 63)
+		inline morton128_t join3D(const uint_fast64_t lo, const uint_fast64_t hi) {
+			return morton128_make(hi >> 1, lo | (hi << 63));
+		}
+		inline uint_fast64_t lower3D(const morton128_t m) { return morton128_lo(m) & 0x7FFFFFFFFFFFFFFF; }
+		inline uint_fast64_t upper3D(const morton128_t m) { return (morton128_hi(m) << 1) | (morton128_lo(m) >> 63); }
+
+		// A coordinate from its lower and upper half
+		inline uint_fast64_t coord2D(const uint_fast32_t lo, const uint_fast32_t hi) { return (lo & mask2D) | (static_cast<uint_fast64_t>(hi) << 32); }
+		inline uint_fast64_t coord3D(const uint_fast32_t lo, const uint_fast32_t hi) { return (lo & mask3D) | (static_cast<uint_fast64_t>(hi) << 21); }
+	}  // namespace morton128_detail
+
+	// ENCODE 2D 128-bit Morton code : Magic bits method
+	inline morton128_t m2D_e_magicbits_128(const uint_fast64_t x, const uint_fast64_t y) {
+		using namespace morton128_detail;
+		return morton128_make(m2D_e_magicbits<uint_fast64_t, uint_fast32_t>(static_cast<uint_fast32_t>(x >> 32), static_cast<uint_fast32_t>(y >> 32)),
+			m2D_e_magicbits<uint_fast64_t, uint_fast32_t>(static_cast<uint_fast32_t>(x & mask2D), static_cast<uint_fast32_t>(y & mask2D)));
+	}
+
+	// ENCODE 2D 128-bit Morton code : Pre-Shifted LUT method
+	inline morton128_t m2D_e_sLUT_128(const uint_fast64_t x, const uint_fast64_t y) {
+		using namespace morton128_detail;
+		return morton128_make(m2D_e_sLUT<uint_fast64_t, uint_fast32_t>(static_cast<uint_fast32_t>(x >> 32), static_cast<uint_fast32_t>(y >> 32)),
+			m2D_e_sLUT<uint_fast64_t, uint_fast32_t>(static_cast<uint_fast32_t>(x & mask2D), static_cast<uint_fast32_t>(y & mask2D)));
+	}
+
+	// ENCODE 3D 128-bit Morton code : Magic bits method (coordinates up to 42 bits)
+	inline morton128_t m3D_e_magicbits_128(const uint_fast64_t x, const uint_fast64_t y, const uint_fast64_t z) {
+		using namespace morton128_detail;
+		return join3D(m3D_e_magicbits<uint_fast64_t, uint_fast32_t>(static_cast<uint_fast32_t>(x & mask3D), static_cast<uint_fast32_t>(y & mask3D), static_cast<uint_fast32_t>(z & mask3D)),
+			m3D_e_magicbits<uint_fast64_t, uint_fast32_t>(static_cast<uint_fast32_t>((x >> 21) & mask3D), static_cast<uint_fast32_t>((y >> 21) & mask3D), static_cast<uint_fast32_t>((z >> 21) & mask3D)));
+	}
+
+	// ENCODE 3D 128-bit Morton code : Pre-Shifted LUT method (coordinates up to 42 bits)
+	inline morton128_t m3D_e_sLUT_128(const uint_fast64_t x, const uint_fast64_t y, const uint_fast64_t z) {
+		using namespace morton128_detail;
+		return join3D(m3D_e_sLUT<uint_fast64_t, uint_fast32_t>(static_cast<uint_fast32_t>(x & mask3D), static_cast<uint_fast32_t>(y & mask3D), static_cast<uint_fast32_t>(z & mask3D)),
+			m3D_e_sLUT<uint_fast64_t, uint_fast32_t>(static_cast<uint_fast32_t>((x >> 21) & mask3D), static_cast<uint_fast32_t>((y >> 21) & mask3D), static_cast<uint_fast32_t>((z >> 21) & mask3D)));
+	}
+
+	// DECODE 2D 128-bit Morton code : Magic bits method
+	inline void m2D_d_magicbits_128(const morton128_t m, uint_fast64_t& x, uint_fast64_t& y) {
+		using namespace morton128_detail;
+		uint_fast32_t xl, yl, xh, yh;
+		m2D_d_magicbits<uint_fast64_t, uint_fast32_t>(morton128_lo(m), xl, yl);
+		m2D_d_magicbits<uint_fast64_t, uint_fast32_t>(morton128_hi(m), xh, yh);
+		x = coord2D(xl, xh);
+		y = coord2D(yl, yh);
+	}
+
+	// DECODE 2D 128-bit Morton code : Pre-Shifted LUT method
+	inline void m2D_d_sLUT_128(const morton128_t m, uint_fast64_t& x, uint_fast64_t& y) {
+		using namespace morton128_detail;
+		uint_fast32_t xl, yl, xh, yh;
+		m2D_d_sLUT<uint_fast64_t, uint_fast32_t>(morton128_lo(m), xl, yl);
+		m2D_d_sLUT<uint_fast64_t, uint_fast32_t>(morton128_hi(m), xh, yh);
+		x = coord2D(xl, xh);
+		y = coord2D(yl, yh);
+	}
+
+	// DECODE 3D 128-bit Morton code : Magic bits method
+	inline void m3D_d_magicbits_128(const morton128_t m, uint_fast64_t& x, uint_fast64_t& y, uint_fast64_t& z) {
+		using namespace morton128_detail;
+		uint_fast32_t xl, yl, zl, xh, yh, zh;
+		m3D_d_magicbits<uint_fast64_t, uint_fast32_t>(lower3D(m), xl, yl, zl);
+		m3D_d_magicbits<uint_fast64_t, uint_fast32_t>(upper3D(m), xh, yh, zh);
+		x = coord3D(xl, xh);
+		y = coord3D(yl, yh);
+		z = coord3D(zl, zh);
+	}
+
+	// DECODE 3D 128-bit Morton code : Pre-Shifted LUT method
+	inline void m3D_d_sLUT_128(const morton128_t m, uint_fast64_t& x, uint_fast64_t& y, uint_fast64_t& z) {
+		using namespace morton128_detail;
+		uint_fast32_t xl, yl, zl, xh, yh, zh;
+		m3D_d_sLUT<uint_fast64_t, uint_fast32_t>(lower3D(m), xl, yl, zl);
+		m3D_d_sLUT<uint_fast64_t, uint_fast32_t>(upper3D(m), xh, yh, zh);
+		x = coord3D(xl, xh);
+		y = coord3D(yl, yh);
+		z = coord3D(zl, zh);
+	}
+
+#if defined(__BMI2__) || defined(__AVX2__) || defined(LIBMORTON_RUNTIME_DISPATCH)
+	// ENCODE 2D 128-bit Morton code : BMI2 instruction set (two pdep's per coordinate)
+	LIBMORTON_TARGET("bmi2") inline morton128_t m2D_e_BMI_128(const uint_fast64_t x, const uint_fast64_t y) {
+		using namespace morton128_detail;
+		return morton128_make(m2D_e_BMI<uint_fast64_t, uint_fast32_t>(static_cast<uint_fast32_t>(x >> 32), static_cast<uint_fast32_t>(y >> 32)),
+			m2D_e_BMI<uint_fast64_t, uint_fast32_t>(static_cast<uint_fast32_t>(x & mask2D), static_cast<uint_fast32_t>(y & mask2D)));
+	}
+
+	// ENCODE 3D 128-bit Morton code : BMI2 instruction set (two pdep's per coordinate)
+	LIBMORTON_TARGET("bmi2") inline morton128_t m3D_e_BMI_128(const uint_fast64_t x, const uint_fast64_t y, const uint_fast64_t z) {
+		using namespace morton128_detail;
+		return join3D(m3D_e_BMI<uint_fast64_t, uint_fast32_t>(static_cast<uint_fast32_t>(x & mask3D), static_cast<uint_fast32_t>(y & mask3D), static_cast<uint_fast32_t>(z & mask3D)),
+			m3D_e_BMI<uint_fast64_t, uint_fast32_t>(static_cast<uint_fast32_t>((x >> 21) & mask3D), static_cast<uint_fast32_t>((y >> 21) & mask3D), static_cast<uint_fast32_t>((z >> 21) & mask3D)));
+	}
+
+	// DECODE 2D 128-bit Morton code : BMI2 instruction set (two pext's per coordinate)
+	LIBMORTON_TARGET("bmi2") inline void m2D_d_BMI_128(const morton128_t m, uint_fast64_t& x, uint_fast64_t& y) {
+		using namespace morton128_detail;
+		uint_fast32_t xl, yl, xh, yh;
+		m2D_d_BMI<uint_fast64_t, uint_fast32_t>(morton128_lo(m), xl, yl);
+		m2D_d_BMI<uint_fast64_t, uint_fast32_t>(morton128_hi(m), xh, yh);
+		x = coord2D(xl, xh);
+		y = coord2D(yl, yh);
+	}
+
+	// DECODE 3D 128-bit Morton code : BMI2 instruction set (two pext's per coordinate)
+	LIBMORTON_TARGET("bmi2") inline void m3D_d_BMI_128(const morton128_t m, uint_fast64_t& x, uint_fast64_t& y, uint_fast64_t& z) {
+		using namespace morton128_detail;
+		uint_fast32_t xl, yl, zl, xh, yh, zh;
+		m3D_d_BMI<uint_fast64_t, uint_fast32_t>(lower3D(m), xl, yl, zl);
+		m3D_d_BMI<uint_fast64_t, uint_fast32_t>(upper3D(m), xh, yh, zh);
+		x = coord3D(xl, xh);
+		y = coord3D(yl, yh);
+		z = coord3D(zl, zh);
+	}
+#endif
+}
@@ -14,12 +14,12 @@
 namespace libmorton {
 
 	// Encode methods
-	template<typename morton, typename coord> inline morton m2D_e_sLUT(const coord x, const coord y);
+	template<typename morton, typename coord> constexpr morton m2D_e_sLUT(const coord x, const coord y);
 	template<typename morton, typename coord> inline morton m2D_e_sLUT_ET(const coord x, const coord y);
-	template<typename morton, typename coord> inline morton m2D_e_LUT(const coord x, const coord y);
+	template<typename morton, typename coord> constexpr morton m2D_e_LUT(const coord x, const coord y);
 	template<typename morton, typename coord> inline morton m2D_e_LUT_ET(const coord x, const coord y);
-	template<typename morton, typename coord> inline morton m2D_e_magicbits(const coord x, const coord y);
-	template<typename morton, typename coord> inline morton m2D_e_for(const coord x, const coord y);
+	template<typename morton, typename coord> constexpr morton m2D_e_magicbits(const coord x, const coord y);
+	template<typename morton, typename coord> constexpr morton m2D_e_for(const coord x, const coord y);
 	template<typename morton, typename coord> inline morton m2D_e_for_ET(const coord x, const coord y);
 
 	// Decode methods
@@ -30,37 +30,32 @@ namespace libmorton {
 	template<typename morton, typename coord> inline void m2D_d_magicbits(const morton m, coord& x, coord& y);
 	template<typename morton, typename coord> inline void m2D_d_for(const morton m, coord& x, coord& y);
 
+	// HELPER METHOD for LUT encoding: byte i of both coordinates and up, 16 bits of the code per byte
+	// (bytes that land above the width of the morton type are dropped)
+	template<typename morton, typename coord>
+	constexpr morton morton2D_EncodeCoords_LUT256(const coord x, const coord y, const uint16_t* LUTx, const uint16_t* LUTy, const unsigned int yshift, const unsigned int i = 0) {
+		return (i >= sizeof(coord) || i * 16 >= sizeof(morton) * 8) ? static_cast<morton>(0) :
+			static_cast<morton>(static_cast<morton>(
+				static_cast<morton>(static_cast<morton>(LUTy[(y >> (i * 8)) & EIGHTBITMASK]) << yshift) |
+				static_cast<morton>(LUTx[(x >> (i * 8)) & EIGHTBITMASK])) << (i * 16)
+			| morton2D_EncodeCoords_LUT256<morton, coord>(x, y, LUTx, LUTy, yshift, i + 1));
+	}
+
 	// ENCODE 2D Morton code : Pre-shifted LookUpTable (sLUT)
 	template<typename morton, typename coord>
-	inline morton m2D_e_sLUT(const coord x, const coord y) {
-		morton answer = 0;
-		for (unsigned int i = sizeof(coord); i > 0; --i) {
-			unsigned int shift = (i - 1) * 8;
-			answer =
-				answer << 16 |
-				Morton2D_encode_y_256[(y >> shift) & EIGHTBITMASK] |
-				Morton2D_encode_x_256[(x >> shift) & EIGHTBITMASK];
-		}
-		return answer;
+	constexpr morton m2D_e_sLUT(const coord x, const coord y) {
+		return morton2D_EncodeCoords_LUT256<morton, coord>(x, y, Morton2D_encode_x_256, Morton2D_encode_y_256, 0);
 	}
 
 	// ENCODE 2D Morton code : LookUpTable (LUT)
 	template<typename morton, typename coord>
-	inline morton m2D_e_LUT(const coord x, const coord y) {
-		morton answer = 0;
-		for (unsigned int i = sizeof(coord); i > 0; --i) {
-			unsigned int shift = (i - 1) * 8;
-			answer =
-				answer << 16 |
-				(Morton2D_encode_x_256[(y >> shift) & EIGHTBITMASK] << morton(1)) |
-				(Morton2D_encode_x_256[(x >> shift) & EIGHTBITMASK]);
-		}
-		return answer;
+	constexpr morton m2D_e_LUT(const coord x, const coord y) {
+		return morton2D_EncodeCoords_LUT256<morton, coord>(x, y, Morton2D_encode_x_256, Morton2D_encode_x_256, 1);
 	}
 
 	// HELPER METHOD for Early Termination LUT Encode
 	template<typename morton, typename coord>
-	inline morton compute2D_ET_LUT_encode(const coord c, const coord *LUT) {
+	inline morton compute2D_ET_LUT_encode(const coord c, const uint16_t *LUT) {
 		unsigned long maxbit = 0;
 		if (findFirstSetBit<coord>(c, &maxbit) == 0) { return 0; }
 		morton answer = 0;
@@ -91,57 +86,68 @@ namespace libmorton {
 	}
 
 	// Magicbits masks (2D encode)
-	static uint_fast32_t magicbit2D_masks32[6] = { 0xFFFFFFFF, 0x0000FFFF, 0x00FF00FF, 0x0F0F0F0F, 0x33333333, 0x55555555 };
-	static uint_fast64_t magicbit2D_masks64[6] = { 0x00000000FFFFFFFF, 0x0000FFFF0000FFFF, 0x00FF00FF00FF00FF, 0x0F0F0F0F0F0F0F0F, 0x3333333333333333, 0x5555555555555555 };
+	// constexpr, so the masks are immediates in the generated code and the methods below work in constant expressions
+	static constexpr uint_fast32_t magicbit2D_masks32[6] = { 0xFFFFFFFF, 0x0000FFFF, 0x00FF00FF, 0x0F0F0F0F, 0x33333333, 0x55555555 };
+	static constexpr uint_fast64_t magicbit2D_masks64[6] = { 0x00000000FFFFFFFF, 0x0000FFFF0000FFFF, 0x00FF00FF00FF00FF, 0x0F0F0F0F0F0F0F0F, 0x3333333333333333, 0x5555555555555555 };
+
+	// HELPER METHOD: pick a Magic bits mask for the width of the morton type
+	template<typename morton>
+	constexpr morton morton2D_Mask(const unsigned int i) {
+		return (sizeof(morton) <= 4) ? static_cast<morton>(magicbit2D_masks32[i]) : static_cast<morton>(magicbit2D_masks64[i]);
+	}
+
+	// HELPER METHOD for Magic bits encoding: the split steps from mask i on (shifts 32, 16, 8, 4, 2, 1)
+	template<typename morton>
+	constexpr morton morton2D_Split(const morton x, const unsigned int i) {
+		return (i > 5) ? x : morton2D_Split<morton>(static_cast<morton>((x | static_cast<morton>(x << (32u >> i))) & morton2D_Mask<morton>(i)), i + 1);
+	}
 
 	// HELPER METHOD for Magic bits encoding - split by 2
 	template<typename morton, typename coord>
-	inline morton morton2D_SplitBy2Bits(const coord a) {
-		const morton* masks = (sizeof(morton) <= 4) ? reinterpret_cast<const morton*>(magicbit2D_masks32) : reinterpret_cast<const morton*>(magicbit2D_masks64);
-		morton x = a;
-		if (sizeof(morton) > 4) { x = (x | (uint_fast64_t)x << 32) & masks[0]; }
-		x = (x | x << 16) & masks[1];
-		x = (x | x << 8) & masks[2];
-		x = (x | x << 4) & masks[3];
-		x = (x | x << 2) & masks[4];
-		x = (x | x << 1) & masks[5];
-		return x;
+	constexpr morton morton2D_SplitBy2Bits(const coord a) {
+		return morton2D_Split<morton>(static_cast<morton>(a), (sizeof(morton) > 4) ? 0 : 1);
 	}
 
 	// ENCODE 2D Morton code : Magic bits
 	template<typename morton, typename coord>
-	inline morton m2D_e_magicbits(const coord x, const coord y) {
+	constexpr morton m2D_e_magicbits(const coord x, const coord y) {
 		return morton2D_SplitBy2Bits<morton, coord>(x) | (morton2D_SplitBy2Bits<morton, coord>(y) << 1);
 	}
 
+	// HELPER METHOD: merge the split x (lower 32 bits) and y (upper 32 bits) of m2D_e_magicbits_combined
+	// hard cut off to 32 bits, because on some systems uint_fast32_t will be a 64-bit type, and we don't want to retain split Y-version in the upper 32 bits.
+	constexpr uint_fast32_t morton2D_MergeCombined(const uint_fast64_t m) {
+		return uint_fast32_t((m | (m >> 31)) & 0x00000000FFFFFFFF);
+	}
+
 	// ENCODE 2D 32-bit morton code - alternative version by JarkkoPFC - https://gist.github.com/JarkkoPFC/0e4e599320b0cc7ea92df45fb416d79a
-	// This uses the same technique as the magicbits method, but uses the upper part of a 64-bit type to split the y coordinate, 
+	// This uses the same technique as the magicbits method, but uses the upper part of a 64-bit type to split the y coordinate,
 	// the lower part to split the x coordinate, then merges them back together.
-	inline uint_fast32_t m2D_e_magicbits_combined(uint_fast16_t x, uint_fast16_t y) {
-		uint_fast64_t m = x | (uint_fast64_t(y) << 32); // put Y in upper 32 bits, X in lower 32 bits
-		m = (m | (m << 8)) & magicbit2D_masks64[2];
-		m = (m | (m << 4)) & magicbit2D_masks64[3];
-		m = (m | (m << 2)) & magicbit2D_masks64[4];
-		m = (m | (m << 1)) & magicbit2D_masks64[5];
-		m = m | (m >> 31); // merge X and Y back together
-		// hard cut off to 32 bits, because on some systems uint_fast32_t will be a 64-bit type, and we don't want to retain split Y-version in the upper 32 bits.
-		m = m & 0x00000000FFFFFFFF; 
-		return uint_fast32_t(m);
+	// (morton / coord are the storage types of the code and the coordinates: uint32_t / uint16_t or uint_fast32_t / uint_fast16_t)
+	template<typename morton, typename coord>
+	constexpr morton m2D_e_magicbits_combined(const coord x, const coord y) {
+		// put Y in upper 32 bits, X in lower 32 bits, and split both with the last four steps (shifts 8, 4, 2, 1)
+		return static_cast<morton>(morton2D_MergeCombined(morton2D_Split<uint_fast64_t>(static_cast<uint_fast64_t>(x) | (static_cast<uint_fast64_t>(y) << 32), 2)));
+	}
+	constexpr uint_fast32_t m2D_e_magicbits_combined(uint_fast16_t x, uint_fast16_t y) {
+		return m2D_e_magicbits_combined<uint_fast32_t, uint_fast16_t>(x, y);
+	}
+
+	// HELPER METHOD for For Loop encoding: bit i of both coordinates and up
+	template<typename morton, typename coord>
+	constexpr morton morton2D_EncodeBits_for(const coord x, const coord y, const unsigned int i = 0) {
+		// Here we need to cast 0x1 to 64bits, otherwise there is a bug when morton code is larger than 32 bits
+		// (shift back i and forth 2*i)
+		return (i >= sizeof(morton) * 4) ? static_cast<morton>(0) :
+			static_cast<morton>(static_cast<morton>((x & (static_cast<morton>(0x1) << i)) << i)
+				| static_cast<morton>((y & (static_cast<morton>(0x1) << i)) << (i + 1))
+				| morton2D_EncodeBits_for<morton, coord>(x, y, i + 1));
 	}
 
 	// ENCODE 2D Morton code : For Loop
 	template<typename morton, typename coord>
-	inline morton m2D_e_for(const coord x, const coord y) {
-		morton answer = 0;
-		unsigned int checkbits = (unsigned int)floor(sizeof(morton) * 4.0f);
-		for (unsigned int i = 0; i < checkbits; ++i) {
-			morton mshifted = static_cast<morton>(0x1) << i; // Here we need to cast 0x1 to 64bits, otherwise there is a bug when morton code is larger than 32 bits
-			unsigned int shift = i; // because you have to shift back i and forth 2*i
-			answer |=
-				((x & mshifted) << shift)
-				| ((y & mshifted) << (shift + 1));
-		}
-		return answer;
+	constexpr morton m2D_e_for(const coord x, const coord y) {
+		return morton2D_EncodeBits_for<morton, coord>(x, y);
 	}
 
 	// ENCODE 2D Morton code : For Loop (Early termination version)
@@ -162,15 +168,18 @@ namespace libmorton {
 		return answer;
 	}
 
+	// HELPER METHOD for LUT decoding: the bits of one coordinate in byte i of the code and up
+	template<typename morton>
+	constexpr morton morton2D_DecodeBits_LUT256(const morton m, const uint8_t *LUT, const unsigned int startshift, const unsigned int i) {
+		return (i >= sizeof(morton)) ? static_cast<morton>(0) :
+			static_cast<morton>(static_cast<morton>(static_cast<morton>(LUT[(m >> ((i * 8) + startshift)) & EIGHTBITMASK]) << (4 * i))
+				| morton2D_DecodeBits_LUT256<morton>(m, LUT, startshift, i + 1));
+	}
+
 	// HELPER METHODE for LUT decoding
 	template<typename morton, typename coord>
-	inline coord morton2D_DecodeCoord_LUT256(const morton m, const uint_fast8_t *LUT, const unsigned int startshift) {
-		morton a = 0;
-		unsigned int loops = sizeof(morton);
-		for (unsigned int i = 0; i < loops; ++i) {
-			a |= ((morton)LUT[(m >> ((i * 8) + startshift)) & EIGHTBITMASK] << (4 * i));
-		}
-		return static_cast<coord>(a);
+	constexpr coord morton2D_DecodeCoord_LUT256(const morton m, const uint8_t *LUT, const unsigned int startshift) {
+		return static_cast<coord>(morton2D_DecodeBits_LUT256<morton>(m, LUT, startshift, 0));
 	}
 
 	// DECODE 2D Morton code : Shifted LUT
@@ -220,17 +229,16 @@ namespace libmorton {
 		}
 	}
 
+	// HELPER method for Magicbits decoding: the compaction steps from mask i down (shifts 1, 2, 4, 8, 16)
+	template<typename morton>
+	constexpr morton morton2D_Compact(const morton x, const unsigned int i) {
+		return (i < ((sizeof(morton) > 4) ? 0u : 1u) || i > 4) ? x : morton2D_Compact<morton>(static_cast<morton>((x ^ (x >> (16u >> i))) & morton2D_Mask<morton>(i)), i - 1);
+	}
+
 	// HELPER method for Magicbits decoding
 	template<typename morton, typename coord>
-	static inline coord morton2D_GetSecondBits(const morton m) {
-		morton* masks = (sizeof(morton) <= 4) ? reinterpret_cast<morton*>(magicbit2D_masks32) : reinterpret_cast<morton*>(magicbit2D_masks64);
-		morton x = m & masks[5];
-		x = (x ^ (x >> 1)) & masks[4];
-		x = (x ^ (x >> 2)) & masks[3];
-		x = (x ^ (x >> 4)) & masks[2];
-		x = (x ^ (x >> 8)) & masks[1];
-		if (sizeof(morton) > 4) x = (x ^ (x >> 16)) & masks[0];
-		return static_cast<coord>(x);
+	static constexpr coord morton2D_GetSecondBits(const morton m) {
+		return static_cast<coord>(morton2D_Compact<morton>(static_cast<morton>(m & morton2D_Mask<morton>(5)), 4));
 	}
 
 	// DECODE 2D Morton code : Magic bits
@@ -242,27 +250,32 @@ namespace libmorton {
 	}
 
 	// DECODE 2D 32-bit morton code - alternative version by JarkkoPFC - https://gist.github.com/JarkkoPFC/0e4e599320b0cc7ea92df45fb416d79a
-	inline void m2D_d_magicbits_combined(const uint_fast32_t morton, uint_fast16_t& x, uint_fast16_t& y) {
-		uint_fast64_t res = (morton | (uint_fast64_t(morton) << 31)) & magicbit2D_masks64[5];
+	template<typename morton, typename coord>
+	inline void m2D_d_magicbits_combined(const morton m, coord& x, coord& y) {
+		uint_fast64_t res = (m | (uint_fast64_t(m) << 31)) & magicbit2D_masks64[5];
 		res = (res | (res >> 1)) & magicbit2D_masks64[4];
 		res = (res | (res >> 2)) & magicbit2D_masks64[3];
 		res = (res | (res >> 4)) & magicbit2D_masks64[2];
 		res = res | (res >> 8);
-		x = uint_fast16_t(res) & 0xFFFF;
-		y = (uint_fast16_t(res >> 32)) & 0xFFFF;
+		x = static_cast<coord>(res & 0xFFFF);
+		y = static_cast<coord>((res >> 32) & 0xFFFF);
+	}
+	inline void m2D_d_magicbits_combined(const uint_fast32_t morton, uint_fast16_t& x, uint_fast16_t& y) {
+		m2D_d_magicbits_combined<uint_fast32_t, uint_fast16_t>(morton, x, y);
+	}
+
+	// HELPER METHOD for For loop decoding: bit i of one axis (0 = x, 1 = y) and up
+	template<typename morton, typename coord>
+	constexpr coord morton2D_DecodeCoord_for(const morton m, const unsigned int axis, const unsigned int i = 0) {
+		return (i >= sizeof(morton) * 4) ? static_cast<coord>(0) :
+			static_cast<coord>(static_cast<coord>((m & (static_cast<morton>(1) << (2 * i + axis))) >> (i + axis)) | morton2D_DecodeCoord_for<morton, coord>(m, axis, i + 1));
 	}
 
 	// DECODE 2D morton code : For loop
 	template<typename morton, typename coord>
 	inline void m2D_d_for(const morton m, coord& x, coord& y) {
-		x = 0; y = 0;
-		unsigned int checkbits = sizeof(morton) * 4;
-		for (unsigned int i = 0; i <= checkbits; ++i) {
-			morton selector = 1;
-			unsigned int shift_selector = 2 * i;
-			x |= (m & (selector << shift_selector)) >> i;
-			y |= (m & (selector << (shift_selector + 1))) >> (i + 1);
-		}
+		x = morton2D_DecodeCoord_for<morton, coord>(m, 0);
+		y = morton2D_DecodeCoord_for<morton, coord>(m, 1);
 	}
 
 	// DECODE 3D Morton code : For loop (Early termination version)
@@ -280,4 +293,156 @@ namespace libmorton {
 			y |= (m & (selector << (shift_selector + 1))) >> (i + 1);
 		}
 	}
+
+	// ENCODE 2D Morton codes in batch : Magicbits (portable fallback for the SIMD batch methods)
+	template<typename morton, typename coord>
+	inline void m2D_e_magicbits_batch(const coord* x, const coord* y, morton* out, size_t n) {
+		for (size_t i = 0; i < n; ++i) {
+			out[i] = m2D_e_magicbits<morton, coord>(x[i], y[i]);
+		}
+	}
+
+	// DECODE 2D Morton codes in batch : Magicbits (portable fallback for the SIMD batch methods)
+	template<typename morton, typename coord>
+	inline void m2D_d_magicbits_batch(const morton* m, coord* x, coord* y, size_t n) {
+		for (size_t i = 0; i < n; ++i) {
+			m2D_d_magicbits<morton, coord>(m[i], x[i], y[i]);
+		}
+	}
+
+	// ENCODE 2D Morton codes from strided records : Magicbits (portable fallback for the SIMD strided methods)
+	template<typename morton, typename coord>
+	inline void m2D_e_magicbits_strided(const void* base, size_t stride, size_t offx, size_t offy, morton* out, size_t n) {
+		const unsigned char* p = static_cast<const unsigned char*>(base);
+		for (size_t i = 0; i < n; ++i, p += stride) {
+			out[i] = m2D_e_magicbits<morton, coord>(loadCoord<coord>(p + offx), loadCoord<coord>(p + offy));
+		}
+	}
+
+	// HELPER METHOD: bits of one axis (0 = x, 1 = y) in a 2D morton code
+	template<typename morton>
+	inline morton morton2D_AxisMask(const unsigned int axis) {
+		const morton low = static_cast<morton>((axis == 0) ? BMI_2D_X_MASK : BMI_2D_Y_MASK);
+		// 128-bit codes (morton128.h): the same pattern in the upper 64 bits
+		return (sizeof(morton) > 8) ? static_cast<morton>(low | static_cast<morton>(low << (sizeof(morton) * 4))) : low;
+	}
+
+	// DILATED ARITHMETIC on 2D Morton codes
+	// These step through Morton space without decoding: m2D_add_x(m, m2D_e_magicbits(dx, 0)) gives the same code
+	// as encoding (x + dx, y). Coordinates wrap around at the number of bits per axis. Only the bits of the given
+	// axis are read from the delta code, so the delta can be any code: m2D_add_x(a, b) adds the x of b to the x of a.
+	template<typename morton>
+	inline morton m2D_add_x(const morton m, const morton d) {
+		return dilatedAdd<morton>(m, d, morton2D_AxisMask<morton>(0));
+	}
+	template<typename morton>
+	inline morton m2D_add_y(const morton m, const morton d) {
+		return dilatedAdd<morton>(m, d, morton2D_AxisMask<morton>(1));
+	}
+	template<typename morton>
+	inline morton m2D_sub_x(const morton m, const morton d) {
+		return dilatedSub<morton>(m, d, morton2D_AxisMask<morton>(0));
+	}
+	template<typename morton>
+	inline morton m2D_sub_y(const morton m, const morton d) {
+		return dilatedSub<morton>(m, d, morton2D_AxisMask<morton>(1));
+	}
+
+	// Step one cell along an axis (the lowest bit of each axis is bit 0 and 1 respectively)
+	template<typename morton>
+	inline morton m2D_inc_x(const morton m) {
+		return dilatedAdd<morton>(m, 1, morton2D_AxisMask<morton>(0));
+	}
+	template<typename morton>
+	inline morton m2D_inc_y(const morton m) {
+		return dilatedAdd<morton>(m, 2, morton2D_AxisMask<morton>(1));
+	}
+	template<typename morton>
+	inline morton m2D_dec_x(const morton m) {
+		return dilatedSub<morton>(m, 1, morton2D_AxisMask<morton>(0));
+	}
+	template<typename morton>
+	inline morton m2D_dec_y(const morton m) {
+		return dilatedSub<morton>(m, 2, morton2D_AxisMask<morton>(1));
+	}
+
+	// Add / subtract two codes on both axes at once: the code of (xa + xb, ya + yb)
+	template<typename morton>
+	inline morton m2D_add(const morton a, const morton b) {
+		return m2D_add_y<morton>(m2D_add_x<morton>(a, b), b);
+	}
+	template<typename morton>
+	inline morton m2D_sub(const morton a, const morton b) {
+		return m2D_sub_y<morton>(m2D_sub_x<morton>(a, b), b);
+	}
+
+	// NEIGHBOURS of 2D Morton codes in batch, in a grid of 2^level cells per axis (level up to 16 for 32-bit, 32 for 64-bit codes)
+	// Writes the 4 (edges) or 8 (+ corners) neighbours of m[i] to out[i * connectivity ...],
+	// in the order given by mortonNeighbourOffsets(2, connectivity, ...). Bits of m above the level are ignored.
+	// Returns the number of neighbours per code, or 0 (writing nothing) for an unsupported connectivity, or for
+	// morton_boundary::invalid at the full width (level 16 / 32), where the invalid marker is the code of a cell.
+	template<typename morton>
+	inline size_t m2D_neighbours(const morton* m, morton* out, size_t n, const unsigned int level, const unsigned int connectivity, const morton_boundary boundary) {
+		unsigned char offsets[26][3];
+		const unsigned int count = mortonNeighbourOffsets(2, connectivity, offsets);
+		if (count == 0 || (boundary == morton_boundary::invalid && 2 * level >= sizeof(morton) * 8)) { return 0; }
+		const morton levelmask = mortonLevelMask<morton>(2, level);
+		const morton masks[2] = { morton2D_AxisMask<morton>(0) & levelmask, morton2D_AxisMask<morton>(1) & levelmask };
+		for (size_t i = 0; i < n; ++i) {
+			morton steps[2][3];
+			for (unsigned int axis = 0; axis < 2; ++axis) {
+				mortonAxisSteps<morton>(m[i], masks[axis], boundary, steps[axis]);
+			}
+			for (unsigned int j = 0; j < count; ++j) {
+				*out++ = steps[0][offsets[j][0]] | steps[1][offsets[j][1]];
+			}
+		}
+		return count;
+	}
+
+	// BOX QUERIES on 2D Morton codes
+	// A box is given by the codes of its lowest and highest corner: zmin = encode(xmin, ymin), zmax = encode(xmax, ymax).
+	// BIGMIN: the smallest code inside the box that is larger than zcur (zcur must be smaller than zmax)
+	template<typename morton>
+	inline morton m2D_bigmin(const morton zcur, const morton zmin, const morton zmax) {
+		const morton masks[2] = { morton2D_AxisMask<morton>(0), morton2D_AxisMask<morton>(1) };
+		return mortonBigMin<morton>(zcur, zmin, zmax, masks, 2);
+	}
+	// LITMAX: the largest code inside the box that is smaller than zcur (zcur must be larger than zmin)
+	template<typename morton>
+	inline morton m2D_litmax(const morton zcur, const morton zmin, const morton zmax) {
+		const morton masks[2] = { morton2D_AxisMask<morton>(0), morton2D_AxisMask<morton>(1) };
+		return mortonLitMax<morton>(zcur, zmin, zmax, masks, 2);
+	}
+	// Is code m inside the box
+	template<typename morton>
+	inline bool m2D_in_box(const morton m, const morton zmin, const morton zmax) {
+		const morton masks[2] = { morton2D_AxisMask<morton>(0), morton2D_AxisMask<morton>(1) };
+		return mortonInBox<morton>(m, zmin, zmax, masks, 2);
+	}
+	// Call visit(begin, end) for every run of keys[begin, end) inside the box, in a sorted array of n keys.
+	// Skips from one run to the next with m2D_bigmin, so the cost is O(hits + runs * log n) instead of O(keys between zmin and zmax).
+	// Returns the number of keys inside the box.
+	template<typename morton, typename visitor>
+	inline size_t m2D_box_scan(const morton* keys, const size_t n, const morton zmin, const morton zmax, visitor visit) {
+		const morton masks[2] = { morton2D_AxisMask<morton>(0), morton2D_AxisMask<morton>(1) };
+		return mortonBoxScan<morton, visitor>(keys, n, zmin, zmax, masks, 2, visit);
+	}
+
+	// Decompose the box into the sorted intervals [lo, hi] of codes inside it, for range predicates on sorted keys.
+	// With max_intervals = 0 the result is exact and minimal, otherwise it has at most max_intervals intervals
+	// and may also hold codes outside the box (see mortonBoxIntervals). Returns the number of intervals.
+	template<typename morton>
+	inline size_t m2D_box_intervals(const morton zmin, const morton zmax, const size_t max_intervals, std::vector<morton_interval<morton> >& out) {
+		const morton masks[2] = { morton2D_AxisMask<morton>(0), morton2D_AxisMask<morton>(1) };
+		return mortonBoxIntervals<morton>(zmin, zmax, masks, 2, max_intervals, out);
+	}
+
+	// Walk the codes inside the box in increasing order without encoding them: one at a time (*it, ++it, until it.done())
+	// or in runs [lo, hi] of consecutive codes (it.next_run(run)), for bulk processing of the cells of a Morton-ordered array
+	template<typename morton>
+	inline morton_box_iterator<morton> m2D_box_iterator(const morton zmin, const morton zmax) {
+		const morton masks[2] = { morton2D_AxisMask<morton>(0), morton2D_AxisMask<morton>(1) };
+		return morton_box_iterator<morton>(zmin, zmax, masks, 2);
+	}
 }
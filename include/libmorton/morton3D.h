@@ -14,12 +14,12 @@
 
 namespace libmorton {
 	// AVAILABLE METHODS FOR ENCODING
-	template<typename morton, typename coord> inline morton m3D_e_sLUT(const coord x, const coord y, const coord z);
+	template<typename morton, typename coord> constexpr morton m3D_e_sLUT(const coord x, const coord y, const coord z);
 	template<typename morton, typename coord> inline morton m3D_e_sLUT_ET(const coord x, const coord y, const coord z);
-	template<typename morton, typename coord> inline morton m3D_e_LUT(const coord x, const coord y, const coord z);
+	template<typename morton, typename coord> constexpr morton m3D_e_LUT(const coord x, const coord y, const coord z);
 	template<typename morton, typename coord> inline morton m3D_e_LUT_ET(const coord x, const coord y, const coord z);
-	template<typename morton, typename coord> inline morton m3D_e_magicbits(const coord x, const coord y, const coord z);
-	template<typename morton, typename coord> inline morton m3D_e_for(const coord x, const coord y, const coord z);
+	template<typename morton, typename coord> constexpr morton m3D_e_magicbits(const coord x, const coord y, const coord z);
+	template<typename morton, typename coord> constexpr morton m3D_e_for(const coord x, const coord y, const coord z);
 	template<typename morton, typename coord> inline morton m3D_e_for_ET(const coord x, const coord y, const coord z);
 
 	// AVAILABLE METHODS FOR DECODING
@@ -31,39 +31,33 @@ namespace libmorton {
 	template<typename morton, typename coord> inline void m3D_d_for(const morton m, coord& x, coord& y, coord& z);
 	template<typename morton, typename coord> inline void m3D_d_for_ET(const morton m, coord& x, coord& y, coord& z);
 
+	// HELPER METHOD for LUT encoding: byte i of the three coordinates and up, 24 bits of the code per byte
+	// (bytes that land above the width of the morton type are dropped)
+	template<typename morton, typename coord>
+	constexpr morton morton3D_EncodeCoords_LUT256(const coord x, const coord y, const coord z, const uint32_t* LUTx, const uint32_t* LUTy, const uint32_t* LUTz, const unsigned int yshift, const unsigned int zshift, const unsigned int i = 0) {
+		return (i >= sizeof(coord) || i * 24 >= sizeof(morton) * 8) ? static_cast<morton>(0) :
+			static_cast<morton>(static_cast<morton>(
+				static_cast<morton>(static_cast<morton>(LUTz[(z >> (i * 8)) & EIGHTBITMASK]) << zshift) |
+				static_cast<morton>(static_cast<morton>(LUTy[(y >> (i * 8)) & EIGHTBITMASK]) << yshift) |
+				static_cast<morton>(LUTx[(x >> (i * 8)) & EIGHTBITMASK])) << (i * 24)
+			| morton3D_EncodeCoords_LUT256<morton, coord>(x, y, z, LUTx, LUTy, LUTz, yshift, zshift, i + 1));
+	}
+
 	// ENCODE 3D Morton code : Pre-Shifted LookUpTable (sLUT)
 	template<typename morton, typename coord>
-	inline morton m3D_e_sLUT(const coord x, const coord y, const coord z) {
-		morton answer = 0;
-		for (unsigned int i = sizeof(coord); i > 0; --i) {
-			unsigned int shift = (i - 1) * 8;
-			answer =
-				answer << 24 |
-				(Morton3D_encode_z_256[(z >> shift) & EIGHTBITMASK] |
-					Morton3D_encode_y_256[(y >> shift) & EIGHTBITMASK] |
-					Morton3D_encode_x_256[(x >> shift) & EIGHTBITMASK]);
-		}
-		return answer;
+	constexpr morton m3D_e_sLUT(const coord x, const coord y, const coord z) {
+		return morton3D_EncodeCoords_LUT256<morton, coord>(x, y, z, Morton3D_encode_x_256, Morton3D_encode_y_256, Morton3D_encode_z_256, 0, 0);
 	}
 
 	// ENCODE 3D Morton code : LookUpTable (LUT)
 	template<typename morton, typename coord>
-	inline morton m3D_e_LUT(const coord x, const coord y, const coord z) {
-		morton answer = 0;
-		for (unsigned int i = sizeof(coord); i > 0; --i) {
-			unsigned int shift = (i - 1) * 8;
-			answer =
-				answer << 24 |
-				(Morton3D_encode_x_256[(z >> shift) & EIGHTBITMASK] << morton(2)) |
-				(Morton3D_encode_x_256[(y >> shift) & EIGHTBITMASK] << morton(1)) |
-				Morton3D_encode_x_256[(x >> shift) & EIGHTBITMASK];
-		}
-		return answer;
+	constexpr morton m3D_e_LUT(const coord x, const coord y, const coord z) {
+		return morton3D_EncodeCoords_LUT256<morton, coord>(x, y, z, Morton3D_encode_x_256, Morton3D_encode_x_256, Morton3D_encode_x_256, 1, 2);
 	}
 
 	// HELPER METHOD for ET LUT encode
 	template<typename morton, typename coord>
-	inline morton compute3D_ET_LUT_encode(const coord c, const coord *LUT) {
+	inline morton compute3D_ET_LUT_encode(const coord c, const uint32_t *LUT) {
 		unsigned long maxbit = 0;
 		if (findFirstSetBit<coord>(c, &maxbit) == 0) { return 0; }
 		morton answer = 0;
@@ -97,43 +91,53 @@ namespace libmorton {
 	}
 
 	// Magicbits masks (3D encode)
-	static uint_fast32_t magicbit3D_masks32_encode[6] = { 0x000003ff, 0, 0x30000ff, 0x0300f00f, 0x30c30c3, 0x9249249 }; // we add a 0 on position 1 in this array to use same code for 32-bit and 64-bit cases
-	static uint_fast64_t magicbit3D_masks64_encode[6] = { 0x1fffff, 0x1f00000000ffff, 0x1f0000ff0000ff, 0x100f00f00f00f00f, 0x10c30c30c30c30c3, 0x1249249249249249 };
+	// constexpr, so the masks are immediates in the generated code and the methods below work in constant expressions
+	static constexpr uint_fast32_t magicbit3D_masks32_encode[6] = { 0x000003ff, 0, 0x30000ff, 0x0300f00f, 0x30c30c3, 0x9249249 }; // we add a 0 on position 1 in this array to use same code for 32-bit and 64-bit cases
+	static constexpr uint_fast64_t magicbit3D_masks64_encode[6] = { 0x1fffff, 0x1f00000000ffff, 0x1f0000ff0000ff, 0x100f00f00f00f00f, 0x10c30c30c30c30c3, 0x1249249249249249 };
+
+	// HELPER METHOD: pick a Magic bits encode mask for the width of the morton type
+	template<typename morton>
+	constexpr morton morton3D_EncodeMask(const unsigned int i) {
+		return (sizeof(morton) <= 4) ? static_cast<morton>(magicbit3D_masks32_encode[i]) : static_cast<morton>(magicbit3D_masks64_encode[i]);
+	}
+
+	// HELPER METHOD: Magic bits encoding, the split steps from mask i on (shifts 32, 16, 8, 4, 2)
+	template<typename morton>
+	constexpr morton morton3D_Split(const morton x, const unsigned int i) {
+		return (i > 5) ? x : morton3D_Split<morton>(static_cast<morton>((x | static_cast<morton>(x << (64u >> i))) & morton3D_EncodeMask<morton>(i)), i + 1);
+	}
 
 	// HELPER METHOD: Magic bits encoding (helper method)
+	// the 32 bit shift (mask 1) is only needed for the 64-bit case
 	template<typename morton, typename coord>
-	static inline morton morton3D_SplitBy3bits(const coord a) {
-		const morton* masks = (sizeof(morton) <= 4) ? reinterpret_cast<const morton*>(magicbit3D_masks32_encode) : reinterpret_cast<const morton*>(magicbit3D_masks64_encode);
-		morton x = ((morton)a) & masks[0];
-		if (sizeof(morton) == 8) { x = (x | (uint_fast64_t)x << 32) & masks[1]; } // for 64-bit case
-		x = (x | x << 16) & masks[2];
-		x = (x | x << 8)  & masks[3];
-		x = (x | x << 4)  & masks[4];
-		x = (x | x << 2)  & masks[5];
-		return x;
+	static constexpr morton morton3D_SplitBy3bits(const coord a) {
+		return morton3D_Split<morton>(static_cast<morton>(static_cast<morton>(a) & morton3D_EncodeMask<morton>(0)), (sizeof(morton) == 8) ? 1 : 2);
 	}
 
 	// ENCODE 3D Morton code : Magic bits method
 	// This method uses certain bit patterns (magic bits) to split bits in the coordinates
 	template<typename morton, typename coord>
-	inline morton m3D_e_magicbits(const coord x, const coord y, const coord z) {
+	constexpr morton m3D_e_magicbits(const coord x, const coord y, const coord z) {
 		return morton3D_SplitBy3bits<morton, coord>(x) | (morton3D_SplitBy3bits<morton, coord>(y) << 1) | (morton3D_SplitBy3bits<morton, coord>(z) << 2);
 	}
 
+	// HELPER METHOD for For loop encoding: bit i of the three coordinates and up
+	template<typename morton, typename coord>
+	constexpr morton morton3D_EncodeBits_for(const coord x, const coord y, const coord z, const unsigned int i = 0) {
+		// Here we need to cast 0x1 to 64bits, otherwise there is a bug when morton code is larger than 32 bits
+		// (shift back i and forth 3*i)
+		return (i >= (sizeof(morton) * 8) / 3) ? static_cast<morton>(0) :
+			static_cast<morton>(static_cast<morton>((x & (static_cast<morton>(1) << i)) << (2 * i))
+				| static_cast<morton>((y & (static_cast<morton>(1) << i)) << (2 * i + 1))
+				| static_cast<morton>((z & (static_cast<morton>(1) << i)) << (2 * i + 2))
+				| morton3D_EncodeBits_for<morton, coord>(x, y, z, i + 1));
+	}
+
 	// ENCODE 3D Morton code : For loop
 	// This is the most naive way of encoding coordinates into a morton code
 	template<typename morton, typename coord>
-	inline morton m3D_e_for(const coord x, const coord y, const coord z) {
-		morton answer = 0;
-		unsigned int checkbits = (sizeof(morton) * 8) / 3;
-		for (unsigned int i = 0; i < checkbits; ++i) {
-			morton mshifted = static_cast<morton>(1) << i; // Here we need to cast 0x1 to 64bits, otherwise there is a bug when morton code is larger than 32 bits
-			unsigned int shift = 2 * i; // because you have to shift back i and forth 3*i
-			answer |= ((x & mshifted) << shift)
-				| ((y & mshifted) << (shift + 1))
-				| ((z & mshifted) << (shift + 2));
-		}
-		return answer;
+	constexpr morton m3D_e_for(const coord x, const coord y, const coord z) {
+		return morton3D_EncodeBits_for<morton, coord>(x, y, z);
 	}
 
 	// ENCODE 3D Morton code : For loop (Early termination version)
@@ -159,14 +163,16 @@ namespace libmorton {
 
 	// HELPER METHOD for LUT decoding
 	// todo: wouldn't this be better with 8-bit aligned decode LUT?
+	// (9 bits of the code at a time: 4 lookups for 32-bit codes, 7 for 64-bit codes, from lookup i on)
+	template<typename morton>
+	constexpr morton morton3D_DecodeBits_LUT256(const morton m, const uint8_t *LUT, const unsigned int startshift, const unsigned int i) {
+		return (i >= ((sizeof(morton) <= 4) ? 4u : 7u)) ? static_cast<morton>(0) :
+			static_cast<morton>(static_cast<morton>(static_cast<morton>(LUT[(m >> ((i * 9) + startshift)) & NINEBITMASK]) << (3 * i))
+				| morton3D_DecodeBits_LUT256<morton>(m, LUT, startshift, i + 1));
+	}
 	template<typename morton, typename coord>
-	inline coord morton3D_DecodeCoord_LUT256(const morton m, const uint_fast8_t *LUT, const unsigned int startshift) {
-		morton a = 0;
-		unsigned int loops = (sizeof(morton) <= 4) ? 4 : 7;
-		for (unsigned int i = 0; i < loops; ++i) {
-			a |= (morton)(LUT[(m >> ((i * 9) + startshift)) & NINEBITMASK] << morton(3 * i));
-		}
-		return static_cast<coord>(a);
+	constexpr coord morton3D_DecodeCoord_LUT256(const morton m, const uint8_t *LUT, const unsigned int startshift) {
+		return static_cast<coord>(morton3D_DecodeBits_LUT256<morton>(m, LUT, startshift, 0));
 	}
 
 	// DECODE 3D Morton code : Shifted LUT
@@ -223,20 +229,25 @@ namespace libmorton {
 	}
 
 	// Magicbits masks (3D decode)
-	static uint_fast32_t magicbit3D_masks32_decode[6] = { 0, 0x000003ff, 0x30000ff, 0x0300f00f, 0x30c30c3, 0x9249249 }; // we add a 0 on position 0 in this array to use same code for 32-bit and 64-bit cases
-	static uint_fast64_t magicbit3D_masks64_decode[6] = { 0x1fffff, 0x1f00000000ffff, 0x1f0000ff0000ff, 0x100f00f00f00f00f, 0x10c30c30c30c30c3, 0x1249249249249249 };
+	static constexpr uint_fast32_t magicbit3D_masks32_decode[6] = { 0, 0x000003ff, 0x30000ff, 0x0300f00f, 0x30c30c3, 0x9249249 }; // we add a 0 on position 0 in this array to use same code for 32-bit and 64-bit cases
+	static constexpr uint_fast64_t magicbit3D_masks64_decode[6] = { 0x1fffff, 0x1f00000000ffff, 0x1f0000ff0000ff, 0x100f00f00f00f00f, 0x10c30c30c30c30c3, 0x1249249249249249 };
+
+	// HELPER METHOD: pick a Magic bits decode mask for the width of the morton type
+	template<typename morton>
+	constexpr morton morton3D_DecodeMask(const unsigned int i) {
+		return (sizeof(morton) <= 4) ? static_cast<morton>(magicbit3D_masks32_decode[i]) : static_cast<morton>(magicbit3D_masks64_decode[i]);
+	}
+
+	// HELPER METHOD for Magic bits decoding: the compaction steps from mask i down (shifts 2, 4, 8, 16, 32)
+	template<typename morton>
+	constexpr morton morton3D_Compact(const morton x, const unsigned int i) {
+		return (i < ((sizeof(morton) > 4) ? 0u : 1u) || i > 4) ? x : morton3D_Compact<morton>(static_cast<morton>((x ^ (x >> (32u >> i))) & morton3D_DecodeMask<morton>(i)), i - 1);
+	}
 
 	// HELPER METHOD for Magic bits decoding
 	template<typename morton, typename coord>
-	static inline coord morton3D_GetThirdBits(const morton m) {
-		morton* masks = (sizeof(morton) <= 4) ? reinterpret_cast<morton*>(magicbit3D_masks32_decode) : reinterpret_cast<morton*>(magicbit3D_masks64_decode);
-		morton x = m & masks[5];
-		x = (x ^ (x >> 2)) & masks[4];
-		x = (x ^ (x >> 4)) & masks[3];
-		x = (x ^ (x >> 8)) & masks[2];
-		x = (x ^ (x >> 16)) & masks[1];
-		if (sizeof(morton) > 4) { x = (x ^ ((uint_fast64_t)x >> 32)) & masks[0]; }
-		return static_cast<coord>(x);
+	static constexpr coord morton3D_GetThirdBits(const morton m) {
+		return static_cast<coord>(morton3D_Compact<morton>(static_cast<morton>(m & morton3D_DecodeMask<morton>(5)), 4));
 	}
 
 	// DECODE 3D Morton code : Magic bits
@@ -248,19 +259,19 @@ namespace libmorton {
 		z = morton3D_GetThirdBits<morton, coord>(m >> 2);
 	}
 
+	// HELPER METHOD for For loop decoding: bit i of one axis (0 = x, 1 = y, 2 = z) and up
+	template<typename morton, typename coord>
+	constexpr coord morton3D_DecodeCoord_for(const morton m, const unsigned int axis, const unsigned int i = 0) {
+		return (i >= (sizeof(morton) * 8) / 3) ? static_cast<coord>(0) :
+			static_cast<coord>(static_cast<coord>((m & (static_cast<morton>(1) << (3 * i + axis))) >> (2 * i + axis)) | morton3D_DecodeCoord_for<morton, coord>(m, axis, i + 1));
+	}
+
 	// DECODE 3D Morton code : For loop
 	template<typename morton, typename coord>
 	inline void m3D_d_for(const morton m, coord& x, coord& y, coord& z) {
-		x = 0; y = 0; z = 0;
-		unsigned int checkbits = (sizeof(morton) * 8) / 3;
-		for (unsigned int i = 0; i < checkbits; ++i) {
-			morton selector = 1;
-			unsigned int shift_selector = 3 * i;
-			unsigned int shiftback = 2 * i;
-			x |= (m & (selector << shift_selector)) >> (shiftback);
-			y |= (m & (selector << (shift_selector + 1))) >> (shiftback + 1);
-			z |= (m & (selector << (shift_selector + 2))) >> (shiftback + 2);
-		}
+		x = morton3D_DecodeCoord_for<morton, coord>(m, 0);
+		y = morton3D_DecodeCoord_for<morton, coord>(m, 1);
+		z = morton3D_DecodeCoord_for<morton, coord>(m, 2);
 	}
 
 	// DECODE 3D Morton code : For loop (Early termination version)
@@ -280,4 +291,204 @@ namespace libmorton {
 			z |= (m & (selector << (shift_selector + 2))) >> (shiftback + 2);
 		}
 	}
-}
\ No newline at end of file
+
+	// ENCODE 3D Morton codes in batch : Magicbits (portable fallback for the SIMD batch methods)
+	template<typename morton, typename coord>
+	inline void m3D_e_magicbits_batch(const coord* x, const coord* y, const coord* z, morton* out, size_t n) {
+		for (size_t i = 0; i < n; ++i) {
+			out[i] = m3D_e_magicbits<morton, coord>(x[i], y[i], z[i]);
+		}
+	}
+
+	// DECODE 3D Morton codes in batch : Magicbits (portable fallback for the SIMD batch methods)
+	template<typename morton, typename coord>
+	inline void m3D_d_magicbits_batch(const morton* m, coord* x, coord* y, coord* z, size_t n) {
+		for (size_t i = 0; i < n; ++i) {
+			m3D_d_magicbits<morton, coord>(m[i], x[i], y[i], z[i]);
+		}
+	}
+
+	// ENCODE 3D Morton codes from strided records : Magicbits (portable fallback for the SIMD strided methods)
+	template<typename morton, typename coord>
+	inline void m3D_e_magicbits_strided(const void* base, size_t stride, size_t offx, size_t offy, size_t offz, morton* out, size_t n) {
+		const unsigned char* p = static_cast<const unsigned char*>(base);
+		for (size_t i = 0; i < n; ++i, p += stride) {
+			out[i] = m3D_e_magicbits<morton, coord>(loadCoord<coord>(p + offx), loadCoord<coord>(p + offy), loadCoord<coord>(p + offz));
+		}
+	}
+
+	// ENCODE 3D Morton codes of floating point positions : Magicbits (portable fallback for the SIMD methods)
+	// xyz holds n packed {x, y, z} positions. Every axis of box is split into 2^level cells (level up to 10 for 32-bit codes,
+	// 21 for 64-bit codes, larger levels are clamped) and every position is encoded as the cell it's in (see mortonQuantize).
+	template<typename morton, typename coord, typename real>
+	inline void m3D_e_magicbits_floats(const real* xyz, morton* out, size_t n, const morton_box<real>& box, unsigned int level) {
+		level = std::min(level, static_cast<unsigned int>(sizeof(morton) * 8 / 3));
+		const real scale[3] = { mortonQuantizeScale(box, 0, level), mortonQuantizeScale(box, 1, level), mortonQuantizeScale(box, 2, level) };
+		const real top = static_cast<real>((static_cast<uint64_t>(1) << level) - 1);
+		for (size_t i = 0; i < n; ++i, xyz += 3) {
+			out[i] = m3D_e_magicbits<morton, coord>(mortonQuantize<coord>(xyz[0], box.min[0], scale[0], top),
+				mortonQuantize<coord>(xyz[1], box.min[1], scale[1], top), mortonQuantize<coord>(xyz[2], box.min[2], scale[2], top));
+		}
+	}
+
+	// DECODE 3D Morton codes to the centres of their cells : Magicbits (the inverse of m3D_e_magicbits_floats)
+	// Writes n packed {x, y, z} positions to xyz. Bits of the codes above the grid of 2^level cells per axis are ignored.
+	template<typename morton, typename coord, typename real>
+	inline void m3D_d_magicbits_floats(const morton* m, real* xyz, size_t n, const morton_box<real>& box, unsigned int level) {
+		level = std::min(level, static_cast<unsigned int>(sizeof(morton) * 8 / 3));
+		const morton levelmask = mortonLevelMask<morton>(3, level);
+		const real cells = static_cast<real>(static_cast<uint64_t>(1) << level);
+		const real size[3] = { (box.max[0] - box.min[0]) / cells, (box.max[1] - box.min[1]) / cells, (box.max[2] - box.min[2]) / cells };
+		for (size_t i = 0; i < n; ++i, xyz += 3) {
+			coord c[3];
+			m3D_d_magicbits<morton, coord>(static_cast<morton>(m[i] & levelmask), c[0], c[1], c[2]);
+			for (unsigned int axis = 0; axis < 3; ++axis) {
+				xyz[axis] = box.min[axis] + (static_cast<real>(c[axis]) + static_cast<real>(0.5)) * size[axis];
+			}
+		}
+	}
+
+	// HELPER METHOD: bits of one axis (0 = x, 1 = y, 2 = z) in a 3D morton code,
+	// limited to the bits the encoders fill (10 per axis for 32-bit codes, 21 per axis for 64-bit codes, 42 for 128-bit codes)
+	template<typename morton>
+	inline morton morton3D_AxisMask(const unsigned int axis) {
+		const uint_fast64_t mask = (axis == 0) ? BMI_3D_X_MASK : ((axis == 1) ? BMI_3D_Y_MASK : BMI_3D_Z_MASK);
+		const morton low = static_cast<morton>(mask & ((sizeof(morton) <= 4) ? 0x000000003FFFFFFF : 0x7FFFFFFFFFFFFFFF));
+		// 128-bit codes (morton128.h): the upper 21 bits per axis start at bit 63
+		return (sizeof(morton) > 8) ? static_cast<morton>(low | static_cast<morton>(low << (sizeof(morton) * 4 - 1))) : low;
+	}
+
+	// DILATED ARITHMETIC on 3D Morton codes
+	// These step through Morton space without decoding: m3D_add_x(m, m3D_e_magicbits(dx, 0, 0)) gives the same code
+	// as encoding (x + dx, y, z). Coordinates wrap around at the number of bits per axis. Only the bits of the given
+	// axis are read from the delta code, so the delta can be any code: m3D_add_x(a, b) adds the x of b to the x of a.
+	template<typename morton>
+	inline morton m3D_add_x(const morton m, const morton d) {
+		return dilatedAdd<morton>(m, d, morton3D_AxisMask<morton>(0));
+	}
+	template<typename morton>
+	inline morton m3D_add_y(const morton m, const morton d) {
+		return dilatedAdd<morton>(m, d, morton3D_AxisMask<morton>(1));
+	}
+	template<typename morton>
+	inline morton m3D_add_z(const morton m, const morton d) {
+		return dilatedAdd<morton>(m, d, morton3D_AxisMask<morton>(2));
+	}
+	template<typename morton>
+	inline morton m3D_sub_x(const morton m, const morton d) {
+		return dilatedSub<morton>(m, d, morton3D_AxisMask<morton>(0));
+	}
+	template<typename morton>
+	inline morton m3D_sub_y(const morton m, const morton d) {
+		return dilatedSub<morton>(m, d, morton3D_AxisMask<morton>(1));
+	}
+	template<typename morton>
+	inline morton m3D_sub_z(const morton m, const morton d) {
+		return dilatedSub<morton>(m, d, morton3D_AxisMask<morton>(2));
+	}
+
+	// Step one cell along an axis (the lowest bit of each axis is bit 0, 1 and 2 respectively)
+	template<typename morton>
+	inline morton m3D_inc_x(const morton m) {
+		return dilatedAdd<morton>(m, 1, morton3D_AxisMask<morton>(0));
+	}
+	template<typename morton>
+	inline morton m3D_inc_y(const morton m) {
+		return dilatedAdd<morton>(m, 2, morton3D_AxisMask<morton>(1));
+	}
+	template<typename morton>
+	inline morton m3D_inc_z(const morton m) {
+		return dilatedAdd<morton>(m, 4, morton3D_AxisMask<morton>(2));
+	}
+	template<typename morton>
+	inline morton m3D_dec_x(const morton m) {
+		return dilatedSub<morton>(m, 1, morton3D_AxisMask<morton>(0));
+	}
+	template<typename morton>
+	inline morton m3D_dec_y(const morton m) {
+		return dilatedSub<morton>(m, 2, morton3D_AxisMask<morton>(1));
+	}
+	template<typename morton>
+	inline morton m3D_dec_z(const morton m) {
+		return dilatedSub<morton>(m, 4, morton3D_AxisMask<morton>(2));
+	}
+
+	// Add / subtract two codes on every axis at once: the code of (xa + xb, ya + yb, za + zb)
+	template<typename morton>
+	inline morton m3D_add(const morton a, const morton b) {
+		return m3D_add_z<morton>(m3D_add_y<morton>(m3D_add_x<morton>(a, b), b), b);
+	}
+	template<typename morton>
+	inline morton m3D_sub(const morton a, const morton b) {
+		return m3D_sub_z<morton>(m3D_sub_y<morton>(m3D_sub_x<morton>(a, b), b), b);
+	}
+
+	// NEIGHBOURS of 3D Morton codes in batch, in a grid of 2^level cells per axis (level up to 10 for 32-bit, 21 for 64-bit codes)
+	// Writes the 6 (faces), 18 (+ edges) or 26 (+ corners) neighbours of m[i] to out[i * connectivity ...],
+	// in the order given by mortonNeighbourOffsets(3, connectivity, ...). Bits of m above the level are ignored.
+	// Returns the number of neighbours per code, or 0 (writing nothing) for an unsupported connectivity.
+	template<typename morton>
+	inline size_t m3D_neighbours(const morton* m, morton* out, size_t n, const unsigned int level, const unsigned int connectivity, const morton_boundary boundary) {
+		unsigned char offsets[26][3];
+		const unsigned int count = mortonNeighbourOffsets(3, connectivity, offsets);
+		if (count == 0) { return 0; }
+		const morton levelmask = mortonLevelMask<morton>(3, level);
+		const morton masks[3] = { morton3D_AxisMask<morton>(0) & levelmask, morton3D_AxisMask<morton>(1) & levelmask, morton3D_AxisMask<morton>(2) & levelmask };
+		for (size_t i = 0; i < n; ++i) {
+			morton steps[3][3];
+			for (unsigned int axis = 0; axis < 3; ++axis) {
+				mortonAxisSteps<morton>(m[i], masks[axis], boundary, steps[axis]);
+			}
+			for (unsigned int j = 0; j < count; ++j) {
+				*out++ = steps[0][offsets[j][0]] | steps[1][offsets[j][1]] | steps[2][offsets[j][2]];
+			}
+		}
+		return count;
+	}
+
+	// BOX QUERIES on 3D Morton codes
+	// A box is given by the codes of its lowest and highest corner: zmin = encode(xmin, ymin, zmin), zmax = encode(xmax, ymax, zmax).
+	// BIGMIN: the smallest code inside the box that is larger than zcur (zcur must be smaller than zmax)
+	template<typename morton>
+	inline morton m3D_bigmin(const morton zcur, const morton zmin, const morton zmax) {
+		const morton masks[3] = { morton3D_AxisMask<morton>(0), morton3D_AxisMask<morton>(1), morton3D_AxisMask<morton>(2) };
+		return mortonBigMin<morton>(zcur, zmin, zmax, masks, 3);
+	}
+	// LITMAX: the largest code inside the box that is smaller than zcur (zcur must be larger than zmin)
+	template<typename morton>
+	inline morton m3D_litmax(const morton zcur, const morton zmin, const morton zmax) {
+		const morton masks[3] = { morton3D_AxisMask<morton>(0), morton3D_AxisMask<morton>(1), morton3D_AxisMask<morton>(2) };
+		return mortonLitMax<morton>(zcur, zmin, zmax, masks, 3);
+	}
+	// Is code m inside the box
+	template<typename morton>
+	inline bool m3D_in_box(const morton m, const morton zmin, const morton zmax) {
+		const morton masks[3] = { morton3D_AxisMask<morton>(0), morton3D_AxisMask<morton>(1), morton3D_AxisMask<morton>(2) };
+		return mortonInBox<morton>(m, zmin, zmax, masks, 3);
+	}
+	// Call visit(begin, end) for every run of keys[begin, end) inside the box, in a sorted array of n keys.
+	// Skips from one run to the next with m3D_bigmin, so the cost is O(hits + runs * log n) instead of O(keys between zmin and zmax).
+	// Returns the number of keys inside the box.
+	template<typename morton, typename visitor>
+	inline size_t m3D_box_scan(const morton* keys, const size_t n, const morton zmin, const morton zmax, visitor visit) {
+		const morton masks[3] = { morton3D_AxisMask<morton>(0), morton3D_AxisMask<morton>(1), morton3D_AxisMask<morton>(2) };
+		return mortonBoxScan<morton, visitor>(keys, n, zmin, zmax, masks, 3, visit);
+	}
+
+	// Decompose the box into the sorted intervals [lo, hi] of codes inside it, for range predicates on sorted keys.
+	// With max_intervals = 0 the result is exact and minimal, otherwise it has at most max_intervals intervals
+	// and may also hold codes outside the box (see mortonBoxIntervals). Returns the number of intervals.
+	template<typename morton>
+	inline size_t m3D_box_intervals(const morton zmin, const morton zmax, const size_t max_intervals, std::vector<morton_interval<morton> >& out) {
+		const morton masks[3] = { morton3D_AxisMask<morton>(0), morton3D_AxisMask<morton>(1), morton3D_AxisMask<morton>(2) };
+		return mortonBoxIntervals<morton>(zmin, zmax, masks, 3, max_intervals, out);
+	}
+
+	// Walk the codes inside the box in increasing order without encoding them: one at a time (*it, ++it, until it.done())
+	// or in runs [lo, hi] of consecutive codes (it.next_run(run)), for bulk processing of the cells of a Morton-ordered array
+	template<typename morton>
+	inline morton_box_iterator<morton> m3D_box_iterator(const morton zmin, const morton zmax) {
+		const morton masks[3] = { morton3D_AxisMask<morton>(0), morton3D_AxisMask<morton>(1), morton3D_AxisMask<morton>(2) };
+		return morton_box_iterator<morton>(zmin, zmax, masks, 3);
+	}
+}
@@ -0,0 +1,291 @@
+#pragma once
+
+// Libmorton - Methods to encode/decode N-dimensional morton codes (2 to 64 coordinates per code)
+// The code width decides the number of bits per coordinate: sizeof(morton) * 8 / dims (21 for 3D 64-bit codes, 16 for 4D
+// 64-bit codes, 12 for 5D, 10 for 6D). The magic bits masks and the pdep/pext masks are computed at compile time, so a
+// generic 2D/3D method compiles to the same shifts and masks as the hand-written ones in morton2D.h / morton3D.h.
+// Anisotropic codes give every axis its own number of bits (e.g. 24/24/16 in a 64-bit code): the bits are interleaved
+// round-robin over the axes that still have bits left, and the magic bits method becomes an expand / compress network
+// (Hacker's Delight, 7-4 and 7-5) with its masks computed at compile time from the pdep/pext mask of every axis.
+// Warning: morton.h will always point to the functions that use the fastest available method (libmorton::encode / decode).
+
+#include <stdint.h>
+#include "morton_common.h"
+#if defined(__BMI2__) || defined(__AVX2__) || defined(LIBMORTON_RUNTIME_DISPATCH)
+#include "morton_BMI.h"
+#endif
+
+namespace libmorton {
+
+	namespace nd_detail {
+		// Bits per coordinate in a code of type morton
+		template<typename morton, unsigned int dims>
+		struct layout {
+			static_assert(dims >= 2 && dims <= sizeof(morton) * 8, "a code holds 2 to sizeof(morton) * 8 coordinates");
+			static const unsigned int fieldbits = static_cast<unsigned int>(sizeof(morton) * 8) / dims;
+		};
+
+		// The lowest bits bits
+		template<typename morton>
+		constexpr morton lowMask(const unsigned int bits) {
+			return (bits >= sizeof(morton) * 8) ? static_cast<morton>(~static_cast<morton>(0)) : static_cast<morton>((static_cast<morton>(1) << bits) - 1);
+		}
+
+		// Magic bits mask: where the bits of a fieldbits-bit coordinate are when it's split into chunks of chunk bits, every
+		// chunk * dims bits (chunk = 1 is the mask of the x axis)
+		template<typename morton>
+		constexpr morton chunkMask(const unsigned int dims, const unsigned int chunk, const unsigned int fieldbits, const unsigned int bit = 0) {
+			return (bit >= sizeof(morton) * 8) ? static_cast<morton>(0) :
+				static_cast<morton>(((bit % (chunk * dims) < chunk && (bit / (chunk * dims)) * chunk + bit % (chunk * dims) < fieldbits) ? static_cast<morton>(static_cast<morton>(1) << bit) : static_cast<morton>(0))
+					| chunkMask<morton>(dims, chunk, fieldbits, bit + 1));
+		}
+
+		// SPLIT: spread the bits of a coordinate to every dims-th bit, halving the chunks at every step (chunks of 2 * chunk bits
+		// are in place: move the upper half of every chunk up by chunk * (dims - 1) and mask the chunks of chunk bits)
+		template<typename morton, unsigned int dims, unsigned int chunk, bool done = (chunk >= layout<morton, dims>::fieldbits)>
+		struct magicbits {
+			static const morton mask = chunkMask<morton>(dims, chunk, layout<morton, dims>::fieldbits);
+			static inline morton split(const morton x) {
+				const morton m = magicbits<morton, dims, chunk * 2>::split(x);
+				return static_cast<morton>((m | static_cast<morton>(m << (chunk * (dims - 1)))) & mask);
+			}
+			// JOIN: the inverse, doubling the chunks at every step
+			static inline morton join(const morton x) {
+				const morton m = static_cast<morton>((x | static_cast<morton>(x >> (chunk * (dims - 1)))) & magicbits<morton, dims, chunk * 2>::mask);
+				return magicbits<morton, dims, chunk * 2>::join(m);
+			}
+		};
+		template<typename morton, unsigned int dims, unsigned int chunk>
+		struct magicbits<morton, dims, chunk, true> {
+			static const morton mask = lowMask<morton>(layout<morton, dims>::fieldbits);
+			static inline morton split(const morton x) { return static_cast<morton>(x & mask); }
+			static inline morton join(const morton x) { return static_cast<morton>(x & mask); }
+		};
+
+		template<typename morton, unsigned int dims, unsigned int axis>
+		inline morton encodeMagicbits() { return 0; }
+		template<typename morton, unsigned int dims, unsigned int axis, typename coord, typename... coords>
+		inline morton encodeMagicbits(const coord c, const coords... rest) {
+			return static_cast<morton>((magicbits<morton, dims, 1>::split(static_cast<morton>(c)) << axis) | encodeMagicbits<morton, dims, axis + 1>(rest...));
+		}
+
+		template<typename morton, unsigned int dims, unsigned int axis>
+		inline void decodeMagicbits(const morton) {}
+		template<typename morton, unsigned int dims, unsigned int axis, typename coord, typename... coords>
+		inline void decodeMagicbits(const morton m, coord& c, coords&... rest) {
+			c = static_cast<coord>(magicbits<morton, dims, 1>::join(static_cast<morton>((m >> axis) & magicbits<morton, dims, 1>::mask)));
+			decodeMagicbits<morton, dims, axis + 1>(m, rest...);
+		}
+	}  // namespace nd_detail
+
+	// HELPER METHOD: bits of one axis (0 = x, 1 = y, ...) in an N-dimensional morton code
+	template<typename morton, unsigned int dims>
+	constexpr morton mortonND_AxisMask(const unsigned int axis) {
+		return static_cast<morton>(nd_detail::chunkMask<morton>(dims, 1, nd_detail::layout<morton, dims>::fieldbits) << axis);
+	}
+
+	// ENCODE N-dimensional Morton code : Magic bits method
+	// The magic bits masks are generated at compile time: log2(bits per coordinate) shift/mask steps per coordinate
+	template<unsigned int dims, typename morton, typename coord, typename... coords>
+	inline morton mND_e_magicbits(coords... c) {
+		static_assert(sizeof...(c) == dims, "one coordinate per dimension");
+		return nd_detail::encodeMagicbits<morton, dims, 0>(static_cast<coord>(c)...);
+	}
+
+	// DECODE N-dimensional Morton code : Magic bits method
+	template<unsigned int dims, typename morton, typename coord, typename... coords>
+	inline void mND_d_magicbits(const morton m, coords&... c) {
+		static_assert(sizeof...(c) == dims, "one coordinate per dimension");
+		nd_detail::decodeMagicbits<morton, dims, 0>(m, c...);
+	}
+
+	namespace aniso_detail {
+		// The coordinate type of every axis, to expand a list of bits per axis into a list of coordinates
+		template<typename coord, unsigned int bits>
+		struct axis_coord {
+			typedef coord type;
+		};
+
+		// Bits of an axis
+		constexpr unsigned int axisBits(const unsigned int) { return 0; }
+		template<typename... rest>
+		constexpr unsigned int axisBits(const unsigned int axis, const unsigned int bits, const rest... more) {
+			return (axis == 0) ? bits : axisBits(axis - 1, more...);
+		}
+
+		// Code bits taken by the first r bits of every axis (all of them for r = ~0u)
+		constexpr unsigned int bitsBelow(const unsigned int) { return 0; }
+		template<typename... rest>
+		constexpr unsigned int bitsBelow(const unsigned int r, const unsigned int bits, const rest... more) {
+			return ((bits < r) ? bits : r) + bitsBelow(r, more...);
+		}
+
+		// Axes before axis that still have a bit r
+		constexpr unsigned int axesBefore(const unsigned int, const unsigned int) { return 0; }
+		template<typename... rest>
+		constexpr unsigned int axesBefore(const unsigned int axis, const unsigned int r, const unsigned int bits, const rest... more) {
+			return (axis == 0) ? 0 : ((bits > r) ? 1 : 0) + axesBefore(axis - 1, r, more...);
+		}
+
+		// pdep/pext mask of an axis, from bit r of the axis up: bit r goes to code bit bitsBelow(r) + axesBefore(axis, r)
+		template<typename morton, typename... list>
+		constexpr morton axisMask(const unsigned int axis, const unsigned int r, const list... bits) {
+			return (r >= axisBits(axis, bits...)) ? static_cast<morton>(0) :
+				static_cast<morton>((static_cast<morton>(1) << (bitsBelow(r, bits...) + axesBefore(axis, r, bits...))) | axisMask<morton>(axis, r + 1, bits...));
+		}
+
+		// Parallel prefix XOR (bit i becomes the XOR of bits 0 to i)
+		template<typename morton>
+		constexpr morton prefixXor(const morton x, const unsigned int shift = 1) {
+			return (shift >= sizeof(morton) * 8) ? x : prefixXor<morton>(static_cast<morton>(x ^ static_cast<morton>(x << shift)), shift * 2);
+		}
+
+		// The bits of stage target of the compress network of mask that move right by 2^target (Hacker's Delight, 7-4)
+		// m is what's left of the mask, mk the zeros to the right of every bit of it, at stage step
+		template<typename morton>
+		constexpr morton compressMove(const morton m, const morton mk, const unsigned int step, const unsigned int target) {
+			return (step == target) ? static_cast<morton>(prefixXor<morton>(mk) & m) :
+				compressMove<morton>(static_cast<morton>((m ^ (prefixXor<morton>(mk) & m)) | static_cast<morton>((prefixXor<morton>(mk) & m) >> (1u << step))),
+					static_cast<morton>(mk & static_cast<morton>(~prefixXor<morton>(mk))), step + 1, target);
+		}
+
+		// EXPAND (pdep) / COMPRESS (pext) with the fixed mask of an axis: one shift and mask per stage, stages that move no
+		// bits are left out at compile time
+		template<typename morton>
+		constexpr bool lastStage(const unsigned int stage) { return (1u << stage) >= sizeof(morton) * 8; }
+		template<typename morton, morton mask, unsigned int stage = 0, bool done = lastStage<morton>(stage)>
+		struct network {
+			static const morton move = compressMove<morton>(mask, static_cast<morton>(static_cast<morton>(~mask) << 1), 0, stage);
+			static inline morton expand(morton x) {
+				x = network<morton, mask, stage + 1>::expand(x);
+				if (move != 0) { x = static_cast<morton>((x & static_cast<morton>(~move)) | (static_cast<morton>(x << (1u << stage)) & move)); }
+				return x;
+			}
+			static inline morton compress(morton x) {
+				if (move != 0) {
+					const morton t = static_cast<morton>(x & move);
+					x = static_cast<morton>((x ^ t) | static_cast<morton>(t >> (1u << stage)));
+				}
+				return network<morton, mask, stage + 1>::compress(x);
+			}
+		};
+		template<typename morton, morton mask, unsigned int stage>
+		struct network<morton, mask, stage, true> {
+			static inline morton expand(const morton x) { return x; }
+			static inline morton compress(const morton x) { return x; }
+		};
+
+		template<typename morton, unsigned int axis, unsigned int... bits>
+		struct layout {
+			static_assert(bitsBelow(~0u, bits...) <= sizeof(morton) * 8, "the bits of all axes have to fit in the code");
+			static const morton mask = axisMask<morton>(axis, 0, bits...);
+			static const morton field = nd_detail::lowMask<morton>(axisBits(axis, bits...));
+		};
+
+		template<unsigned int... bits>
+		struct bitlist {};
+
+		template<typename morton, unsigned int axis, unsigned int... bits>
+		inline morton encodeMagicbits(bitlist<bits...>) { return 0; }
+		template<typename morton, unsigned int axis, unsigned int... bits, typename coord, typename... coords>
+		inline morton encodeMagicbits(bitlist<bits...> list, const coord c, const coords... rest) {
+			typedef layout<morton, axis, bits...> l;
+			return static_cast<morton>((network<morton, l::mask>::expand(static_cast<morton>(static_cast<morton>(c) & l::field)) & l::mask)
+				| encodeMagicbits<morton, axis + 1>(list, rest...));
+		}
+
+		template<typename morton, unsigned int axis, unsigned int... bits>
+		inline void decodeMagicbits(bitlist<bits...>, const morton) {}
+		template<typename morton, unsigned int axis, unsigned int... bits, typename coord, typename... coords>
+		inline void decodeMagicbits(bitlist<bits...> list, const morton m, coord& c, coords&... rest) {
+			typedef layout<morton, axis, bits...> l;
+			c = static_cast<coord>(network<morton, l::mask>::compress(static_cast<morton>(m & l::mask)));
+			decodeMagicbits<morton, axis + 1>(list, m, rest...);
+		}
+	}  // namespace aniso_detail
+
+	// HELPER METHOD: bits of one axis in an anisotropic morton code with the given bits per axis
+	template<typename morton, unsigned int... bits>
+	constexpr morton mortonAniso_AxisMask(const unsigned int axis) {
+		return aniso_detail::axisMask<morton>(axis, 0, bits...);
+	}
+
+	// ENCODE anisotropic Morton code : Magic bits method (expand network), e.g. mAniso_e_magicbits<uint64_t, uint32_t, 24, 24, 16>(x, y, z)
+	// Axis i takes bits[i] bits of its coordinate, the bits of all axes have to fit in the code.
+	template<typename morton, typename coord, unsigned int... bits>
+	inline morton mAniso_e_magicbits(typename aniso_detail::axis_coord<coord, bits>::type... c) {
+		return aniso_detail::encodeMagicbits<morton, 0>(aniso_detail::bitlist<bits...>(), c...);
+	}
+
+	// DECODE anisotropic Morton code : Magic bits method (compress network)
+	template<typename morton, typename coord, unsigned int... bits>
+	inline void mAniso_d_magicbits(const morton m, typename aniso_detail::axis_coord<coord, bits>::type&... c) {
+		aniso_detail::decodeMagicbits<morton, 0>(aniso_detail::bitlist<bits...>(), m, c...);
+	}
+
+#if defined(__BMI2__) || defined(__AVX2__) || defined(LIBMORTON_RUNTIME_DISPATCH)
+	namespace nd_detail {
+		// pdep/pext mask of an axis, as a compile time constant
+		template<typename morton, unsigned int dims, unsigned int axis>
+		struct axismask {
+			static const morton value = mortonND_AxisMask<morton, dims>(axis);
+		};
+
+		template<typename morton, unsigned int dims, unsigned int axis>
+		LIBMORTON_TARGET("bmi2") inline morton encodeBMI() { return 0; }
+		template<typename morton, unsigned int dims, unsigned int axis, typename coord, typename... coords>
+		LIBMORTON_TARGET("bmi2") inline morton encodeBMI(const coord c, const coords... rest) {
+			return static_cast<morton>(bmi2_detail::pdep(static_cast<morton>(c), axismask<morton, dims, axis>::value) | encodeBMI<morton, dims, axis + 1>(rest...));
+		}
+
+		template<typename morton, unsigned int dims, unsigned int axis>
+		LIBMORTON_TARGET("bmi2") inline void decodeBMI(const morton) {}
+		template<typename morton, unsigned int dims, unsigned int axis, typename coord, typename... coords>
+		LIBMORTON_TARGET("bmi2") inline void decodeBMI(const morton m, coord& c, coords&... rest) {
+			c = static_cast<coord>(bmi2_detail::pext(m, axismask<morton, dims, axis>::value));
+			decodeBMI<morton, dims, axis + 1>(m, rest...);
+		}
+
+		template<typename morton, unsigned int axis, unsigned int... bits>
+		LIBMORTON_TARGET("bmi2") inline morton encodeAnisoBMI(aniso_detail::bitlist<bits...>) { return 0; }
+		template<typename morton, unsigned int axis, unsigned int... bits, typename coord, typename... coords>
+		LIBMORTON_TARGET("bmi2") inline morton encodeAnisoBMI(aniso_detail::bitlist<bits...> list, const coord c, const coords... rest) {
+			return static_cast<morton>(bmi2_detail::pdep(static_cast<morton>(c), aniso_detail::layout<morton, axis, bits...>::mask) | encodeAnisoBMI<morton, axis + 1>(list, rest...));
+		}
+
+		template<typename morton, unsigned int axis, unsigned int... bits>
+		LIBMORTON_TARGET("bmi2") inline void decodeAnisoBMI(aniso_detail::bitlist<bits...>, const morton) {}
+		template<typename morton, unsigned int axis, unsigned int... bits, typename coord, typename... coords>
+		LIBMORTON_TARGET("bmi2") inline void decodeAnisoBMI(aniso_detail::bitlist<bits...> list, const morton m, coord& c, coords&... rest) {
+			c = static_cast<coord>(bmi2_detail::pext(m, aniso_detail::layout<morton, axis, bits...>::mask));
+			decodeAnisoBMI<morton, axis + 1>(list, m, rest...);
+		}
+	}  // namespace nd_detail
+
+	// ENCODE N-dimensional Morton code : BMI2 pdep, with the masks generated at compile time (32-bit and 64-bit codes)
+	template<unsigned int dims, typename morton, typename coord, typename... coords>
+	LIBMORTON_TARGET("bmi2") inline morton mND_e_BMI(coords... c) {
+		static_assert(sizeof...(c) == dims, "one coordinate per dimension");
+		return nd_detail::encodeBMI<morton, dims, 0>(static_cast<coord>(c)...);
+	}
+
+	// DECODE N-dimensional Morton code : BMI2 pext
+	template<unsigned int dims, typename morton, typename coord, typename... coords>
+	LIBMORTON_TARGET("bmi2") inline void mND_d_BMI(const morton m, coords&... c) {
+		static_assert(sizeof...(c) == dims, "one coordinate per dimension");
+		nd_detail::decodeBMI<morton, dims, 0>(m, c...);
+	}
+
+	// ENCODE anisotropic Morton code : BMI2 pdep with the masks generated at compile time (32-bit and 64-bit codes)
+	template<typename morton, typename coord, unsigned int... bits>
+	LIBMORTON_TARGET("bmi2") inline morton mAniso_e_BMI(typename aniso_detail::axis_coord<coord, bits>::type... c) {
+		return nd_detail::encodeAnisoBMI<morton, 0>(aniso_detail::bitlist<bits...>(), c...);
+	}
+
+	// DECODE anisotropic Morton code : BMI2 pext
+	template<typename morton, typename coord, unsigned int... bits>
+	LIBMORTON_TARGET("bmi2") inline void mAniso_d_BMI(const morton m, typename aniso_detail::axis_coord<coord, bits>::type&... c) {
+		nd_detail::decodeAnisoBMI<morton, 0>(aniso_detail::bitlist<bits...>(), m, c...);
+	}
+#endif
+}
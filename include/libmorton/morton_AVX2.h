@@ -0,0 +1,629 @@
+#pragma once
+#include "morton_common.h"
+#if defined(__AVX2__) || defined(LIBMORTON_RUNTIME_DISPATCH)
+#include <immintrin.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "morton2D.h"
+#include "morton3D.h"
+
+// Libmorton - Methods to encode/decode batches of Morton codes using the AVX2 instruction set
+// These process the coordinates as separate x, y and z arrays (Structure of Arrays)
+// and run the magicbits sequences on 4 (64-bit) or 8 (32-bit) lanes at once.
+// The 2D methods use the same perfect shuffle of a combined (x | y) lane as morton_SSE2.h, on twice the width.
+
+namespace libmorton {
+
+	namespace avx2_detail {
+		// Magicbits split of the low 21 bits of every 64-bit lane (see morton3D_SplitBy3bits)
+		LIBMORTON_TARGET("avx2") inline __m256i splitBy3bits_64(__m256i x, const __m256i* masks) noexcept {
+			x = _mm256_and_si256(x, masks[0]);
+			x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi64(x, 32)), masks[1]);
+			x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi64(x, 16)), masks[2]);
+			x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi64(x, 8)), masks[3]);
+			x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi64(x, 4)), masks[4]);
+			x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi64(x, 2)), masks[5]);
+			return x;
+		}
+		// Magicbits split of the low 10 bits of every 32-bit lane (see morton3D_SplitBy3bits)
+		LIBMORTON_TARGET("avx2") inline __m256i splitBy3bits_32(__m256i x, const __m256i* masks) noexcept {
+			x = _mm256_and_si256(x, masks[0]);
+			x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi32(x, 16)), masks[2]);
+			x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi32(x, 8)), masks[3]);
+			x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi32(x, 4)), masks[4]);
+			x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi32(x, 2)), masks[5]);
+			return x;
+		}
+		// Encode the 21-bit x, y and z coordinates in each 64-bit lane
+		LIBMORTON_TARGET("avx2") inline __m256i encode3D_64(__m256i x, __m256i y, __m256i z, const __m256i* masks) noexcept {
+			return _mm256_or_si256(splitBy3bits_64(x, masks),
+				_mm256_or_si256(_mm256_slli_epi64(splitBy3bits_64(y, masks), 1), _mm256_slli_epi64(splitBy3bits_64(z, masks), 2)));
+		}
+		// Encode the 10-bit x, y and z coordinates in each 32-bit lane
+		LIBMORTON_TARGET("avx2") inline __m256i encode3D_32(__m256i x, __m256i y, __m256i z, const __m256i* masks) noexcept {
+			return _mm256_or_si256(splitBy3bits_32(x, masks),
+				_mm256_or_si256(_mm256_slli_epi32(splitBy3bits_32(y, masks), 1), _mm256_slli_epi32(splitBy3bits_32(z, masks), 2)));
+		}
+		// Encode 8 32-bit x, y and z coordinates and store the 8 64-bit codes
+		LIBMORTON_TARGET("avx2") inline void encode3D_64_x8(uint64_t* out, __m256i x, __m256i y, __m256i z, const __m256i* masks) noexcept {
+			const __m256i lo = encode3D_64(_mm256_cvtepu32_epi64(_mm256_castsi256_si128(x)), _mm256_cvtepu32_epi64(_mm256_castsi256_si128(y)),
+				_mm256_cvtepu32_epi64(_mm256_castsi256_si128(z)), masks);
+			const __m256i hi = encode3D_64(_mm256_cvtepu32_epi64(_mm256_extracti128_si256(x, 1)), _mm256_cvtepu32_epi64(_mm256_extracti128_si256(y, 1)),
+				_mm256_cvtepu32_epi64(_mm256_extracti128_si256(z, 1)), masks);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out), lo);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 4), hi);
+		}
+		// Magicbits compaction of every third bit of each 64-bit lane into its low 21 bits (see morton3D_GetThirdBits)
+		LIBMORTON_TARGET("avx2") inline __m256i getThirdBits_64(__m256i x, const __m256i* masks) noexcept {
+			x = _mm256_and_si256(x, masks[5]);
+			x = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi64(x, 2)), masks[4]);
+			x = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi64(x, 4)), masks[3]);
+			x = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi64(x, 8)), masks[2]);
+			x = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi64(x, 16)), masks[1]);
+			x = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi64(x, 32)), masks[0]);
+			return x;
+		}
+		// Magicbits compaction of every third bit of each 32-bit lane into its low 10 bits (see morton3D_GetThirdBits)
+		LIBMORTON_TARGET("avx2") inline __m256i getThirdBits_32(__m256i x, const __m256i* masks) noexcept {
+			x = _mm256_and_si256(x, masks[5]);
+			x = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi32(x, 2)), masks[4]);
+			x = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi32(x, 4)), masks[3]);
+			x = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi32(x, 8)), masks[2]);
+			x = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi32(x, 16)), masks[1]);
+			return x;
+		}
+		// Store the low 32 bits of each of the 4 64-bit lanes
+		LIBMORTON_TARGET("avx2") inline void store_lo32(uint32_t* out, __m256i x) noexcept {
+			const __m256i packed = _mm256_permutevar8x32_epi32(x, _mm256_set_epi32(7, 5, 3, 1, 6, 4, 2, 0));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(packed));
+		}
+		// Store the low 16 bits of each of the 8 32-bit lanes (lanes have to fit in 16 bits)
+		LIBMORTON_TARGET("avx2") inline void store_lo16(uint16_t* out, __m256i x) noexcept {
+			const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(x, x), 0x08);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(packed));
+		}
+		// Swap the bits selected by mask with the bits shift positions above them
+		LIBMORTON_TARGET("avx2") inline __m256i deltaswap_32(__m256i v, const int shift, const __m256i mask) noexcept {
+			const __m256i t = _mm256_and_si256(_mm256_xor_si256(v, _mm256_srli_epi32(v, shift)), mask);
+			return _mm256_xor_si256(v, _mm256_xor_si256(t, _mm256_slli_epi32(t, shift)));
+		}
+		LIBMORTON_TARGET("avx2") inline __m256i deltaswap_64(__m256i v, const int shift, const __m256i mask) noexcept {
+			const __m256i t = _mm256_and_si256(_mm256_xor_si256(v, _mm256_srli_epi64(v, shift)), mask);
+			return _mm256_xor_si256(v, _mm256_xor_si256(t, _mm256_slli_epi64(t, shift)));
+		}
+		// (x | y << 16) in every 32-bit lane <-> 32-bit morton code
+		LIBMORTON_TARGET("avx2") inline __m256i shuffle_32(__m256i v) noexcept {
+			v = deltaswap_32(v, 8, _mm256_set1_epi32(0x0000FF00));
+			v = deltaswap_32(v, 4, _mm256_set1_epi32(0x00F000F0));
+			v = deltaswap_32(v, 2, _mm256_set1_epi32(0x0C0C0C0C));
+			v = deltaswap_32(v, 1, _mm256_set1_epi32(0x22222222));
+			return v;
+		}
+		LIBMORTON_TARGET("avx2") inline __m256i unshuffle_32(__m256i v) noexcept {
+			v = deltaswap_32(v, 1, _mm256_set1_epi32(0x22222222));
+			v = deltaswap_32(v, 2, _mm256_set1_epi32(0x0C0C0C0C));
+			v = deltaswap_32(v, 4, _mm256_set1_epi32(0x00F000F0));
+			v = deltaswap_32(v, 8, _mm256_set1_epi32(0x0000FF00));
+			return v;
+		}
+		// (x | y << 32) in every 64-bit lane <-> 64-bit morton code
+		LIBMORTON_TARGET("avx2") inline __m256i shuffle_64(__m256i v) noexcept {
+			v = deltaswap_64(v, 16, _mm256_set1_epi64x(0x00000000FFFF0000));
+			v = deltaswap_64(v, 8, _mm256_set1_epi32(0x0000FF00));
+			v = deltaswap_64(v, 4, _mm256_set1_epi32(0x00F000F0));
+			v = deltaswap_64(v, 2, _mm256_set1_epi32(0x0C0C0C0C));
+			v = deltaswap_64(v, 1, _mm256_set1_epi32(0x22222222));
+			return v;
+		}
+		LIBMORTON_TARGET("avx2") inline __m256i unshuffle_64(__m256i v) noexcept {
+			v = deltaswap_64(v, 1, _mm256_set1_epi32(0x22222222));
+			v = deltaswap_64(v, 2, _mm256_set1_epi32(0x0C0C0C0C));
+			v = deltaswap_64(v, 4, _mm256_set1_epi32(0x00F000F0));
+			v = deltaswap_64(v, 8, _mm256_set1_epi32(0x0000FF00));
+			v = deltaswap_64(v, 16, _mm256_set1_epi64x(0x00000000FFFF0000));
+			return v;
+		}
+		// Encode 8 32-bit x and y coordinates and store the 8 64-bit codes
+		LIBMORTON_TARGET("avx2") inline void encode2D_64_x8(uint64_t* out, __m256i x, __m256i y) noexcept {
+			// unpack works within 128-bit lanes: lo holds pairs 0-1 and 4-5, hi holds pairs 2-3 and 6-7
+			const __m256i lo = _mm256_unpacklo_epi32(x, y);
+			const __m256i hi = _mm256_unpackhi_epi32(x, y);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out), shuffle_64(_mm256_permute2x128_si256(lo, hi, 0x20)));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 4), shuffle_64(_mm256_permute2x128_si256(lo, hi, 0x31)));
+		}
+		// Byte offsets of a field in 8 consecutive records, or false if they don't fit the 32-bit gather index
+		LIBMORTON_TARGET("avx2") inline bool gather_index(size_t stride, size_t offset, __m256i& index) noexcept {
+			if (offset > 0x7FFFFFFF || stride > (0x7FFFFFFF - offset) / 8) { return false; }
+			const int s = static_cast<int>(stride);
+			const int o = static_cast<int>(offset);
+			index = _mm256_set_epi32(o + 7 * s, o + 6 * s, o + 5 * s, o + 4 * s, o + 3 * s, o + 2 * s, o + s, o);
+			return true;
+		}
+		// Load the 32-bit values at the given byte offsets from base
+		LIBMORTON_TARGET("avx2") inline __m256i gather_32(const unsigned char* base, const __m256i index) noexcept {
+			return _mm256_i32gather_epi32(reinterpret_cast<const int*>(base), index, 1);
+		}
+		// Neighbours of 4 64-bit codes per iteration, same steps as mortonAxisSteps but on vectors
+		// The neighbours are computed as vectors of 4 codes and written out per code. Returns the number of codes done.
+		template<unsigned int dims>
+		LIBMORTON_TARGET("avx2") inline size_t neighbours_64(const uint64_t* m, uint64_t* out, size_t n, const uint64_t* masks,
+			const unsigned char offsets[26][3], const unsigned int count, const morton_boundary boundary) noexcept {
+			__m256i vmask[dims], vnotmask[dims], vlow[dims];
+			for (unsigned int a = 0; a < dims; ++a) {
+				vmask[a] = _mm256_set1_epi64x(static_cast<long long>(masks[a]));
+				vnotmask[a] = _mm256_set1_epi64x(static_cast<long long>(~masks[a]));
+				vlow[a] = _mm256_set1_epi64x(static_cast<long long>(masks[a] & (~masks[a] + 1)));
+			}
+			alignas(32) uint64_t tmp[26 * 4];
+			size_t i = 0;
+			for (; i + 4 <= n; i += 4) {
+				const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m + i));
+				__m256i steps[dims][3];
+				for (unsigned int a = 0; a < dims; ++a) {
+					const __m256i same = _mm256_and_si256(v, vmask[a]);
+					__m256i minus = _mm256_and_si256(_mm256_sub_epi64(same, vlow[a]), vmask[a]);
+					__m256i plus = _mm256_and_si256(_mm256_add_epi64(_mm256_or_si256(same, vnotmask[a]), vlow[a]), vmask[a]);
+					if (boundary != morton_boundary::wrap) {
+						const __m256i atmin = _mm256_cmpeq_epi64(same, _mm256_setzero_si256());
+						const __m256i atmax = _mm256_cmpeq_epi64(same, vmask[a]);
+						if (boundary == morton_boundary::clamp) {
+							// the wrapped steps are mask and 0 there
+							minus = _mm256_andnot_si256(atmin, minus);
+							plus = _mm256_or_si256(plus, _mm256_and_si256(atmax, same));
+						}
+						else {
+							minus = _mm256_or_si256(minus, atmin);
+							plus = _mm256_or_si256(plus, atmax);
+						}
+					}
+					steps[a][0] = minus;
+					steps[a][1] = same;
+					steps[a][2] = plus;
+				}
+				for (unsigned int j = 0; j < count; ++j) {
+					__m256i r = _mm256_or_si256(steps[0][offsets[j][0]], steps[1][offsets[j][1]]);
+					if (dims == 3) { r = _mm256_or_si256(r, steps[dims - 1][offsets[j][2]]); }
+					_mm256_store_si256(reinterpret_cast<__m256i*>(tmp + 4 * j), r);
+				}
+				for (unsigned int l = 0; l < 4; ++l) {
+					for (unsigned int j = 0; j < count; ++j) {
+						out[(i + l) * count + j] = tmp[4 * j + l];
+					}
+				}
+			}
+			return i;
+		}
+
+		// Neighbours of 8 32-bit codes per iteration, see neighbours_64
+		template<unsigned int dims>
+		LIBMORTON_TARGET("avx2") inline size_t neighbours_32(const uint32_t* m, uint32_t* out, size_t n, const uint32_t* masks,
+			const unsigned char offsets[26][3], const unsigned int count, const morton_boundary boundary) noexcept {
+			__m256i vmask[dims], vnotmask[dims], vlow[dims];
+			for (unsigned int a = 0; a < dims; ++a) {
+				vmask[a] = _mm256_set1_epi32(static_cast<int>(masks[a]));
+				vnotmask[a] = _mm256_set1_epi32(static_cast<int>(~masks[a]));
+				vlow[a] = _mm256_set1_epi32(static_cast<int>(masks[a] & (~masks[a] + 1)));
+			}
+			alignas(32) uint32_t tmp[26 * 8];
+			size_t i = 0;
+			for (; i + 8 <= n; i += 8) {
+				const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m + i));
+				__m256i steps[dims][3];
+				for (unsigned int a = 0; a < dims; ++a) {
+					const __m256i same = _mm256_and_si256(v, vmask[a]);
+					__m256i minus = _mm256_and_si256(_mm256_sub_epi32(same, vlow[a]), vmask[a]);
+					__m256i plus = _mm256_and_si256(_mm256_add_epi32(_mm256_or_si256(same, vnotmask[a]), vlow[a]), vmask[a]);
+					if (boundary != morton_boundary::wrap) {
+						const __m256i atmin = _mm256_cmpeq_epi32(same, _mm256_setzero_si256());
+						const __m256i atmax = _mm256_cmpeq_epi32(same, vmask[a]);
+						if (boundary == morton_boundary::clamp) {
+							minus = _mm256_andnot_si256(atmin, minus);
+							plus = _mm256_or_si256(plus, _mm256_and_si256(atmax, same));
+						}
+						else {
+							minus = _mm256_or_si256(minus, atmin);
+							plus = _mm256_or_si256(plus, atmax);
+						}
+					}
+					steps[a][0] = minus;
+					steps[a][1] = same;
+					steps[a][2] = plus;
+				}
+				for (unsigned int j = 0; j < count; ++j) {
+					__m256i r = _mm256_or_si256(steps[0][offsets[j][0]], steps[1][offsets[j][1]]);
+					if (dims == 3) { r = _mm256_or_si256(r, steps[dims - 1][offsets[j][2]]); }
+					_mm256_store_si256(reinterpret_cast<__m256i*>(tmp + 8 * j), r);
+				}
+				for (unsigned int l = 0; l < 8; ++l) {
+					for (unsigned int j = 0; j < count; ++j) {
+						out[(i + l) * count + j] = tmp[8 * j + l];
+					}
+				}
+			}
+			return i;
+		}
+		// A value in every lane of a float / double vector
+		LIBMORTON_TARGET("avx2") inline __m256 broadcast(const float v) noexcept { return _mm256_set1_ps(v); }
+		LIBMORTON_TARGET("avx2") inline __m256d broadcast(const double v) noexcept { return _mm256_set1_pd(v); }
+		// Quantize 8 packed {x, y, z} float positions to the 32-bit cells of every axis (the arithmetic of mortonQuantize)
+		LIBMORTON_TARGET("avx2") inline void quantize_xyz8(const float* p, const __m256* min, const __m256* scale, const __m256 top, __m256i* cells) noexcept {
+			const __m256 v0 = _mm256_loadu_ps(p); // x0 y0 z0 x1 y1 z1 x2 y2
+			const __m256 v1 = _mm256_loadu_ps(p + 8); // z2 x3 y3 z3 x4 y4 z4 x5
+			const __m256 v2 = _mm256_loadu_ps(p + 16); // y5 z5 x6 y6 z6 x7 y7 z7
+			// lane k of the blended vector holds coordinate k%3 of some point, permute puts point j in lane j (as in m3D_e_AVX2_strided)
+			const __m256 v[3] = { _mm256_blend_ps(_mm256_blend_ps(v0, v1, 0x92), v2, 0x24),
+				_mm256_blend_ps(_mm256_blend_ps(v0, v1, 0x24), v2, 0x49), _mm256_blend_ps(_mm256_blend_ps(v0, v1, 0x49), v2, 0x92) };
+			const __m256i perm[3] = { _mm256_set_epi32(5, 2, 7, 4, 1, 6, 3, 0), _mm256_set_epi32(6, 3, 0, 5, 2, 7, 4, 1), _mm256_set_epi32(7, 4, 1, 6, 3, 0, 5, 2) };
+			for (unsigned int axis = 0; axis < 3; ++axis) {
+				// max/min return their second operand for NaN, so NaN goes to 0
+				const __m256 q = _mm256_mul_ps(_mm256_sub_ps(_mm256_permutevar8x32_ps(v[axis], perm[axis]), min[axis]), scale[axis]);
+				cells[axis] = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(q, _mm256_setzero_ps()), top));
+			}
+		}
+		// Quantize 8 packed {x, y, z} double positions to the 32-bit cells of every axis, 4 at a time
+		LIBMORTON_TARGET("avx2") inline void quantize_xyz8(const double* p, const __m256d* min, const __m256d* scale, const __m256d top, __m256i* cells) noexcept {
+			__m128i half[2][3];
+			for (unsigned int h = 0; h < 2; ++h, p += 12) {
+				const __m256d v0 = _mm256_loadu_pd(p); // x0 y0 z0 x1
+				const __m256d v1 = _mm256_loadu_pd(p + 4); // y1 z1 x2 y2
+				const __m256d v2 = _mm256_loadu_pd(p + 8); // z2 x3 y3 z3
+				const __m256d v[3] = { _mm256_permute4x64_pd(_mm256_blend_pd(_mm256_blend_pd(v0, v1, 0x4), v2, 0x2), 0x6C),
+					_mm256_permute4x64_pd(_mm256_blend_pd(_mm256_blend_pd(v0, v1, 0x9), v2, 0x4), 0xB1),
+					_mm256_permute4x64_pd(_mm256_blend_pd(_mm256_blend_pd(v0, v1, 0x2), v2, 0x9), 0xC6) };
+				for (unsigned int axis = 0; axis < 3; ++axis) {
+					const __m256d q = _mm256_mul_pd(_mm256_sub_pd(v[axis], min[axis]), scale[axis]);
+					half[h][axis] = _mm256_cvttpd_epi32(_mm256_min_pd(_mm256_max_pd(q, _mm256_setzero_pd()), top));
+				}
+			}
+			for (unsigned int axis = 0; axis < 3; ++axis) {
+				cells[axis] = _mm256_inserti128_si256(_mm256_castsi128_si256(half[0][axis]), half[1][axis], 1);
+			}
+		}
+		// Encode 8 32-bit x, y and z cells and store the codes
+		LIBMORTON_TARGET("avx2") inline void encode3D_cells_x8(uint64_t* out, const __m256i* cells, const __m256i* masks) noexcept {
+			encode3D_64_x8(out, cells[0], cells[1], cells[2], masks);
+		}
+		LIBMORTON_TARGET("avx2") inline void encode3D_cells_x8(uint32_t* out, const __m256i* cells, const __m256i* masks) noexcept {
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out), encode3D_32(cells[0], cells[1], cells[2], masks));
+		}
+		LIBMORTON_TARGET("avx2") inline void encode3D_masks(const uint64_t*, __m256i* masks) noexcept {
+			for (unsigned int i = 0; i < 6; ++i) { masks[i] = _mm256_set1_epi64x(static_cast<long long>(magicbit3D_masks64_encode[i])); }
+		}
+		LIBMORTON_TARGET("avx2") inline void encode3D_masks(const uint32_t*, __m256i* masks) noexcept {
+			for (unsigned int i = 0; i < 6; ++i) { masks[i] = _mm256_set1_epi32(static_cast<int>(magicbit3D_masks32_encode[i])); }
+		}
+		// Quantize and encode 8 positions per iteration, without storing the cells anywhere
+		template<typename morton, typename coord, typename real>
+		LIBMORTON_TARGET("avx2") inline void encode3D_floats(const real* xyz, morton* out, size_t n, const morton_box<real>& box, unsigned int level) {
+			typedef decltype(broadcast(real())) vector;
+			level = std::min(level, static_cast<unsigned int>(sizeof(morton) * 8 / 3));
+			vector min[3], scale[3];
+			for (unsigned int axis = 0; axis < 3; ++axis) {
+				min[axis] = broadcast(box.min[axis]);
+				scale[axis] = broadcast(mortonQuantizeScale(box, axis, level));
+			}
+			const vector top = broadcast(static_cast<real>((static_cast<uint64_t>(1) << level) - 1));
+			__m256i masks[6];
+			encode3D_masks(out, masks);
+			size_t i = 0;
+			for (; i + 8 <= n; i += 8) {
+				__m256i cells[3];
+				quantize_xyz8(xyz + 3 * i, min, scale, top, cells);
+				encode3D_cells_x8(out + i, cells, masks);
+			}
+			m3D_e_magicbits_floats<morton, coord>(xyz + 3 * i, out + i, n - i, box, level);
+		}
+	}  // namespace avx2_detail
+
+	// ENCODE 3D 64-bit Morton codes in batch : AVX2 (4 lanes)
+	// Gives the same result as m3D_e_magicbits for every input, remaining elements are encoded with that method.
+	LIBMORTON_TARGET("avx2") inline void m3D_e_AVX2_batch(const uint32_t* x, const uint32_t* y, const uint32_t* z, uint64_t* out, size_t n) {
+		__m256i masks[6];
+		for (unsigned int i = 0; i < 6; ++i) {
+			masks[i] = _mm256_set1_epi64x(static_cast<long long>(magicbit3D_masks64_encode[i]));
+		}
+		size_t i = 0;
+		for (; i + 4 <= n; i += 4) {
+			const __m256i vx = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i)));
+			const __m256i vy = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(y + i)));
+			const __m256i vz = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(z + i)));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), avx2_detail::encode3D_64(vx, vy, vz, masks));
+		}
+		for (; i < n; ++i) {
+			out[i] = m3D_e_magicbits<uint64_t, uint32_t>(x[i], y[i], z[i]);
+		}
+	}
+
+	// ENCODE 3D 32-bit Morton codes in batch : AVX2 (8 lanes)
+	// Gives the same result as m3D_e_magicbits for every input, remaining elements are encoded with that method.
+	LIBMORTON_TARGET("avx2") inline void m3D_e_AVX2_batch(const uint16_t* x, const uint16_t* y, const uint16_t* z, uint32_t* out, size_t n) {
+		__m256i masks[6];
+		for (unsigned int i = 0; i < 6; ++i) {
+			masks[i] = _mm256_set1_epi32(static_cast<int>(magicbit3D_masks32_encode[i]));
+		}
+		size_t i = 0;
+		for (; i + 8 <= n; i += 8) {
+			const __m256i vx = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i)));
+			const __m256i vy = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(y + i)));
+			const __m256i vz = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(z + i)));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), avx2_detail::encode3D_32(vx, vy, vz, masks));
+		}
+		for (; i < n; ++i) {
+			out[i] = m3D_e_magicbits<uint32_t, uint16_t>(x[i], y[i], z[i]);
+		}
+	}
+
+	// DECODE 3D 64-bit Morton codes in batch : AVX2 (4 lanes)
+	// Gives the same result as m3D_d_magicbits for every input, remaining elements are decoded with that method.
+	LIBMORTON_TARGET("avx2") inline void m3D_d_AVX2_batch(const uint64_t* m, uint32_t* x, uint32_t* y, uint32_t* z, size_t n) {
+		__m256i masks[6];
+		for (unsigned int i = 0; i < 6; ++i) {
+			masks[i] = _mm256_set1_epi64x(static_cast<long long>(magicbit3D_masks64_decode[i]));
+		}
+		size_t i = 0;
+		for (; i + 4 <= n; i += 4) {
+			const __m256i vm = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m + i));
+			avx2_detail::store_lo32(x + i, avx2_detail::getThirdBits_64(vm, masks));
+			avx2_detail::store_lo32(y + i, avx2_detail::getThirdBits_64(_mm256_srli_epi64(vm, 1), masks));
+			avx2_detail::store_lo32(z + i, avx2_detail::getThirdBits_64(_mm256_srli_epi64(vm, 2), masks));
+		}
+		for (; i < n; ++i) {
+			m3D_d_magicbits<uint64_t, uint32_t>(m[i], x[i], y[i], z[i]);
+		}
+	}
+
+	// DECODE 3D 32-bit Morton codes in batch : AVX2 (8 lanes)
+	// Gives the same result as m3D_d_magicbits for every input, remaining elements are decoded with that method.
+	LIBMORTON_TARGET("avx2") inline void m3D_d_AVX2_batch(const uint32_t* m, uint16_t* x, uint16_t* y, uint16_t* z, size_t n) {
+		__m256i masks[6];
+		for (unsigned int i = 0; i < 6; ++i) {
+			masks[i] = _mm256_set1_epi32(static_cast<int>(magicbit3D_masks32_decode[i]));
+		}
+		size_t i = 0;
+		for (; i + 8 <= n; i += 8) {
+			const __m256i vm = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m + i));
+			avx2_detail::store_lo16(x + i, avx2_detail::getThirdBits_32(vm, masks));
+			avx2_detail::store_lo16(y + i, avx2_detail::getThirdBits_32(_mm256_srli_epi32(vm, 1), masks));
+			avx2_detail::store_lo16(z + i, avx2_detail::getThirdBits_32(_mm256_srli_epi32(vm, 2), masks));
+		}
+		for (; i < n; ++i) {
+			m3D_d_magicbits<uint32_t, uint16_t>(m[i], x[i], y[i], z[i]);
+		}
+	}
+
+	// ENCODE 2D 32-bit Morton codes in batch : AVX2 (16 pairs per iteration)
+	LIBMORTON_TARGET("avx2") inline void m2D_e_AVX2_batch(const uint16_t* x, const uint16_t* y, uint32_t* out, size_t n) {
+		size_t i = 0;
+		for (; i + 16 <= n; i += 16) {
+			const __m256i vx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i));
+			const __m256i vy = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + i));
+			// unpack works within 128-bit lanes: lo holds pairs 0-3 and 8-11, hi holds pairs 4-7 and 12-15
+			const __m256i lo = _mm256_unpacklo_epi16(vx, vy);
+			const __m256i hi = _mm256_unpackhi_epi16(vx, vy);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), avx2_detail::shuffle_32(_mm256_permute2x128_si256(lo, hi, 0x20)));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i + 8), avx2_detail::shuffle_32(_mm256_permute2x128_si256(lo, hi, 0x31)));
+		}
+		for (; i < n; ++i) {
+			out[i] = m2D_e_magicbits<uint32_t, uint16_t>(x[i], y[i]);
+		}
+	}
+
+	// ENCODE 2D 64-bit Morton codes in batch : AVX2 (8 pairs per iteration)
+	LIBMORTON_TARGET("avx2") inline void m2D_e_AVX2_batch(const uint32_t* x, const uint32_t* y, uint64_t* out, size_t n) {
+		size_t i = 0;
+		for (; i + 8 <= n; i += 8) {
+			const __m256i vx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i));
+			const __m256i vy = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + i));
+			avx2_detail::encode2D_64_x8(out + i, vx, vy);
+		}
+		for (; i < n; ++i) {
+			out[i] = m2D_e_magicbits<uint64_t, uint32_t>(x[i], y[i]);
+		}
+	}
+
+	// DECODE 2D 32-bit Morton codes in batch : AVX2 (16 codes per iteration)
+	LIBMORTON_TARGET("avx2") inline void m2D_d_AVX2_batch(const uint32_t* m, uint16_t* x, uint16_t* y, size_t n) {
+		const __m256i lowmask = _mm256_set1_epi32(0x0000FFFF);
+		size_t i = 0;
+		for (; i + 16 <= n; i += 16) {
+			const __m256i a = avx2_detail::unshuffle_32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(m + i)));
+			const __m256i b = avx2_detail::unshuffle_32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(m + i + 8)));
+			// pack works within 128-bit lanes, so restore the order of the 64-bit blocks afterwards
+			const __m256i vx = _mm256_packus_epi32(_mm256_and_si256(a, lowmask), _mm256_and_si256(b, lowmask));
+			const __m256i vy = _mm256_packus_epi32(_mm256_srli_epi32(a, 16), _mm256_srli_epi32(b, 16));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(x + i), _mm256_permute4x64_epi64(vx, 0xD8));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(y + i), _mm256_permute4x64_epi64(vy, 0xD8));
+		}
+		for (; i < n; ++i) {
+			m2D_d_magicbits<uint32_t, uint16_t>(m[i], x[i], y[i]);
+		}
+	}
+
+	// DECODE 2D 64-bit Morton codes in batch : AVX2 (8 codes per iteration)
+	LIBMORTON_TARGET("avx2") inline void m2D_d_AVX2_batch(const uint64_t* m, uint32_t* x, uint32_t* y, size_t n) {
+		size_t i = 0;
+		for (; i + 8 <= n; i += 8) {
+			const __m256 a = _mm256_castsi256_ps(avx2_detail::unshuffle_64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(m + i))));
+			const __m256 b = _mm256_castsi256_ps(avx2_detail::unshuffle_64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(m + i + 4))));
+			// shuffle works within 128-bit lanes, so restore the order of the 64-bit blocks afterwards
+			const __m256i vx = _mm256_castps_si256(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+			const __m256i vy = _mm256_castps_si256(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(x + i), _mm256_permute4x64_epi64(vx, 0xD8));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(y + i), _mm256_permute4x64_epi64(vy, 0xD8));
+		}
+		for (; i < n; ++i) {
+			m2D_d_magicbits<uint64_t, uint32_t>(m[i], x[i], y[i]);
+		}
+	}
+
+	// ENCODE 3D 64-bit Morton codes from strided records : AVX2
+	// Reads the 32-bit coordinates of n records of stride bytes in place, at byte offsets offx, offy and offz.
+	// Tightly packed {x, y, z} records are loaded with three vector loads and deinterleaved with blends and permutes,
+	// other layouts are gathered. Gives the same result as m3D_e_magicbits for every input.
+	LIBMORTON_TARGET("avx2") inline void m3D_e_AVX2_strided(const void* base, size_t stride, size_t offx, size_t offy, size_t offz, uint64_t* out, size_t n) {
+		const unsigned char* p = static_cast<const unsigned char*>(base);
+		__m256i masks[6];
+		for (unsigned int i = 0; i < 6; ++i) {
+			masks[i] = _mm256_set1_epi64x(static_cast<long long>(magicbit3D_masks64_encode[i]));
+		}
+		__m256i ix, iy, iz;
+		size_t i = 0;
+		if (stride == 3 * sizeof(uint32_t) && offx == 0 && offy == sizeof(uint32_t) && offz == 2 * sizeof(uint32_t)) {
+			// lane k of the blended vector holds coordinate k%3 of some point, permute puts point j in lane j
+			const __m256i perm_x = _mm256_set_epi32(5, 2, 7, 4, 1, 6, 3, 0);
+			const __m256i perm_y = _mm256_set_epi32(6, 3, 0, 5, 2, 7, 4, 1);
+			const __m256i perm_z = _mm256_set_epi32(7, 4, 1, 6, 3, 0, 5, 2);
+			for (; i + 8 <= n; i += 8) {
+				const __m256i* v = reinterpret_cast<const __m256i*>(p + i * stride);
+				const __m256i v0 = _mm256_loadu_si256(v); // x0 y0 z0 x1 y1 z1 x2 y2
+				const __m256i v1 = _mm256_loadu_si256(v + 1); // z2 x3 y3 z3 x4 y4 z4 x5
+				const __m256i v2 = _mm256_loadu_si256(v + 2); // y5 z5 x6 y6 z6 x7 y7 z7
+				const __m256i vx = _mm256_blend_epi32(_mm256_blend_epi32(v0, v1, 0x92), v2, 0x24);
+				const __m256i vy = _mm256_blend_epi32(_mm256_blend_epi32(v0, v1, 0x24), v2, 0x49);
+				const __m256i vz = _mm256_blend_epi32(_mm256_blend_epi32(v0, v1, 0x49), v2, 0x92);
+				avx2_detail::encode3D_64_x8(out + i, _mm256_permutevar8x32_epi32(vx, perm_x),
+					_mm256_permutevar8x32_epi32(vy, perm_y), _mm256_permutevar8x32_epi32(vz, perm_z), masks);
+			}
+		}
+		else if (avx2_detail::gather_index(stride, offx, ix) && avx2_detail::gather_index(stride, offy, iy) && avx2_detail::gather_index(stride, offz, iz)) {
+			for (; i + 8 <= n; i += 8) {
+				const unsigned char* record = p + i * stride;
+				avx2_detail::encode3D_64_x8(out + i, avx2_detail::gather_32(record, ix),
+					avx2_detail::gather_32(record, iy), avx2_detail::gather_32(record, iz), masks);
+			}
+		}
+		for (; i < n; ++i) {
+			const unsigned char* record = p + i * stride;
+			out[i] = m3D_e_magicbits<uint64_t, uint32_t>(loadCoord<uint32_t>(record + offx), loadCoord<uint32_t>(record + offy), loadCoord<uint32_t>(record + offz));
+		}
+	}
+
+	// ENCODE 3D 32-bit Morton codes from strided records : AVX2
+	// Reads the 16-bit coordinates of n records of stride bytes in place, at byte offsets offx, offy and offz.
+	// The 32-bit gathers read 2 bytes past each field, so the last record is always read by the scalar loop.
+	LIBMORTON_TARGET("avx2") inline void m3D_e_AVX2_strided(const void* base, size_t stride, size_t offx, size_t offy, size_t offz, uint32_t* out, size_t n) {
+		const unsigned char* p = static_cast<const unsigned char*>(base);
+		__m256i masks[6];
+		for (unsigned int i = 0; i < 6; ++i) {
+			masks[i] = _mm256_set1_epi32(static_cast<int>(magicbit3D_masks32_encode[i]));
+		}
+		__m256i ix, iy, iz;
+		size_t i = 0;
+		if (avx2_detail::gather_index(stride, offx, ix) && avx2_detail::gather_index(stride, offy, iy) && avx2_detail::gather_index(stride, offz, iz)) {
+			const __m256i lowmask = _mm256_set1_epi32(0x0000FFFF);
+			for (; i + 8 < n; i += 8) {
+				const unsigned char* record = p + i * stride;
+				const __m256i vx = _mm256_and_si256(avx2_detail::gather_32(record, ix), lowmask);
+				const __m256i vy = _mm256_and_si256(avx2_detail::gather_32(record, iy), lowmask);
+				const __m256i vz = _mm256_and_si256(avx2_detail::gather_32(record, iz), lowmask);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), avx2_detail::encode3D_32(vx, vy, vz, masks));
+			}
+		}
+		for (; i < n; ++i) {
+			const unsigned char* record = p + i * stride;
+			out[i] = m3D_e_magicbits<uint32_t, uint16_t>(loadCoord<uint16_t>(record + offx), loadCoord<uint16_t>(record + offy), loadCoord<uint16_t>(record + offz));
+		}
+	}
+
+	// ENCODE 3D Morton codes of packed {x, y, z} float / double positions : AVX2 (8 positions per iteration)
+	// Quantizes to the cells of box (2^level per axis) and encodes in the same pass, see m3D_e_magicbits_floats.
+	// Gives the same result as that method for every input, remaining positions are encoded with it.
+	LIBMORTON_TARGET("avx2") inline void m3D_e_AVX2_floats(const float* xyz, uint64_t* out, size_t n, const morton_box<float>& box, unsigned int level) {
+		avx2_detail::encode3D_floats<uint64_t, uint32_t>(xyz, out, n, box, level);
+	}
+	LIBMORTON_TARGET("avx2") inline void m3D_e_AVX2_floats(const float* xyz, uint32_t* out, size_t n, const morton_box<float>& box, unsigned int level) {
+		avx2_detail::encode3D_floats<uint32_t, uint16_t>(xyz, out, n, box, level);
+	}
+	LIBMORTON_TARGET("avx2") inline void m3D_e_AVX2_floats(const double* xyz, uint64_t* out, size_t n, const morton_box<double>& box, unsigned int level) {
+		avx2_detail::encode3D_floats<uint64_t, uint32_t>(xyz, out, n, box, level);
+	}
+	LIBMORTON_TARGET("avx2") inline void m3D_e_AVX2_floats(const double* xyz, uint32_t* out, size_t n, const morton_box<double>& box, unsigned int level) {
+		avx2_detail::encode3D_floats<uint32_t, uint16_t>(xyz, out, n, box, level);
+	}
+
+	// ENCODE 2D 64-bit Morton codes from strided records : AVX2
+	// Reads the 32-bit coordinates of n records of stride bytes in place, at byte offsets offx and offy.
+	LIBMORTON_TARGET("avx2") inline void m2D_e_AVX2_strided(const void* base, size_t stride, size_t offx, size_t offy, uint64_t* out, size_t n) {
+		const unsigned char* p = static_cast<const unsigned char*>(base);
+		__m256i ix, iy;
+		size_t i = 0;
+		if (avx2_detail::gather_index(stride, offx, ix) && avx2_detail::gather_index(stride, offy, iy)) {
+			for (; i + 8 <= n; i += 8) {
+				const unsigned char* record = p + i * stride;
+				avx2_detail::encode2D_64_x8(out + i, avx2_detail::gather_32(record, ix), avx2_detail::gather_32(record, iy));
+			}
+		}
+		for (; i < n; ++i) {
+			const unsigned char* record = p + i * stride;
+			out[i] = m2D_e_magicbits<uint64_t, uint32_t>(loadCoord<uint32_t>(record + offx), loadCoord<uint32_t>(record + offy));
+		}
+	}
+
+	// ENCODE 2D 32-bit Morton codes from strided records : AVX2
+	// Reads the 16-bit coordinates of n records of stride bytes in place, at byte offsets offx and offy.
+	// The 32-bit gathers read 2 bytes past each field, so the last record is always read by the scalar loop.
+	LIBMORTON_TARGET("avx2") inline void m2D_e_AVX2_strided(const void* base, size_t stride, size_t offx, size_t offy, uint32_t* out, size_t n) {
+		const unsigned char* p = static_cast<const unsigned char*>(base);
+		__m256i ix, iy;
+		size_t i = 0;
+		if (avx2_detail::gather_index(stride, offx, ix) && avx2_detail::gather_index(stride, offy, iy)) {
+			const __m256i lowmask = _mm256_set1_epi32(0x0000FFFF);
+			for (; i + 8 < n; i += 8) {
+				const unsigned char* record = p + i * stride;
+				// x in the low half, y in the high half of every lane, same as the batch method after unpacking
+				const __m256i v = _mm256_or_si256(_mm256_and_si256(avx2_detail::gather_32(record, ix), lowmask),
+					_mm256_slli_epi32(avx2_detail::gather_32(record, iy), 16));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), avx2_detail::shuffle_32(v));
+			}
+		}
+		for (; i < n; ++i) {
+			const unsigned char* record = p + i * stride;
+			out[i] = m2D_e_magicbits<uint32_t, uint16_t>(loadCoord<uint16_t>(record + offx), loadCoord<uint16_t>(record + offy));
+		}
+	}
+
+	// NEIGHBOURS of 3D Morton codes in batch : AVX2 (see m3D_neighbours)
+	LIBMORTON_TARGET("avx2") inline size_t m3D_neighbours_AVX2(const uint64_t* m, uint64_t* out, size_t n, const unsigned int level, const unsigned int connectivity, const morton_boundary boundary) {
+		unsigned char offsets[26][3];
+		const unsigned int count = mortonNeighbourOffsets(3, connectivity, offsets);
+		if (count == 0) { return 0; }
+		const uint64_t levelmask = mortonLevelMask<uint64_t>(3, level);
+		const uint64_t masks[3] = { morton3D_AxisMask<uint64_t>(0) & levelmask, morton3D_AxisMask<uint64_t>(1) & levelmask, morton3D_AxisMask<uint64_t>(2) & levelmask };
+		const size_t done = avx2_detail::neighbours_64<3>(m, out, n, masks, offsets, count, boundary);
+		m3D_neighbours<uint64_t>(m + done, out + done * count, n - done, level, connectivity, boundary);
+		return count;
+	}
+	LIBMORTON_TARGET("avx2") inline size_t m3D_neighbours_AVX2(const uint32_t* m, uint32_t* out, size_t n, const unsigned int level, const unsigned int connectivity, const morton_boundary boundary) {
+		unsigned char offsets[26][3];
+		const unsigned int count = mortonNeighbourOffsets(3, connectivity, offsets);
+		if (count == 0) { return 0; }
+		const uint32_t levelmask = mortonLevelMask<uint32_t>(3, level);
+		const uint32_t masks[3] = { morton3D_AxisMask<uint32_t>(0) & levelmask, morton3D_AxisMask<uint32_t>(1) & levelmask, morton3D_AxisMask<uint32_t>(2) & levelmask };
+		const size_t done = avx2_detail::neighbours_32<3>(m, out, n, masks, offsets, count, boundary);
+		m3D_neighbours<uint32_t>(m + done, out + done * count, n - done, level, connectivity, boundary);
+		return count;
+	}
+
+	// NEIGHBOURS of 2D Morton codes in batch : AVX2 (see m2D_neighbours)
+	LIBMORTON_TARGET("avx2") inline size_t m2D_neighbours_AVX2(const uint64_t* m, uint64_t* out, size_t n, const unsigned int level, const unsigned int connectivity, const morton_boundary boundary) {
+		unsigned char offsets[26][3];
+		const unsigned int count = mortonNeighbourOffsets(2, connectivity, offsets);
+		if (count == 0 || (boundary == morton_boundary::invalid && 2 * level >= sizeof(uint64_t) * 8)) { return 0; }
+		const uint64_t levelmask = mortonLevelMask<uint64_t>(2, level);
+		const uint64_t masks[2] = { morton2D_AxisMask<uint64_t>(0) & levelmask, morton2D_AxisMask<uint64_t>(1) & levelmask };
+		const size_t done = avx2_detail::neighbours_64<2>(m, out, n, masks, offsets, count, boundary);
+		m2D_neighbours<uint64_t>(m + done, out + done * count, n - done, level, connectivity, boundary);
+		return count;
+	}
+	LIBMORTON_TARGET("avx2") inline size_t m2D_neighbours_AVX2(const uint32_t* m, uint32_t* out, size_t n, const unsigned int level, const unsigned int connectivity, const morton_boundary boundary) {
+		unsigned char offsets[26][3];
+		const unsigned int count = mortonNeighbourOffsets(2, connectivity, offsets);
+		if (count == 0 || (boundary == morton_boundary::invalid && 2 * level >= sizeof(uint32_t) * 8)) { return 0; }
+		const uint32_t levelmask = mortonLevelMask<uint32_t>(2, level);
+		const uint32_t masks[2] = { morton2D_AxisMask<uint32_t>(0) & levelmask, morton2D_AxisMask<uint32_t>(1) & levelmask };
+		const size_t done = avx2_detail::neighbours_32<2>(m, out, n, masks, offsets, count, boundary);
+		m2D_neighbours<uint32_t>(m + done, out + done * count, n - done, level, connectivity, boundary);
+		return count;
+	}
+}
+#endif
@@ -0,0 +1,118 @@
+#pragma once
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "morton2D.h"
+
+// Libmorton - Methods to encode/decode batches of 2D Morton codes using the SSE2 instruction set
+// Like m2D_e_magicbits_combined, x and y share one lane (x in the lower half, y in the upper half).
+// Instead of spreading both halves and merging them, the lane goes through a perfect shuffle
+// (a sequence of delta swaps), which leaves the finished code in place. Decoding runs the same swaps in reverse.
+
+namespace libmorton {
+
+	namespace sse2_detail {
+		// Swap the bits selected by mask with the bits shift positions above them
+		inline __m128i deltaswap_32(__m128i v, const int shift, const __m128i mask) noexcept {
+			const __m128i t = _mm_and_si128(_mm_xor_si128(v, _mm_srli_epi32(v, shift)), mask);
+			return _mm_xor_si128(v, _mm_xor_si128(t, _mm_slli_epi32(t, shift)));
+		}
+		inline __m128i deltaswap_64(__m128i v, const int shift, const __m128i mask) noexcept {
+			const __m128i t = _mm_and_si128(_mm_xor_si128(v, _mm_srli_epi64(v, shift)), mask);
+			return _mm_xor_si128(v, _mm_xor_si128(t, _mm_slli_epi64(t, shift)));
+		}
+		// (x | y << 16) in every 32-bit lane <-> 32-bit morton code
+		inline __m128i shuffle_32(__m128i v) noexcept {
+			v = deltaswap_32(v, 8, _mm_set1_epi32(0x0000FF00));
+			v = deltaswap_32(v, 4, _mm_set1_epi32(0x00F000F0));
+			v = deltaswap_32(v, 2, _mm_set1_epi32(0x0C0C0C0C));
+			v = deltaswap_32(v, 1, _mm_set1_epi32(0x22222222));
+			return v;
+		}
+		inline __m128i unshuffle_32(__m128i v) noexcept {
+			v = deltaswap_32(v, 1, _mm_set1_epi32(0x22222222));
+			v = deltaswap_32(v, 2, _mm_set1_epi32(0x0C0C0C0C));
+			v = deltaswap_32(v, 4, _mm_set1_epi32(0x00F000F0));
+			v = deltaswap_32(v, 8, _mm_set1_epi32(0x0000FF00));
+			return v;
+		}
+		// (x | y << 32) in every 64-bit lane <-> 64-bit morton code
+		inline __m128i shuffle_64(__m128i v) noexcept {
+			v = deltaswap_64(v, 16, _mm_set_epi32(0, static_cast<int>(0xFFFF0000), 0, static_cast<int>(0xFFFF0000)));
+			v = deltaswap_64(v, 8, _mm_set1_epi32(0x0000FF00));
+			v = deltaswap_64(v, 4, _mm_set1_epi32(0x00F000F0));
+			v = deltaswap_64(v, 2, _mm_set1_epi32(0x0C0C0C0C));
+			v = deltaswap_64(v, 1, _mm_set1_epi32(0x22222222));
+			return v;
+		}
+		inline __m128i unshuffle_64(__m128i v) noexcept {
+			v = deltaswap_64(v, 1, _mm_set1_epi32(0x22222222));
+			v = deltaswap_64(v, 2, _mm_set1_epi32(0x0C0C0C0C));
+			v = deltaswap_64(v, 4, _mm_set1_epi32(0x00F000F0));
+			v = deltaswap_64(v, 8, _mm_set1_epi32(0x0000FF00));
+			v = deltaswap_64(v, 16, _mm_set_epi32(0, static_cast<int>(0xFFFF0000), 0, static_cast<int>(0xFFFF0000)));
+			return v;
+		}
+	}  // namespace sse2_detail
+
+	// ENCODE 2D 32-bit Morton codes in batch : SSE2 (8 pairs per iteration)
+	inline void m2D_e_SSE2_batch(const uint16_t* x, const uint16_t* y, uint32_t* out, size_t n) {
+		size_t i = 0;
+		for (; i + 8 <= n; i += 8) {
+			const __m128i vx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i));
+			const __m128i vy = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + i));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), sse2_detail::shuffle_32(_mm_unpacklo_epi16(vx, vy)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 4), sse2_detail::shuffle_32(_mm_unpackhi_epi16(vx, vy)));
+		}
+		for (; i < n; ++i) {
+			out[i] = m2D_e_magicbits<uint32_t, uint16_t>(x[i], y[i]);
+		}
+	}
+
+	// ENCODE 2D 64-bit Morton codes in batch : SSE2 (4 pairs per iteration)
+	inline void m2D_e_SSE2_batch(const uint32_t* x, const uint32_t* y, uint64_t* out, size_t n) {
+		size_t i = 0;
+		for (; i + 4 <= n; i += 4) {
+			const __m128i vx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i));
+			const __m128i vy = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + i));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), sse2_detail::shuffle_64(_mm_unpacklo_epi32(vx, vy)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 2), sse2_detail::shuffle_64(_mm_unpackhi_epi32(vx, vy)));
+		}
+		for (; i < n; ++i) {
+			out[i] = m2D_e_magicbits<uint64_t, uint32_t>(x[i], y[i]);
+		}
+	}
+
+	// DECODE 2D 32-bit Morton codes in batch : SSE2 (8 codes per iteration)
+	inline void m2D_d_SSE2_batch(const uint32_t* m, uint16_t* x, uint16_t* y, size_t n) {
+		size_t i = 0;
+		for (; i + 8 <= n; i += 8) {
+			const __m128i a = sse2_detail::unshuffle_32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(m + i)));
+			const __m128i b = sse2_detail::unshuffle_32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(m + i + 4)));
+			// sign-extend the 16-bit halves, so the signed saturating pack gives back the original bits
+			const __m128i vx = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+			const __m128i vy = _mm_packs_epi32(_mm_srai_epi32(a, 16), _mm_srai_epi32(b, 16));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(x + i), vx);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(y + i), vy);
+		}
+		for (; i < n; ++i) {
+			m2D_d_magicbits<uint32_t, uint16_t>(m[i], x[i], y[i]);
+		}
+	}
+
+	// DECODE 2D 64-bit Morton codes in batch : SSE2 (4 codes per iteration)
+	inline void m2D_d_SSE2_batch(const uint64_t* m, uint32_t* x, uint32_t* y, size_t n) {
+		size_t i = 0;
+		for (; i + 4 <= n; i += 4) {
+			const __m128 a = _mm_castsi128_ps(sse2_detail::unshuffle_64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(m + i))));
+			const __m128 b = _mm_castsi128_ps(sse2_detail::unshuffle_64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(m + i + 2))));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(x + i), _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0))));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(y + i), _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))));
+		}
+		for (; i < n; ++i) {
+			m2D_d_magicbits<uint64_t, uint32_t>(m[i], x[i], y[i]);
+		}
+	}
+}
+#endif
@@ -0,0 +1,155 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include "morton_common.h"
+#include "morton_parallel.h"
+
+// Libmorton - Building a bounding volume hierarchy (binary radix tree) over a sorted array of Morton codes
+// Karras, "Maximizing Parallelism in the Construction of BVHs, Octrees, and k-d Trees" (HPG 2012): with n sorted keys, the
+// n - 1 internal nodes are numbered so that node i starts or ends at key i. Every internal node finds its own key range and
+// split from the length of the common prefix of two keys (the leading zeros of their XOR), so all of them are built
+// independently. Duplicate keys get their index as a tie-breaker (the common prefix of the indices is added to the length).
+// The bounding boxes are filled in bottom-up: every leaf walks up the tree, and at every node the first of its two children
+// to arrive stops, while the second one (knowing both children are done) computes the box and goes on to the parent.
+
+namespace libmorton {
+
+	// Set in a child index when the child is a leaf (the rest of the index is the leaf, which is the index of its key)
+	static const size_t morton_bvh_leaf = ~(~static_cast<size_t>(0) >> 1);
+	// No node (parent of the root)
+	static const size_t morton_bvh_none = ~static_cast<size_t>(0);
+
+	// An internal node of the hierarchy
+	struct morton_bvh_node {
+		size_t left; // internal node index, or leaf index | morton_bvh_leaf
+		size_t right; // internal node index, or leaf index | morton_bvh_leaf
+		size_t parent; // morton_bvh_none for the root
+		morton_aabb bounds; // filled in by m3D_refit_bvh
+	};
+
+	// The hierarchy over n keys: n - 1 internal nodes with the root at index 0 (with a single key, the root is leaf 0)
+	struct morton_bvh {
+		std::vector<morton_bvh_node> nodes;
+		std::vector<size_t> leaf_parent; // parent of every leaf, morton_bvh_none when there's a single leaf
+	};
+
+	namespace bvh_detail {
+		// Length of the common prefix of keys i and j (in bits), -1 when j is outside the array
+		template<typename morton>
+		inline int common_prefix(const morton* keys, const size_t n, const int64_t i, const int64_t j) {
+			if (j < 0 || j >= static_cast<int64_t>(n)) { return -1; }
+			const int bits = static_cast<int>(sizeof(morton) * 8);
+			unsigned long msb = 0;
+			if (findFirstSetBitZeroIdx<morton>(static_cast<morton>(keys[i] ^ keys[j]), &msb)) { return bits - 1 - static_cast<int>(msb); }
+			findFirstSetBitZeroIdx<uint64_t>(static_cast<uint64_t>(i ^ j), &msb); // equal keys: i != j
+			return bits + 63 - static_cast<int>(msb);
+		}
+
+		// Range and split of internal node i (Karras, figure 4)
+		template<typename morton>
+		inline void build_node(const morton* keys, const size_t n, const int64_t i, morton_bvh& bvh) {
+			// direction of the range: towards the neighbour with the longer common prefix
+			const int64_t d = (common_prefix(keys, n, i, i + 1) > common_prefix(keys, n, i, i - 1)) ? 1 : -1;
+			// upper bound for the length of the range, then the other end with a binary search
+			const int min_prefix = common_prefix(keys, n, i, i - d);
+			int64_t max_length = 2;
+			while (common_prefix(keys, n, i, i + max_length * d) > min_prefix) { max_length *= 2; }
+			int64_t length = 0;
+			for (int64_t t = max_length / 2; t >= 1; t /= 2) {
+				if (common_prefix(keys, n, i, i + (length + t) * d) > min_prefix) { length += t; }
+			}
+			const int64_t j = i + length * d;
+			// split: the last key that shares more than the common prefix of the whole range with key i
+			const int node_prefix = common_prefix(keys, n, i, j);
+			int64_t split = 0;
+			for (int64_t divisor = 2;; divisor *= 2) {
+				const int64_t t = (length + divisor - 1) / divisor;
+				if (common_prefix(keys, n, i, i + (split + t) * d) > node_prefix) { split += t; }
+				if (t == 1) { break; }
+			}
+			const int64_t gamma = i + split * d + std::min<int64_t>(d, 0);
+			morton_bvh_node& node = bvh.nodes[static_cast<size_t>(i)];
+			const size_t g = static_cast<size_t>(gamma);
+			if (std::min(i, j) == gamma) {
+				node.left = g | morton_bvh_leaf;
+				bvh.leaf_parent[g] = static_cast<size_t>(i);
+			}
+			else {
+				node.left = g;
+				bvh.nodes[g].parent = static_cast<size_t>(i);
+			}
+			if (std::max(i, j) == gamma + 1) {
+				node.right = (g + 1) | morton_bvh_leaf;
+				bvh.leaf_parent[g + 1] = static_cast<size_t>(i);
+			}
+			else {
+				node.right = g + 1;
+				bvh.nodes[g + 1].parent = static_cast<size_t>(i);
+			}
+		}
+
+		inline const morton_aabb& child_bounds(const morton_bvh& bvh, const morton_aabb* leaf_bounds, const size_t child) {
+			return (child & morton_bvh_leaf) ? leaf_bounds[child & ~morton_bvh_leaf] : bvh.nodes[child].bounds;
+		}
+
+		template<typename morton, typename executor_or_threads>
+		inline size_t build_bvh(const morton* keys, const size_t n, morton_bvh& bvh, const executor_or_threads& threads) {
+			bvh.nodes.resize(n > 0 ? n - 1 : 0);
+			bvh.leaf_parent.assign(n, morton_bvh_none);
+			if (n < 2) { return 0; }
+			bvh.nodes[0].parent = morton_bvh_none;
+			parallel_detail::for_chunks(n - 1, threads, [&](const size_t, const size_t begin, const size_t end) {
+				for (size_t i = begin; i < end; ++i) { build_node<morton>(keys, n, static_cast<int64_t>(i), bvh); }
+			});
+			return n - 1;
+		}
+
+		template<typename executor_or_threads>
+		inline void refit_bvh(morton_bvh& bvh, const morton_aabb* leaf_bounds, const executor_or_threads& threads) {
+			if (bvh.nodes.empty()) { return; }
+			// number of children of every node that are done
+			std::vector<std::atomic<unsigned int> > arrived(bvh.nodes.size());
+			parallel_detail::for_chunks(bvh.nodes.size(), threads, [&](const size_t, const size_t begin, const size_t end) {
+				for (size_t i = begin; i < end; ++i) { arrived[i].store(0, std::memory_order_relaxed); }
+			});
+			parallel_detail::for_chunks(bvh.leaf_parent.size(), threads, [&](const size_t, const size_t begin, const size_t end) {
+				for (size_t leaf = begin; leaf < end; ++leaf) {
+					size_t node = bvh.leaf_parent[leaf];
+					// the first child to arrive stops, the second one fills in the box (release/acquire: it sees the box of the first)
+					while (node != morton_bvh_none && arrived[node].fetch_add(1, std::memory_order_acq_rel) == 1) {
+						morton_bvh_node& current = bvh.nodes[node];
+						const morton_aabb& a = child_bounds(bvh, leaf_bounds, current.left);
+						const morton_aabb& b = child_bounds(bvh, leaf_bounds, current.right);
+						for (int axis = 0; axis < 3; ++axis) {
+							current.bounds.min[axis] = std::min(a.min[axis], b.min[axis]);
+							current.bounds.max[axis] = std::max(a.max[axis], b.max[axis]);
+						}
+						node = current.parent;
+					}
+				}
+			});
+		}
+	}  // namespace bvh_detail
+
+	// BUILD the hierarchy over a sorted array of 3D Morton codes (threads = 1: on the calling thread, 0: all hardware threads)
+	// Leaf i is key i. Returns the number of internal nodes. The bounds are filled in by m3D_refit_bvh.
+	template<typename morton>
+	inline size_t m3D_build_bvh(const morton* keys, const size_t n, morton_bvh& bvh, const unsigned int threads = 1) {
+		return bvh_detail::build_bvh<morton>(keys, n, bvh, threads);
+	}
+	template<typename morton>
+	inline size_t m3D_build_bvh(const morton* keys, const size_t n, morton_bvh& bvh, const morton_executor& executor) {
+		return bvh_detail::build_bvh<morton>(keys, n, bvh, executor);
+	}
+
+	// REFIT the bounding boxes of the internal nodes, bottom-up, from the boxes of the leaves (in the order of the sorted keys)
+	inline void m3D_refit_bvh(morton_bvh& bvh, const morton_aabb* leaf_bounds, const unsigned int threads = 1) {
+		bvh_detail::refit_bvh(bvh, leaf_bounds, threads);
+	}
+	inline void m3D_refit_bvh(morton_bvh& bvh, const morton_aabb* leaf_bounds, const morton_executor& executor) {
+		bvh_detail::refit_bvh(bvh, leaf_bounds, executor);
+	}
+}
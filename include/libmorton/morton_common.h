@@ -2,11 +2,38 @@
 
 // Libmorton - Common helper methods needed in Morton encoding/decoding
 
+#include <algorithm>
+#include <stddef.h>
 #include <stdint.h>
+#include <string.h>
+#include <vector>
 #if defined(_MSC_VER)
 #include <intrin.h>
 #endif
 
+// Portable x86-64 builds (no BMI2/AVX2 at compile time) select the BMI2 and AVX2 methods at runtime, see morton_dispatch.h
+// Define LIBMORTON_NO_RUNTIME_DISPATCH to always use the portable methods in such builds.
+#if !defined(LIBMORTON_NO_RUNTIME_DISPATCH) && !defined(LIBMORTON_RUNTIME_DISPATCH) \
+	&& !defined(__BMI2__) && !defined(__AVX2__) && !defined(__AVX512BITALG__) \
+	&& (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(_MSC_VER))
+#define LIBMORTON_RUNTIME_DISPATCH
+#endif
+
+// Compile a method for an instruction set the build doesn't target, so it can be called after a runtime check
+// (MSVC doesn't need this: its intrinsics are always available)
+#if defined(LIBMORTON_RUNTIME_DISPATCH) && defined(__GNUC__)
+#define LIBMORTON_TARGET(isa) __attribute__((target(isa)))
+#else
+#define LIBMORTON_TARGET(isa)
+#endif
+
+// Bits of every axis in a 2D / 3D morton code (pdep/pext masks, also used for dilated integer arithmetic)
+#define BMI_2D_X_MASK 0x5555555555555555
+#define BMI_2D_Y_MASK 0xAAAAAAAAAAAAAAAA
+#define BMI_3D_X_MASK 0x9249249249249249
+#define BMI_3D_Y_MASK 0x2492492492492492
+#define BMI_3D_Z_MASK 0x4924924924924924
+
 namespace libmorton {
 	template<typename morton>
 	inline bool findFirstSetBitZeroIdx(const morton x, unsigned long* firstbit_location) {
@@ -46,4 +73,381 @@ namespace libmorton {
 		}
 		return false;
 	}
-}
\ No newline at end of file
+
+	// Read a coordinate from a (possibly unaligned) address inside a record, used by the strided encoders
+	template<typename coord>
+	inline coord loadCoord(const unsigned char* address) {
+		coord c;
+		memcpy(&c, address, sizeof(coord));
+		return c;
+	}
+
+	// An axis-aligned box in space (morton_aabb for float coordinates)
+	template<typename real>
+	struct morton_box {
+		real min[3];
+		real max[3];
+	};
+	typedef morton_box<float> morton_aabb;
+
+	// HELPER METHOD: cells per unit of length on one axis of box, in a grid of 2^level cells per axis (0 for an empty axis)
+	template<typename real>
+	inline real mortonQuantizeScale(const morton_box<real>& box, const unsigned int axis, const unsigned int level) {
+		const real extent = box.max[axis] - box.min[axis];
+		return (extent > 0) ? static_cast<real>(static_cast<uint64_t>(1) << level) / extent : static_cast<real>(0);
+	}
+
+	// HELPER METHOD: the cell of position p on an axis starting at min, floor((p - min) * scale) clamped to [0, top]
+	// Positions outside the box go to the cell on its boundary, NaN goes to cell 0. The SIMD methods do the same arithmetic.
+	template<typename coord, typename real>
+	inline coord mortonQuantize(const real p, const real min, const real scale, const real top) {
+		real v = (p - min) * scale;
+		v = (v > 0) ? v : static_cast<real>(0);
+		v = (v < top) ? v : top;
+		return static_cast<coord>(v);
+	}
+
+	// Add the axis selected by mask of two morton codes (dilated integer addition), leaving the other axes of m as they are
+	// Setting the bits of the other axes makes the carries run through them to the next bit of the axis.
+	template<typename morton>
+	inline morton dilatedAdd(const morton m, const morton d, const morton mask) {
+		return static_cast<morton>((((m | static_cast<morton>(~mask)) + (d & mask)) & mask) | (m & static_cast<morton>(~mask)));
+	}
+
+	// Subtract the axis selected by mask of two morton codes (dilated integer subtraction), leaving the other axes of m as they are
+	// Clearing the bits of the other axes makes the borrows run through them to the next bit of the axis.
+	template<typename morton>
+	inline morton dilatedSub(const morton m, const morton d, const morton mask) {
+		return static_cast<morton>((((m & mask) - (d & mask)) & mask) | (m & static_cast<morton>(~mask)));
+	}
+
+	// What the neighbour methods emit for a neighbour outside the grid
+	enum class morton_boundary {
+		clamp, // the cell on the boundary itself
+		wrap, // the cell on the opposite side of the grid (periodic grid)
+		invalid // mortonInvalid<morton>() (not for 2D codes at the full width, see mortonInvalid)
+	};
+
+	// Marker for neighbours outside the grid: all bits set
+	// This is never a valid code, except for 2D codes at the full width (the cell (max, max)), for which the 2D neighbour
+	// methods don't take morton_boundary::invalid.
+	template<typename morton>
+	inline morton mortonInvalid() {
+		return static_cast<morton>(~static_cast<morton>(0));
+	}
+
+	// HELPER METHOD: the bits of a morton code used by a grid of 2^level cells per axis
+	template<typename morton>
+	inline morton mortonLevelMask(const unsigned int dims, const unsigned int level) {
+		return (dims * level >= sizeof(morton) * 8) ? static_cast<morton>(~static_cast<morton>(0)) : static_cast<morton>((static_cast<morton>(1) << (dims * level)) - 1);
+	}
+
+	// HELPER METHOD: the top bit of every axis in a code with fieldbits bits per axis
+	// Flipping these biases signed coordinates by 2^(fieldbits - 1), so that the codes sort in spatial order across 0.
+	template<typename morton>
+	inline morton mortonSignBits(const unsigned int dims, const unsigned int fieldbits) {
+		return static_cast<morton>(mortonLevelMask<morton>(dims, fieldbits) & static_cast<morton>(~mortonLevelMask<morton>(dims, fieldbits - 1)));
+	}
+
+	// HELPER METHOD: the signed coordinate of a fieldbits-bit coordinate decoded from a code with the sign bits flipped
+	template<typename scoord, typename coord>
+	inline scoord mortonUnbias(const coord c, const unsigned int fieldbits) {
+		return static_cast<scoord>(static_cast<int64_t>(c) - (static_cast<int64_t>(1) << (fieldbits - 1)));
+	}
+
+	// HELPER METHOD: the bits of the axis selected by mask of the cells before, at and after m on that axis
+	// Neighbours are the OR of these, one per axis, which is why an invalid step is all bits set.
+	template<typename morton>
+	inline void mortonAxisSteps(const morton m, const morton mask, const morton_boundary boundary, morton steps[3]) {
+		const morton same = m & mask;
+		const morton lowbit = mask & static_cast<morton>(~mask + 1);
+		steps[0] = dilatedSub<morton>(same, lowbit, mask); // wraps to mask at 0
+		steps[1] = same;
+		steps[2] = dilatedAdd<morton>(same, lowbit, mask); // wraps to 0 at mask
+		if (boundary != morton_boundary::wrap) {
+			const morton outside = (boundary == morton_boundary::clamp) ? same : mortonInvalid<morton>();
+			if (same == 0) { steps[0] = outside; }
+			if (same == mask) { steps[2] = outside; }
+		}
+	}
+
+	// HELPER METHOD: list the neighbour offsets for a connectivity, in the order the neighbour methods emit them
+	// Every offset is 0 (-1), 1 (same) or 2 (+1) per axis. x changes fastest, then y, then z, from -1 to +1,
+	// skipping the cell itself and the neighbours that change more axes than the connectivity allows (faces: 1, edges: 2, corners: 3).
+	// Returns the number of neighbours, or 0 for an unsupported connectivity (2D: 4 or 8, 3D: 6, 18 or 26).
+	inline unsigned int mortonNeighbourOffsets(const unsigned int dims, const unsigned int connectivity, unsigned char offsets[26][3]) {
+		unsigned int maxchanged = 0;
+		if (dims == 2) { maxchanged = (connectivity == 4) ? 1 : ((connectivity == 8) ? 2 : 0); }
+		if (dims == 3) { maxchanged = (connectivity == 6) ? 1 : ((connectivity == 18) ? 2 : ((connectivity == 26) ? 3 : 0)); }
+		unsigned int count = 0;
+		for (unsigned int dz = 0; dz < ((dims == 3) ? 3u : 1u); ++dz) {
+			for (unsigned int dy = 0; dy < 3; ++dy) {
+				for (unsigned int dx = 0; dx < 3; ++dx) {
+					const unsigned int changed = (dx != 1) + (dy != 1) + (dims == 3 && dz != 1);
+					if (changed == 0 || changed > maxchanged) { continue; }
+					offsets[count][0] = static_cast<unsigned char>(dx);
+					offsets[count][1] = static_cast<unsigned char>(dy);
+					offsets[count][2] = static_cast<unsigned char>((dims == 3) ? dz : 1);
+					++count;
+				}
+			}
+		}
+		return count;
+	}
+
+	// HELPER METHOD: BIGMIN search (Tropf and Herzog, 1981) for codes with the given axis masks
+	// Walks the bits from the top, shrinking [zmin, zmax] to the half of the box that can still hold the answer.
+	template<typename morton>
+	inline morton mortonBigMin(const morton zcur, morton zmin, morton zmax, const morton* axismasks, const unsigned int dims) {
+		morton bigmin = zmax;
+		for (int b = static_cast<int>(sizeof(morton) * 8) - 1; b >= 0; --b) {
+			const morton bit = static_cast<morton>(static_cast<morton>(1) << b);
+			if (!((zcur ^ zmin) & bit) && !((zmin ^ zmax) & bit)) { continue; } // 0 0 0, 1 1 1: same half
+			unsigned int axis = 0;
+			while (axis < dims && !(axismasks[axis] & bit)) { ++axis; }
+			if (axis == dims) { continue; } // bit not used by any axis
+			const morton below = axismasks[axis] & static_cast<morton>(bit - 1); // lower bits of the same axis
+			switch (((zcur & bit) ? 4 : 0) | ((zmin & bit) ? 2 : 0) | ((zmax & bit) ? 1 : 0)) {
+			case 1: // 0 0 1: the answer is either in the upper half (its smallest code) or in the lower half
+				bigmin = static_cast<morton>((zmin & static_cast<morton>(~below)) | bit);
+				zmax = static_cast<morton>((zmax | below) & static_cast<morton>(~bit));
+				break;
+			case 3: return zmin; // 0 1 1: the whole box is above zcur
+			case 4: return bigmin; // 1 0 0: the whole box is below zcur
+			case 5: // 1 0 1: continue in the upper half
+				zmin = static_cast<morton>((zmin & static_cast<morton>(~below)) | bit);
+				break;
+			default: break; // 0 0 0, 1 1 1: same half, 0 1 0, 1 1 0: can't happen when zmin <= zmax
+			}
+		}
+		return bigmin;
+	}
+
+	// HELPER METHOD: LITMAX search (Tropf and Herzog, 1981) for codes with the given axis masks, the mirror image of mortonBigMin
+	template<typename morton>
+	inline morton mortonLitMax(const morton zcur, morton zmin, morton zmax, const morton* axismasks, const unsigned int dims) {
+		morton litmax = zmin;
+		for (int b = static_cast<int>(sizeof(morton) * 8) - 1; b >= 0; --b) {
+			const morton bit = static_cast<morton>(static_cast<morton>(1) << b);
+			if (!((zcur ^ zmin) & bit) && !((zmin ^ zmax) & bit)) { continue; } // 0 0 0, 1 1 1: same half
+			unsigned int axis = 0;
+			while (axis < dims && !(axismasks[axis] & bit)) { ++axis; }
+			if (axis == dims) { continue; }
+			const morton below = axismasks[axis] & static_cast<morton>(bit - 1);
+			switch (((zcur & bit) ? 4 : 0) | ((zmin & bit) ? 2 : 0) | ((zmax & bit) ? 1 : 0)) {
+			case 1: // 0 0 1: continue in the lower half
+				zmax = static_cast<morton>((zmax | below) & static_cast<morton>(~bit));
+				break;
+			case 3: return litmax; // 0 1 1: the whole box is above zcur
+			case 4: return zmax; // 1 0 0: the whole box is below zcur
+			case 5: // 1 0 1: the answer is either in the lower half (its largest code) or in the upper half
+				litmax = static_cast<morton>((zmax | below) & static_cast<morton>(~bit));
+				zmin = static_cast<morton>((zmin & static_cast<morton>(~below)) | bit);
+				break;
+			default: break;
+			}
+		}
+		return litmax;
+	}
+
+	// HELPER METHOD: is code m inside the box with corner codes zmin and zmax (compares every axis on its own bits)
+	template<typename morton>
+	inline bool mortonInBox(const morton m, const morton zmin, const morton zmax, const morton* axismasks, const unsigned int dims) {
+		for (unsigned int axis = 0; axis < dims; ++axis) {
+			const morton v = m & axismasks[axis];
+			if (v < (zmin & axismasks[axis]) || v > (zmax & axismasks[axis])) { return false; }
+		}
+		return true;
+	}
+
+	// HELPER METHOD: call visit(begin, end) for every run keys[begin, end) of a sorted key array that lies inside the box,
+	// jumping over the keys outside the box with BIGMIN and a binary search. Returns the number of keys inside the box.
+	template<typename morton, typename visitor>
+	inline size_t mortonBoxScan(const morton* keys, const size_t n, const morton zmin, const morton zmax, const morton* axismasks, const unsigned int dims, visitor visit) {
+		size_t hits = 0;
+		size_t i = static_cast<size_t>(std::lower_bound(keys, keys + n, zmin) - keys);
+		while (i < n && keys[i] <= zmax) {
+			if (mortonInBox<morton>(keys[i], zmin, zmax, axismasks, dims)) {
+				const size_t begin = i;
+				while (i < n && keys[i] <= zmax && mortonInBox<morton>(keys[i], zmin, zmax, axismasks, dims)) { ++i; }
+				visit(begin, i);
+				hits += i - begin;
+			}
+			else {
+				// keys[i] < zmax, since zmax itself is inside the box
+				const morton next = mortonBigMin<morton>(keys[i], zmin, zmax, axismasks, dims);
+				i = static_cast<size_t>(std::lower_bound(keys + i + 1, keys + n, next) - keys);
+			}
+		}
+		return hits;
+	}
+
+	// A range [lo, hi] of morton codes (both ends included)
+	template<typename morton>
+	struct morton_interval {
+		morton lo;
+		morton hi;
+	};
+
+	// HELPER METHOD: decompose the box with corner codes zmin and zmax into the sorted intervals of codes inside it
+	// Subdivides the code space level by level (quadrants / octants, in Morton order), keeping cells that are fully inside
+	// the box and splitting the ones that are partly inside. With max_intervals = 0 the result is exact and minimal (every
+	// interval is a maximal run of codes inside the box). Otherwise the subdivision stops before the first level that would
+	// need more than max_intervals intervals, and the cells that are still partly inside are kept whole (trimmed to their
+	// first and last code inside the box), over-approximating the box.
+	template<typename morton>
+	inline size_t mortonBoxIntervals(const morton zmin, const morton zmax, const morton* axismasks, const unsigned int dims,
+		const size_t max_intervals, std::vector<morton_interval<morton> >& out) {
+		struct cell { morton lo; morton hi; bool partial; };
+		// 0: outside, 1: partly inside, 2: inside (compares every axis on its own bits, which keeps the order)
+		const auto classify = [&](const morton lo, const morton hi) {
+			int result = 2;
+			for (unsigned int axis = 0; axis < dims; ++axis) {
+				const morton cmin = lo & axismasks[axis], cmax = hi & axismasks[axis];
+				const morton bmin = zmin & axismasks[axis], bmax = zmax & axismasks[axis];
+				if (cmax < bmin || cmin > bmax) { return 0; }
+				if (cmin < bmin || cmax > bmax) { result = 1; }
+			}
+			return result;
+		};
+		// add a cell, merging it with the previous one when both are inside and touch
+		const auto append = [](std::vector<cell>& cells, const cell& c) {
+			if (!c.partial && !cells.empty() && !cells.back().partial && cells.back().hi + 1 == c.lo) { cells.back().hi = c.hi; }
+			else { cells.push_back(c); }
+		};
+		unsigned int level = static_cast<unsigned int>(sizeof(morton) * 8) / dims;
+		std::vector<cell> cells, next;
+		const morton root = mortonLevelMask<morton>(dims, level);
+		const int r = classify(0, root);
+		if (r != 0) { cells.push_back(cell{ 0, root, r == 1 }); }
+		bool partial = (r == 1);
+		while (partial && level > 0) {
+			--level;
+			const morton childmask = mortonLevelMask<morton>(dims, level);
+			next.clear();
+			partial = false;
+			size_t count = 0; // number of intervals if we stop after this level
+			for (size_t i = 0; i < cells.size(); ++i) {
+				if (!cells[i].partial) {
+					append(next, cells[i]);
+				}
+				else {
+					for (unsigned int k = 0; k < (1u << dims); ++k) {
+						const morton lo = cells[i].lo | static_cast<morton>(static_cast<morton>(k) << (dims * level));
+						const morton hi = lo | childmask;
+						const int c = classify(lo, hi);
+						if (c == 0) { continue; }
+						append(next, cell{ lo, hi, c == 1 });
+						partial |= (c == 1);
+					}
+				}
+			}
+			for (size_t i = 0; max_intervals != 0 && i < next.size(); ++i) {
+				// cells that are partly inside might not touch their neighbours once they're trimmed
+				count += (i == 0 || next[i - 1].partial || next[i].partial || next[i - 1].hi + 1 != next[i].lo);
+			}
+			if (max_intervals != 0 && count > max_intervals) { break; } // keep the coarser level
+			cells.swap(next);
+		}
+		// cells that are still partly inside become the range from their first to their last code inside the box
+		out.clear();
+		for (size_t i = 0; i < cells.size(); ++i) {
+			cell c = cells[i];
+			if (c.partial) {
+				if (classify(c.lo, c.lo) != 2) { c.lo = mortonBigMin<morton>(c.lo, zmin, zmax, axismasks, dims); }
+				if (classify(c.hi, c.hi) != 2) { c.hi = mortonLitMax<morton>(c.hi, zmin, zmax, axismasks, dims); }
+			}
+			if (!out.empty() && out.back().hi + 1 == c.lo) { out.back().hi = c.hi; }
+			else { out.push_back(morton_interval<morton>{ c.lo, c.hi }); }
+		}
+		return out.size();
+	}
+
+	// Walks the codes inside the box with corner codes zmin and zmax in increasing order, without encoding any of them
+	// The walk goes one run of consecutive codes inside the box at a time. The end of a run is found by adding the largest
+	// aligned cell that starts at the next code and lies inside the box, until the code after it leaves the box (a few
+	// cells per run). Inside a run, the next code is the current one plus one, and from the end of a run BIGMIN jumps to
+	// the start of the next one. next_run() takes the rest of the current run at once.
+	template<typename morton>
+	class morton_box_iterator {
+	public:
+		morton_box_iterator(const morton zmin, const morton zmax, const morton* axismasks, const unsigned int dims)
+			: zmin(zmin), zmax(zmax), dims(dims), current(zmin), run_end(zmin), finished(false) {
+			for (unsigned int axis = 0; axis < 3; ++axis) {
+				masks[axis] = (axis < dims) ? axismasks[axis] : 0;
+				lo[axis] = zmin & masks[axis];
+				hi[axis] = zmax & masks[axis];
+			}
+			run_end = findRunEnd(zmin);
+		}
+
+		// Is the walk over (no more codes)
+		bool done() const { return finished; }
+		// The current code
+		morton operator*() const { return current; }
+
+		// Step to the next code inside the box
+		morton_box_iterator& operator++() {
+			if (current != run_end) { ++current; }
+			else { skipRun(); }
+			return *this;
+		}
+
+		// Take the rest of the current run [current code, end of the run] and step past it
+		// Returns false (and leaves run alone) when the walk is over.
+		bool next_run(morton_interval<morton>& run) {
+			if (finished) { return false; }
+			run.lo = current;
+			run.hi = run_end;
+			skipRun();
+			return true;
+		}
+
+	private:
+		bool inside(const morton m) const {
+			for (unsigned int axis = 0; axis < dims; ++axis) {
+				const morton v = m & masks[axis];
+				if (v < lo[axis] || v > hi[axis]) { return false; }
+			}
+			return true;
+		}
+
+		// The last code of the run of consecutive codes inside the box that starts at code m (inside the box)
+		morton findRunEnd(morton m) const {
+			const unsigned int bits = static_cast<unsigned int>(sizeof(morton) * 8);
+			for (;;) {
+				// the largest cell aligned at m that lies inside the box (its first code is inside, so check the last)
+				unsigned int level = (bits + dims - 1) / dims;
+				unsigned long bit = 0;
+				if (findFirstSetBitZeroIdx<morton>(static_cast<morton>(m & static_cast<morton>(~m + 1)), &bit)) { level = static_cast<unsigned int>(bit) / dims; }
+				morton last = static_cast<morton>(m | mortonLevelMask<morton>(dims, level));
+				while (level > 0 && !inside(last)) {
+					--level;
+					last = static_cast<morton>(m | mortonLevelMask<morton>(dims, level));
+				}
+				if (last == zmax || !inside(static_cast<morton>(last + 1))) { return last; }
+				m = static_cast<morton>(last + 1);
+			}
+		}
+
+		// Jump from the end of the current run to the start of the next one
+		void skipRun() {
+			if (run_end == zmax) {
+				finished = true;
+				return;
+			}
+			current = mortonBigMin<morton>(run_end, zmin, zmax, masks, dims);
+			run_end = findRunEnd(current);
+		}
+
+		morton zmin;
+		morton zmax;
+		unsigned int dims;
+		morton masks[3];
+		morton lo[3]; // bits of every axis of zmin
+		morton hi[3]; // bits of every axis of zmax
+		morton current;
+		morton run_end; // last code of the run the current code is in
+		bool finished;
+	};
+}
@@ -0,0 +1,189 @@
+#pragma once
+#include "morton_common.h"
+#if defined(LIBMORTON_RUNTIME_DISPATCH)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#include "morton2D.h"
+#include "morton3D.h"
+#include "morton_BMI.h"
+#include "morton_AVX2.h"
+#include "morton_SSE2.h"
+
+// Libmorton - Runtime selection of the fastest encoding/decoding methods for the CPU we're running on
+// morton.h points to these in portable x86-64 builds, where BMI2/AVX2 can't be picked at compile time.
+// The CPU is checked once (on first use), after that every call is a single indirect call.
+// pdep/pext are microcoded on AMD Zen 1/Zen 2 (and Hygon Dhyana), which makes them slower than the LUT methods,
+// so those CPU's get the LUT methods even though they report BMI2.
+
+namespace libmorton {
+
+	namespace dispatch_detail {
+		struct cpu_features {
+			bool bmi2;
+			bool avx2;
+			bool slow_pdep;
+		};
+
+		inline void cpuid(unsigned int leaf, unsigned int subleaf, unsigned int regs[4]) {
+#if defined(_MSC_VER)
+			int r[4];
+			__cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+			for (int i = 0; i < 4; ++i) { regs[i] = static_cast<unsigned int>(r[i]); }
+#else
+			__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+		}
+
+		// Does the OS save the YMM registers on a context switch (needed on top of the AVX2 cpuid bit)
+		inline bool os_saves_ymm() {
+#if defined(_MSC_VER)
+			return (_xgetbv(0) & 0x6) == 0x6;
+#else
+			unsigned int eax, edx;
+			__asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+			return (eax & 0x6) == 0x6;
+#endif
+		}
+
+		inline cpu_features detect_cpu_features() {
+			cpu_features cpu = { false, false, false };
+			unsigned int regs[4]; // eax, ebx, ecx, edx
+			cpuid(0, 0, regs);
+			const unsigned int max_leaf = regs[0];
+			char vendor[13];
+			memcpy(vendor, &regs[1], 4);
+			memcpy(vendor + 4, &regs[3], 4);
+			memcpy(vendor + 8, &regs[2], 4);
+			vendor[12] = '\0';
+			if (max_leaf < 7) {
+				return cpu;
+			}
+			cpuid(1, 0, regs);
+			const unsigned int family = ((regs[0] >> 8) & 0xF) == 0xF ? 0xF + ((regs[0] >> 20) & 0xFF) : (regs[0] >> 8) & 0xF;
+			const bool avx = (regs[2] & (1u << 27)) && (regs[2] & (1u << 28)) && os_saves_ymm(); // OSXSAVE, AVX
+			cpuid(7, 0, regs);
+			cpu.bmi2 = (regs[1] & (1u << 8)) != 0;
+			cpu.avx2 = avx && (regs[1] & (1u << 5)) != 0;
+			// Zen 3 (family 19h) is the first AMD core with pdep/pext in hardware
+			cpu.slow_pdep = (strcmp(vendor, "AuthenticAMD") == 0 && family < 0x19) || strcmp(vendor, "HygonGenuine") == 0;
+			return cpu;
+		}
+	}  // namespace dispatch_detail
+
+	// The methods the functions in morton.h point to
+	struct dispatch_table {
+		const char* name;
+		// exact-width types, so the LUT methods do as many lookups as the bits in the code need (not sizeof(uint_fast32_t))
+		uint32_t(*m2D_32_encode)(uint16_t, uint16_t);
+		uint64_t(*m2D_64_encode)(uint32_t, uint32_t);
+		uint32_t(*m3D_32_encode)(uint16_t, uint16_t, uint16_t);
+		uint64_t(*m3D_64_encode)(uint32_t, uint32_t, uint32_t);
+		void(*m2D_32_decode)(uint32_t, uint16_t&, uint16_t&);
+		void(*m2D_64_decode)(uint64_t, uint32_t&, uint32_t&);
+		void(*m3D_32_decode)(uint32_t, uint16_t&, uint16_t&, uint16_t&);
+		void(*m3D_64_decode)(uint64_t, uint32_t&, uint32_t&, uint32_t&);
+		void(*m2D_32_encode_batch)(const uint16_t*, const uint16_t*, uint32_t*, size_t);
+		void(*m2D_64_encode_batch)(const uint32_t*, const uint32_t*, uint64_t*, size_t);
+		void(*m3D_32_encode_batch)(const uint16_t*, const uint16_t*, const uint16_t*, uint32_t*, size_t);
+		void(*m3D_64_encode_batch)(const uint32_t*, const uint32_t*, const uint32_t*, uint64_t*, size_t);
+		void(*m2D_32_decode_batch)(const uint32_t*, uint16_t*, uint16_t*, size_t);
+		void(*m2D_64_decode_batch)(const uint64_t*, uint32_t*, uint32_t*, size_t);
+		void(*m3D_32_decode_batch)(const uint32_t*, uint16_t*, uint16_t*, uint16_t*, size_t);
+		void(*m3D_64_decode_batch)(const uint64_t*, uint32_t*, uint32_t*, uint32_t*, size_t);
+		void(*m2D_32_encode_strided)(const void*, size_t, size_t, size_t, uint32_t*, size_t);
+		void(*m2D_64_encode_strided)(const void*, size_t, size_t, size_t, uint64_t*, size_t);
+		void(*m3D_32_encode_strided)(const void*, size_t, size_t, size_t, size_t, uint32_t*, size_t);
+		void(*m3D_64_encode_strided)(const void*, size_t, size_t, size_t, size_t, uint64_t*, size_t);
+		void(*m3D_32_encode_floats)(const float*, uint32_t*, size_t, const morton_box<float>&, unsigned int);
+		void(*m3D_64_encode_floats)(const float*, uint64_t*, size_t, const morton_box<float>&, unsigned int);
+		void(*m3D_32_encode_doubles)(const double*, uint32_t*, size_t, const morton_box<double>&, unsigned int);
+		void(*m3D_64_encode_doubles)(const double*, uint64_t*, size_t, const morton_box<double>&, unsigned int);
+		size_t(*m2D_32_neighbours)(const uint32_t*, uint32_t*, size_t, unsigned int, unsigned int, morton_boundary);
+		size_t(*m2D_64_neighbours)(const uint64_t*, uint64_t*, size_t, unsigned int, unsigned int, morton_boundary);
+		size_t(*m3D_32_neighbours)(const uint32_t*, uint32_t*, size_t, unsigned int, unsigned int, morton_boundary);
+		size_t(*m3D_64_neighbours)(const uint64_t*, uint64_t*, size_t, unsigned int, unsigned int, morton_boundary);
+	};
+
+	// Build the table for a CPU with the given features (the dispatcher passes the detected ones, tests can pass any subset)
+	inline dispatch_table make_dispatch_table(const dispatch_detail::cpu_features& cpu) {
+		dispatch_table t;
+		const bool use_bmi2 = cpu.bmi2 && !cpu.slow_pdep;
+		t.name = use_bmi2 ? (cpu.avx2 ? "BMI2 + AVX2" : "BMI2 + SSE2") : (cpu.avx2 ? "LUT + AVX2" : "LUT + SSE2");
+		if (use_bmi2) {
+			t.m2D_32_encode = &m2D_e_BMI<uint32_t, uint16_t>;
+			t.m2D_64_encode = &m2D_e_BMI<uint64_t, uint32_t>;
+			t.m3D_32_encode = &m3D_e_BMI<uint32_t, uint16_t>;
+			t.m3D_64_encode = &m3D_e_BMI<uint64_t, uint32_t>;
+			t.m2D_32_decode = &m2D_d_BMI<uint32_t, uint16_t>;
+			t.m2D_64_decode = &m2D_d_BMI<uint64_t, uint32_t>;
+			t.m3D_32_decode = &m3D_d_BMI<uint32_t, uint16_t>;
+			t.m3D_64_decode = &m3D_d_BMI<uint64_t, uint32_t>;
+		}
+		else {
+			t.m2D_32_encode = &m2D_e_magicbits_combined<uint32_t, uint16_t>;
+			t.m2D_64_encode = &m2D_e_sLUT<uint64_t, uint32_t>;
+			t.m3D_32_encode = &m3D_e_sLUT<uint32_t, uint16_t>;
+			t.m3D_64_encode = &m3D_e_sLUT<uint64_t, uint32_t>;
+			t.m2D_32_decode = &m2D_d_magicbits_combined<uint32_t, uint16_t>;
+			t.m2D_64_decode = &m2D_d_sLUT<uint64_t, uint32_t>;
+			t.m3D_32_decode = &m3D_d_sLUT<uint32_t, uint16_t>;
+			t.m3D_64_decode = &m3D_d_sLUT<uint64_t, uint32_t>;
+		}
+		if (cpu.avx2) {
+			t.m2D_32_encode_batch = &m2D_e_AVX2_batch;
+			t.m2D_64_encode_batch = &m2D_e_AVX2_batch;
+			t.m3D_32_encode_batch = &m3D_e_AVX2_batch;
+			t.m3D_64_encode_batch = &m3D_e_AVX2_batch;
+			t.m2D_32_decode_batch = &m2D_d_AVX2_batch;
+			t.m2D_64_decode_batch = &m2D_d_AVX2_batch;
+			t.m3D_32_decode_batch = &m3D_d_AVX2_batch;
+			t.m3D_64_decode_batch = &m3D_d_AVX2_batch;
+			t.m2D_32_encode_strided = &m2D_e_AVX2_strided;
+			t.m2D_64_encode_strided = &m2D_e_AVX2_strided;
+			t.m3D_32_encode_strided = &m3D_e_AVX2_strided;
+			t.m3D_64_encode_strided = &m3D_e_AVX2_strided;
+			t.m3D_32_encode_floats = &m3D_e_AVX2_floats;
+			t.m3D_64_encode_floats = &m3D_e_AVX2_floats;
+			t.m3D_32_encode_doubles = &m3D_e_AVX2_floats;
+			t.m3D_64_encode_doubles = &m3D_e_AVX2_floats;
+			t.m2D_32_neighbours = &m2D_neighbours_AVX2;
+			t.m2D_64_neighbours = &m2D_neighbours_AVX2;
+			t.m3D_32_neighbours = &m3D_neighbours_AVX2;
+			t.m3D_64_neighbours = &m3D_neighbours_AVX2;
+		}
+		else {
+			// SSE2 is part of x86-64, so it doesn't need a check
+			t.m2D_32_encode_batch = &m2D_e_SSE2_batch;
+			t.m2D_64_encode_batch = &m2D_e_SSE2_batch;
+			t.m3D_32_encode_batch = &m3D_e_magicbits_batch<uint32_t, uint16_t>;
+			t.m3D_64_encode_batch = &m3D_e_magicbits_batch<uint64_t, uint32_t>;
+			t.m2D_32_decode_batch = &m2D_d_SSE2_batch;
+			t.m2D_64_decode_batch = &m2D_d_SSE2_batch;
+			t.m3D_32_decode_batch = &m3D_d_magicbits_batch<uint32_t, uint16_t>;
+			t.m3D_64_decode_batch = &m3D_d_magicbits_batch<uint64_t, uint32_t>;
+			t.m2D_32_encode_strided = &m2D_e_magicbits_strided<uint32_t, uint16_t>;
+			t.m2D_64_encode_strided = &m2D_e_magicbits_strided<uint64_t, uint32_t>;
+			t.m3D_32_encode_strided = &m3D_e_magicbits_strided<uint32_t, uint16_t>;
+			t.m3D_64_encode_strided = &m3D_e_magicbits_strided<uint64_t, uint32_t>;
+			t.m3D_32_encode_floats = &m3D_e_magicbits_floats<uint32_t, uint16_t, float>;
+			t.m3D_64_encode_floats = &m3D_e_magicbits_floats<uint64_t, uint32_t, float>;
+			t.m3D_32_encode_doubles = &m3D_e_magicbits_floats<uint32_t, uint16_t, double>;
+			t.m3D_64_encode_doubles = &m3D_e_magicbits_floats<uint64_t, uint32_t, double>;
+			t.m2D_32_neighbours = &m2D_neighbours<uint32_t>;
+			t.m2D_64_neighbours = &m2D_neighbours<uint64_t>;
+			t.m3D_32_neighbours = &m3D_neighbours<uint32_t>;
+			t.m3D_64_neighbours = &m3D_neighbours<uint64_t>;
+		}
+		return t;
+	}
+
+	// The table for this CPU, built on first use
+	inline const dispatch_table& dispatch() {
+		static const dispatch_table table = make_dispatch_table(dispatch_detail::detect_cpu_features());
+		return table;
+	}
+}
+#endif
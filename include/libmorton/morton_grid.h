@@ -0,0 +1,145 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#include "morton.h"
+
+// Libmorton - A dense 2D/3D grid of 2^level cells per axis, stored in Morton order
+// Cell (x, y[, z]) is element morton2D_64_encode(x, y) / morton3D_64_encode(x, y, z) of one contiguous array, so cells that
+// are close in space are close in memory, and every aligned block of 2^k cells per axis is a contiguous run of elements.
+// begin() / end() walk the cells in Morton order (the order of the array). cartesian_begin() / cartesian_end() walk them
+// in Cartesian order (x fastest, then y, then z), stepping the Morton code with dilated additions instead of encoding
+// every cell: a dilated addition on an axis mask limited to the grid wraps around at the end of a row by itself.
+
+namespace libmorton {
+
+	template<typename T, unsigned int D>
+	class morton_grid {
+		static_assert(D == 2 || D == 3, "morton_grid holds 2D or 3D grids");
+	public:
+		typedef T value_type;
+		typedef T& reference;
+		typedef const T& const_reference;
+		typedef typename std::vector<T>::iterator iterator;
+		typedef typename std::vector<T>::const_iterator const_iterator;
+
+		// Walks the cells in Cartesian order, and knows the coordinates and the Morton code of the current cell
+		template<typename value>
+		class cartesian_iterator_base {
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef typename std::remove_const<value>::type value_type;
+			typedef ptrdiff_t difference_type;
+			typedef value* pointer;
+			typedef value& reference;
+
+			cartesian_iterator_base() : cells(nullptr), extent(1), current(0) {
+				masks[0] = masks[1] = masks[2] = 0;
+				coords[0] = coords[1] = coords[2] = 0;
+			}
+			cartesian_iterator_base(value* cells, const unsigned int level, const bool end) : cells(cells), extent(static_cast<uint_fast32_t>(1) << level), current(0) {
+				for (unsigned int axis = 0; axis < 3; ++axis) { masks[axis] = (axis < D) ? axis_mask(axis) & mortonLevelMask<uint_fast64_t>(D, level) : 0; }
+				coords[0] = coords[1] = coords[2] = 0;
+				if (end) { coords[D - 1] = extent; }
+			}
+			// A const iterator from a mutable one
+			template<typename other>
+			cartesian_iterator_base(const cartesian_iterator_base<other>& it) : cells(it.cells), extent(it.extent), current(it.current) {
+				for (unsigned int axis = 0; axis < 3; ++axis) {
+					masks[axis] = it.masks[axis];
+					coords[axis] = it.coords[axis];
+				}
+			}
+
+			reference operator*() const { return cells[current]; }
+			pointer operator->() const { return cells + current; }
+			uint_fast32_t x() const { return coords[0]; }
+			uint_fast32_t y() const { return coords[1]; }
+			uint_fast32_t z() const { return coords[2]; }
+			uint_fast64_t code() const { return current; }
+
+			cartesian_iterator_base& operator++() {
+				for (unsigned int axis = 0; axis < D; ++axis) {
+					// the code wraps to 0 on this axis at the end of the row, the next axis is stepped instead
+					current = dilatedAdd<uint_fast64_t>(current, static_cast<uint_fast64_t>(1) << axis, masks[axis]);
+					if (++coords[axis] != extent || axis == D - 1) { break; }
+					coords[axis] = 0;
+				}
+				return *this;
+			}
+			cartesian_iterator_base operator++(int) {
+				cartesian_iterator_base it = *this;
+				++(*this);
+				return it;
+			}
+			template<typename other>
+			bool operator==(const cartesian_iterator_base<other>& it) const { return current == it.current && coords[D - 1] == it.coords[D - 1]; }
+			template<typename other>
+			bool operator!=(const cartesian_iterator_base<other>& it) const { return !(*this == it); }
+
+		private:
+			template<typename> friend class cartesian_iterator_base;
+			value* cells;
+			uint_fast32_t extent;
+			uint_fast64_t current; // Morton code of the current cell
+			uint_fast64_t masks[3]; // bits of every axis inside the grid
+			uint_fast32_t coords[3];
+		};
+		typedef cartesian_iterator_base<T> cartesian_iterator;
+		typedef cartesian_iterator_base<const T> const_cartesian_iterator;
+
+		// A grid of 2^level x 2^level (x 2^level) cells, value initialized or set to value
+		explicit morton_grid(const unsigned int level = 0) : grid_level(level), cells(static_cast<size_t>(1) << (D * level)) {}
+		morton_grid(const unsigned int level, const T& value) : grid_level(level), cells(static_cast<size_t>(1) << (D * level), value) {}
+
+		// Number of levels, cells per axis and cells
+		unsigned int level() const { return grid_level; }
+		uint_fast32_t extent() const { return static_cast<uint_fast32_t>(1) << grid_level; }
+		size_t size() const { return cells.size(); }
+
+		// Morton code (index in the array) of a cell
+		static uint_fast64_t code(const uint_fast32_t x, const uint_fast32_t y) {
+			static_assert(D == 2, "2D index on a 3D grid");
+			return morton2D_64_encode(x, y);
+		}
+		static uint_fast64_t code(const uint_fast32_t x, const uint_fast32_t y, const uint_fast32_t z) {
+			static_assert(D == 3, "3D index on a 2D grid");
+			return morton3D_64_encode(x, y, z);
+		}
+
+		// Cell access by coordinates
+		T& operator()(const uint_fast32_t x, const uint_fast32_t y) { return cells[static_cast<size_t>(code(x, y))]; }
+		const T& operator()(const uint_fast32_t x, const uint_fast32_t y) const { return cells[static_cast<size_t>(code(x, y))]; }
+		T& operator()(const uint_fast32_t x, const uint_fast32_t y, const uint_fast32_t z) { return cells[static_cast<size_t>(code(x, y, z))]; }
+		const T& operator()(const uint_fast32_t x, const uint_fast32_t y, const uint_fast32_t z) const { return cells[static_cast<size_t>(code(x, y, z))]; }
+
+		// Cell access by Morton code (step to neighbouring cells with the dilated arithmetic of morton2D.h / morton3D.h)
+		T& operator[](const uint_fast64_t m) { return cells[static_cast<size_t>(m)]; }
+		const T& operator[](const uint_fast64_t m) const { return cells[static_cast<size_t>(m)]; }
+
+		T* data() { return cells.data(); }
+		const T* data() const { return cells.data(); }
+
+		// Morton order
+		iterator begin() { return cells.begin(); }
+		iterator end() { return cells.end(); }
+		const_iterator begin() const { return cells.begin(); }
+		const_iterator end() const { return cells.end(); }
+
+		// Cartesian order
+		cartesian_iterator cartesian_begin() { return cartesian_iterator(cells.data(), grid_level, false); }
+		cartesian_iterator cartesian_end() { return cartesian_iterator(cells.data(), grid_level, true); }
+		const_cartesian_iterator cartesian_begin() const { return const_cartesian_iterator(cells.data(), grid_level, false); }
+		const_cartesian_iterator cartesian_end() const { return const_cartesian_iterator(cells.data(), grid_level, true); }
+
+	private:
+		static uint_fast64_t axis_mask(const unsigned int axis) {
+			return (D == 2) ? morton2D_AxisMask<uint_fast64_t>(axis) : morton3D_AxisMask<uint_fast64_t>(axis);
+		}
+
+		unsigned int grid_level;
+		std::vector<T> cells;
+	};
+}
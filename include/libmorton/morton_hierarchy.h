@@ -0,0 +1,209 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "morton_common.h"
+
+// Libmorton - Walking the quadtree / octree hierarchy on 2D and 3D Morton codes
+// The code of a cell at level L (a cell of 2^L coordinates per axis) is the code of any coordinate inside it shifted
+// right by dims * L bits: the top bits of a code are the path from the root, dims bits (one quadrant / octant) per level.
+// Going up or down the hierarchy is a shift, and two codes are in the same cell at level L when they differ only in their
+// lowest dims * L bits. Shifts of the whole code width or more give 0 instead of being undefined.
+// The batch methods have no branches in their loops, so the compiler can vectorize them (except common_ancestor_level).
+
+namespace libmorton {
+	namespace hierarchy_detail {
+		template<typename morton>
+		inline morton shiftDown(const morton m, const unsigned int bits) {
+			return (bits >= sizeof(morton) * 8) ? static_cast<morton>(0) : static_cast<morton>(m >> bits);
+		}
+
+		template<typename morton>
+		inline morton shiftUp(const morton m, const unsigned int bits) {
+			return (bits >= sizeof(morton) * 8) ? static_cast<morton>(0) : static_cast<morton>(m << bits);
+		}
+
+		template<typename morton, unsigned int dims>
+		inline morton_interval<morton> descendants(const morton m, const unsigned int depth) {
+			const morton lo = shiftUp<morton>(m, dims * depth);
+			const morton_interval<morton> range = { lo, static_cast<morton>(lo | mortonLevelMask<morton>(dims, depth)) };
+			return range;
+		}
+
+		template<typename morton, unsigned int dims>
+		inline unsigned int commonAncestorLevel(const morton a, const morton b) {
+			unsigned long msb = 0;
+			return findFirstSetBitZeroIdx<morton>(static_cast<morton>(a ^ b), &msb) ? static_cast<unsigned int>(msb / dims + 1) : 0;
+		}
+
+		template<typename morton, unsigned int dims>
+		inline bool sameCell(const morton a, const morton b, const unsigned int level) {
+			return (static_cast<morton>(a ^ b) & static_cast<morton>(~mortonLevelMask<morton>(dims, level))) == 0;
+		}
+
+		template<typename morton>
+		inline void shiftDownBatch(const morton* m, morton* out, const size_t n, const unsigned int bits) {
+			if (bits >= sizeof(morton) * 8) {
+				for (size_t i = 0; i < n; ++i) { out[i] = 0; }
+				return;
+			}
+			for (size_t i = 0; i < n; ++i) { out[i] = static_cast<morton>(m[i] >> bits); }
+		}
+
+		// The child of every code in the quadrant / octant given by child (0: the first child, 2^dims - 1: the last one)
+		template<typename morton, unsigned int dims>
+		inline void childBatch(const morton* m, morton* out, const size_t n, const morton child) {
+			for (size_t i = 0; i < n; ++i) { out[i] = static_cast<morton>((m[i] << dims) | child); }
+		}
+
+		template<typename morton, unsigned int dims>
+		inline void descendantsBatch(const morton* m, morton_interval<morton>* out, const size_t n, const unsigned int depth) {
+			for (size_t i = 0; i < n; ++i) { out[i] = descendants<morton, dims>(m[i], depth); }
+		}
+
+		template<typename morton, unsigned int dims>
+		inline void commonAncestorLevelBatch(const morton* a, const morton* b, unsigned int* out, const size_t n) {
+			for (size_t i = 0; i < n; ++i) { out[i] = commonAncestorLevel<morton, dims>(a[i], b[i]); }
+		}
+
+		template<typename morton, unsigned int dims>
+		inline void sameCellBatch(const morton* a, const morton* b, bool* out, const size_t n, const unsigned int level) {
+			const morton above = static_cast<morton>(~mortonLevelMask<morton>(dims, level));
+			for (size_t i = 0; i < n; ++i) { out[i] = (static_cast<morton>(a[i] ^ b[i]) & above) == 0; }
+		}
+	}
+
+	// 2D (QUADTREE)
+	// The ancestor of cell m the given number of levels up (levels = 1: the parent)
+	template<typename morton>
+	inline morton m2D_parent(const morton m, const unsigned int levels = 1) {
+		return hierarchy_detail::shiftDown<morton>(m, 2 * levels);
+	}
+
+	// The first (lowest) / last (highest) of the 4 children of cell m
+	template<typename morton>
+	inline morton m2D_first_child(const morton m) {
+		return static_cast<morton>(m << 2);
+	}
+
+	template<typename morton>
+	inline morton m2D_last_child(const morton m) {
+		return static_cast<morton>((m << 2) | 3);
+	}
+
+	// The codes of the 4^depth descendants of cell m, depth levels down (depth = 0: m itself), a contiguous range
+	template<typename morton>
+	inline morton_interval<morton> m2D_descendants(const morton m, const unsigned int depth) {
+		return hierarchy_detail::descendants<morton, 2>(m, depth);
+	}
+
+	// The level of the smallest cell holding both a and b (0 when they're equal), the number of levels to their common ancestor
+	template<typename morton>
+	inline unsigned int m2D_common_ancestor_level(const morton a, const morton b) {
+		return hierarchy_detail::commonAncestorLevel<morton, 2>(a, b);
+	}
+
+	// Are a and b in the same cell of 2^level x 2^level coordinates (m2D_parent(a, level) == m2D_parent(b, level))
+	template<typename morton>
+	inline bool m2D_same_cell(const morton a, const morton b, const unsigned int level) {
+		return hierarchy_detail::sameCell<morton, 2>(a, b, level);
+	}
+
+	// BATCH: the same methods on n codes (out may be m for the methods returning codes)
+	template<typename morton>
+	inline void m2D_parent(const morton* m, morton* out, const size_t n, const unsigned int levels = 1) {
+		hierarchy_detail::shiftDownBatch<morton>(m, out, n, 2 * levels);
+	}
+
+	template<typename morton>
+	inline void m2D_first_child(const morton* m, morton* out, const size_t n) {
+		hierarchy_detail::childBatch<morton, 2>(m, out, n, 0);
+	}
+
+	template<typename morton>
+	inline void m2D_last_child(const morton* m, morton* out, const size_t n) {
+		hierarchy_detail::childBatch<morton, 2>(m, out, n, 3);
+	}
+
+	template<typename morton>
+	inline void m2D_descendants(const morton* m, morton_interval<morton>* out, const size_t n, const unsigned int depth) {
+		hierarchy_detail::descendantsBatch<morton, 2>(m, out, n, depth);
+	}
+
+	template<typename morton>
+	inline void m2D_common_ancestor_level(const morton* a, const morton* b, unsigned int* out, const size_t n) {
+		hierarchy_detail::commonAncestorLevelBatch<morton, 2>(a, b, out, n);
+	}
+
+	template<typename morton>
+	inline void m2D_same_cell(const morton* a, const morton* b, bool* out, const size_t n, const unsigned int level) {
+		hierarchy_detail::sameCellBatch<morton, 2>(a, b, out, n, level);
+	}
+
+	// 3D (OCTREE)
+	// The ancestor of cell m the given number of levels up (levels = 1: the parent)
+	template<typename morton>
+	inline morton m3D_parent(const morton m, const unsigned int levels = 1) {
+		return hierarchy_detail::shiftDown<morton>(m, 3 * levels);
+	}
+
+	// The first (lowest) / last (highest) of the 8 children of cell m
+	template<typename morton>
+	inline morton m3D_first_child(const morton m) {
+		return static_cast<morton>(m << 3);
+	}
+
+	template<typename morton>
+	inline morton m3D_last_child(const morton m) {
+		return static_cast<morton>((m << 3) | 7);
+	}
+
+	// The codes of the 8^depth descendants of cell m, depth levels down (depth = 0: m itself), a contiguous range
+	template<typename morton>
+	inline morton_interval<morton> m3D_descendants(const morton m, const unsigned int depth) {
+		return hierarchy_detail::descendants<morton, 3>(m, depth);
+	}
+
+	// The level of the smallest cell holding both a and b (0 when they're equal), the number of levels to their common ancestor
+	// The unused top bit(s) of a 3D code count as one more level, codes that differ there give the level above the root.
+	template<typename morton>
+	inline unsigned int m3D_common_ancestor_level(const morton a, const morton b) {
+		return hierarchy_detail::commonAncestorLevel<morton, 3>(a, b);
+	}
+
+	// Are a and b in the same cell of 2^level x 2^level x 2^level coordinates (m3D_parent(a, level) == m3D_parent(b, level))
+	template<typename morton>
+	inline bool m3D_same_cell(const morton a, const morton b, const unsigned int level) {
+		return hierarchy_detail::sameCell<morton, 3>(a, b, level);
+	}
+
+	// BATCH: the same methods on n codes (out may be m for the methods returning codes)
+	template<typename morton>
+	inline void m3D_parent(const morton* m, morton* out, const size_t n, const unsigned int levels = 1) {
+		hierarchy_detail::shiftDownBatch<morton>(m, out, n, 3 * levels);
+	}
+
+	template<typename morton>
+	inline void m3D_first_child(const morton* m, morton* out, const size_t n) {
+		hierarchy_detail::childBatch<morton, 3>(m, out, n, 0);
+	}
+
+	template<typename morton>
+	inline void m3D_last_child(const morton* m, morton* out, const size_t n) {
+		hierarchy_detail::childBatch<morton, 3>(m, out, n, 7);
+	}
+
+	template<typename morton>
+	inline void m3D_descendants(const morton* m, morton_interval<morton>* out, const size_t n, const unsigned int depth) {
+		hierarchy_detail::descendantsBatch<morton, 3>(m, out, n, depth);
+	}
+
+	template<typename morton>
+	inline void m3D_common_ancestor_level(const morton* a, const morton* b, unsigned int* out, const size_t n) {
+		hierarchy_detail::commonAncestorLevelBatch<morton, 3>(a, b, out, n);
+	}
+
+	template<typename morton>
+	inline void m3D_same_cell(const morton* a, const morton* b, bool* out, const size_t n, const unsigned int level) {
+		hierarchy_detail::sameCellBatch<morton, 3>(a, b, out, n, level);
+	}
+}
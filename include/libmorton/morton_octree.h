@@ -0,0 +1,197 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+#include "morton_common.h"
+#include "morton_hierarchy.h"
+#include "morton_parallel.h"
+
+// Libmorton - Building a linear (pointerless) octree from a sorted array of 3D Morton codes
+// Two neighbouring keys split at the level of the smallest cell that holds both of them, which is the position of the highest
+// set bit of their XOR, divided by 3. The splits are bucketed per level (in one pass over the keys), after which the octree
+// is built top-down, one level at a time: the children of a node are the runs between the splits of the node's level
+// inside its key range. Every level is a single sweep over its nodes and its splits, so the whole build is O(n).
+// Nodes with more keys than the leaf capacity are split, nodes at level 0 (a single cell, holding duplicate keys) never are.
+
+namespace libmorton {
+
+	// Order of the nodes in the node array
+	enum class morton_octree_order {
+		breadth_first, // level by level, the children of a node are next to each other
+		depth_first // every node is followed by its subtree, the first child of a node is the next node
+	};
+
+	// No node (parent of the root, first child of a leaf)
+	static const size_t morton_octree_none = ~static_cast<size_t>(0);
+
+	// A node of a linear octree: the keys [first, last] of the sorted key array, which lie in one cell of size 2^level
+	struct morton_octree_node {
+		size_t first; // index of the first key in the node
+		size_t last; // index of the last key in the node
+		size_t parent; // index of the parent node, morton_octree_none for the root
+		size_t first_child; // index of the first child node, morton_octree_none for leaves
+		unsigned char level; // the node is a cell of 2^level x 2^level x 2^level coordinates, 0 is a single coordinate
+		unsigned char child_mask; // bit k is set when the child in octant k (of its morton code) exists
+	};
+
+	namespace octree_detail {
+		// Level of the smallest cell that holds both codes (0 when they're equal), the unused top bit(s) count as the top level
+		template<typename morton>
+		inline unsigned int split_level(const morton a, const morton b, const unsigned int top) {
+			return std::min(m3D_common_ancestor_level<morton>(a, b), top);
+		}
+
+		inline unsigned int child_count(unsigned int mask) {
+			unsigned int count = 0;
+			for (; mask; mask &= mask - 1) { ++count; }
+			return count;
+		}
+
+		template<typename morton, typename executor_or_threads>
+		inline size_t build_octree(const morton* keys, const size_t n, const size_t leaf_capacity, std::vector<morton_octree_node>& nodes,
+			const morton_octree_order order, const executor_or_threads& threads) {
+			nodes.clear();
+			if (n == 0) { return 0; }
+			const unsigned int top = static_cast<unsigned int>(sizeof(morton) * 8) / 3;
+			const size_t capacity = std::max<size_t>(leaf_capacity, 1);
+
+			// the split between key i and key i + 1, bucketed by level (level-major, block-minor keeps every bucket sorted)
+			const size_t pairs = n - 1;
+			const size_t blocks = (pairs + parallel_detail::chunk_size - 1) / parallel_detail::chunk_size;
+			std::vector<size_t> offsets(blocks * (top + 1), 0);
+			parallel_detail::for_chunks(pairs, threads, [&](const size_t b, const size_t begin, const size_t end) {
+				size_t* count = &offsets[b * (top + 1)];
+				for (size_t i = begin; i < end; ++i) { ++count[split_level<morton>(keys[i], keys[i + 1], top)]; }
+			});
+			std::vector<size_t> level_begin(top + 2);
+			size_t sum = 0;
+			for (unsigned int level = 0; level <= top; ++level) {
+				level_begin[level] = sum;
+				for (size_t b = 0; b < blocks; ++b) {
+					const size_t count = offsets[b * (top + 1) + level];
+					offsets[b * (top + 1) + level] = sum;
+					sum += count;
+				}
+			}
+			level_begin[top + 1] = sum;
+			std::vector<size_t> splits(pairs);
+			parallel_detail::for_chunks(pairs, threads, [&](const size_t b, const size_t begin, const size_t end) {
+				size_t* offset = &offsets[b * (top + 1)];
+				for (size_t i = begin; i < end; ++i) { splits[offset[split_level<morton>(keys[i], keys[i + 1], top)]++] = i; }
+			});
+
+			// breadth-first, one level at a time
+			const morton_octree_node root = { 0, n - 1, morton_octree_none, morton_octree_none, static_cast<unsigned char>(top), 0 };
+			nodes.push_back(root);
+			std::vector<size_t> level_start(1, 0); // first node of every level, from the top down
+			std::vector<size_t> children;
+			for (unsigned int level = top; level > 0; --level) {
+				const size_t start = level_start.back();
+				const size_t count = nodes.size() - start;
+				if (count == 0) { break; }
+				const size_t* const first_split = splits.data() + level_begin[level];
+				const size_t* const last_split = splits.data() + level_begin[level + 1];
+				// count the children: one more than the splits of this level inside the node
+				children.assign(count, 0);
+				parallel_detail::for_chunks(count, threads, [&](const size_t, const size_t begin, const size_t end) {
+					const size_t* s = std::lower_bound(first_split, last_split, nodes[start + begin].first);
+					for (size_t j = begin; j < end; ++j) {
+						const morton_octree_node& node = nodes[start + j];
+						if (node.last - node.first < capacity) { continue; } // leaf
+						while (s != last_split && *s < node.first) { ++s; }
+						const size_t* e = s;
+						while (e != last_split && *e < node.last) { ++e; }
+						children[j] = static_cast<size_t>(e - s) + 1;
+						s = e;
+					}
+				});
+				size_t next = nodes.size();
+				level_start.push_back(next);
+				for (size_t j = 0; j < count; ++j) {
+					nodes[start + j].first_child = children[j] ? next : morton_octree_none;
+					next += children[j];
+				}
+				nodes.resize(next);
+				// fill them in
+				parallel_detail::for_chunks(count, threads, [&](const size_t, const size_t begin, const size_t end) {
+					const size_t* s = std::lower_bound(first_split, last_split, nodes[start + begin].first);
+					for (size_t j = begin; j < end; ++j) {
+						morton_octree_node& node = nodes[start + j];
+						if (children[j] == 0) { continue; }
+						while (s != last_split && *s < node.first) { ++s; }
+						size_t child = node.first_child, first = node.first;
+						unsigned int mask = 0;
+						for (;;) {
+							const size_t last = (s != last_split && *s < node.last) ? *s : node.last;
+							const unsigned int octant = static_cast<unsigned int>(keys[first] >> (3 * (level - 1))) & 7;
+							const morton_octree_node c = { first, last, start + j, morton_octree_none, static_cast<unsigned char>(level - 1), 0 };
+							nodes[child++] = c;
+							mask |= 1u << octant;
+							if (last == node.last) { break; }
+							first = last + 1;
+							++s;
+						}
+						node.child_mask = static_cast<unsigned char>(mask);
+					}
+				});
+			}
+			level_start.push_back(nodes.size());
+			if (order == morton_octree_order::breadth_first) { return nodes.size(); }
+
+			// depth-first: number the nodes by their position in a preorder walk, using the size of every subtree
+			std::vector<size_t> subtree(nodes.size(), 1);
+			for (size_t l = level_start.size() - 1; l-- > 0;) {
+				const size_t start = level_start[l];
+				parallel_detail::for_chunks(level_start[l + 1] - start, threads, [&](const size_t, const size_t begin, const size_t end) {
+					for (size_t j = start + begin; j < start + end; ++j) {
+						if (nodes[j].first_child == morton_octree_none) { continue; }
+						const size_t c = nodes[j].first_child;
+						for (size_t k = c; k < c + child_count(nodes[j].child_mask); ++k) { subtree[j] += subtree[k]; }
+					}
+				});
+			}
+			std::vector<size_t> position(nodes.size(), 0);
+			for (size_t l = 0; l + 1 < level_start.size(); ++l) {
+				const size_t start = level_start[l];
+				parallel_detail::for_chunks(level_start[l + 1] - start, threads, [&](const size_t, const size_t begin, const size_t end) {
+					for (size_t j = start + begin; j < start + end; ++j) {
+						if (nodes[j].first_child == morton_octree_none) { continue; }
+						size_t p = position[j] + 1;
+						const size_t c = nodes[j].first_child;
+						for (size_t k = c; k < c + child_count(nodes[j].child_mask); ++k) {
+							position[k] = p;
+							p += subtree[k];
+						}
+					}
+				});
+			}
+			std::vector<morton_octree_node> reordered(nodes.size());
+			parallel_detail::for_chunks(nodes.size(), threads, [&](const size_t, const size_t begin, const size_t end) {
+				for (size_t j = begin; j < end; ++j) {
+					morton_octree_node node = nodes[j];
+					node.parent = (node.parent == morton_octree_none) ? morton_octree_none : position[node.parent];
+					node.first_child = (node.first_child == morton_octree_none) ? morton_octree_none : position[j] + 1;
+					reordered[position[j]] = node;
+				}
+			});
+			nodes.swap(reordered);
+			return nodes.size();
+		}
+	}  // namespace octree_detail
+
+	// BUILD a linear octree over a sorted array of 3D Morton codes (threads = 1: on the calling thread, 0: all hardware threads)
+	// Nodes with more than leaf_capacity keys are split into their non-empty octants. Returns the number of nodes.
+	template<typename morton>
+	inline size_t m3D_build_octree(const morton* keys, const size_t n, const size_t leaf_capacity, std::vector<morton_octree_node>& nodes,
+		const morton_octree_order order = morton_octree_order::breadth_first, const unsigned int threads = 1) {
+		return octree_detail::build_octree<morton>(keys, n, leaf_capacity, nodes, order, threads);
+	}
+
+	// BUILD a linear octree over a sorted array of 3D Morton codes, running the parallel parts on an executor (see morton_parallel.h)
+	template<typename morton>
+	inline size_t m3D_build_octree(const morton* keys, const size_t n, const size_t leaf_capacity, std::vector<morton_octree_node>& nodes,
+		const morton_octree_order order, const morton_executor& executor) {
+		return octree_detail::build_octree<morton>(keys, n, leaf_capacity, nodes, order, executor);
+	}
+}
@@ -0,0 +1,230 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "morton.h"
+
+// Libmorton - Encoding/decoding big arrays of Morton codes on all cores
+// The input is split into chunks that fit in the L2 cache, and every chunk goes through the batch methods of morton.h.
+// By default the chunks run on a thread pool that is started on first use and kept for the lifetime of the program:
+// every thread starts with an equal share of the chunks, and steals half of the remaining chunks of another thread
+// when it runs out. To run the chunks on a thread pool you already have, pass a morton_executor instead of a thread count.
+
+namespace libmorton {
+
+	// Runs task(0) ... task(count - 1), in any order and on any threads, and returns when all of them have finished
+	typedef std::function<void(size_t count, const std::function<void(size_t)>& task)> morton_executor;
+
+	namespace parallel_detail {
+		static const size_t chunk_size = static_cast<size_t>(1) << 14; // 16K points: 320 KB for 64-bit 3D (coordinates and codes)
+
+		class thread_pool {
+		public:
+			// workers: number of threads besides the thread calling run()
+			explicit thread_pool(const unsigned int workers) : queues(workers + 1), stopping(false), generation(0), busy(0), participants(0), task(nullptr) {
+				threads.reserve(workers);
+				for (unsigned int i = 1; i <= workers; ++i) { threads.push_back(std::thread(&thread_pool::work, this, i)); }
+			}
+			~thread_pool() {
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					stopping = true;
+				}
+				wake.notify_all();
+				for (size_t i = 0; i < threads.size(); ++i) { threads[i].join(); }
+			}
+
+			// Number of threads run() can use, including the calling thread
+			unsigned int size() const { return static_cast<unsigned int>(queues.size()); }
+
+			// Runs task(0) ... task(n - 1) on up to max_threads threads (0: all of them), the calling thread included.
+			// Calls from several threads take turns; calling run() from inside a task deadlocks.
+			void run(const size_t n, const std::function<void(size_t)>& job, unsigned int max_threads = 0) {
+				if (n == 0) { return; }
+				std::lock_guard<std::mutex> turn(run_mutex);
+				if (max_threads == 0 || max_threads > size()) { max_threads = size(); }
+				if (max_threads > n) { max_threads = static_cast<unsigned int>(n); }
+				// equal shares, the thieves balance the rest
+				for (unsigned int i = 0; i < max_threads; ++i) {
+					std::lock_guard<std::mutex> lock(queues[i].mutex);
+					queues[i].begin = n * i / max_threads;
+					queues[i].end = n * (i + 1) / max_threads;
+				}
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					participants = max_threads;
+					task = &job;
+					busy = static_cast<unsigned int>(threads.size());
+					++generation;
+				}
+				wake.notify_all();
+				execute(0);
+				std::unique_lock<std::mutex> lock(mutex);
+				done.wait(lock, [&] { return busy == 0; });
+				task = nullptr;
+			}
+
+		private:
+			// The chunks [begin, end) a thread still has to do: the owner takes them from the front, thieves from the back
+			struct queue {
+				std::mutex mutex;
+				size_t begin = 0;
+				size_t end = 0;
+				char padding[64]; // keep the queues of different threads on different cache lines
+			};
+
+			bool pop(const unsigned int id, size_t& chunk) {
+				std::lock_guard<std::mutex> lock(queues[id].mutex);
+				if (queues[id].begin == queues[id].end) { return false; }
+				chunk = queues[id].begin++;
+				return true;
+			}
+
+			// Move the back half of the chunks of another thread to our own (empty) queue
+			bool steal(const unsigned int id) {
+				for (unsigned int k = 1; k < participants; ++k) {
+					queue& victim = queues[(id + k) % participants];
+					size_t begin, end;
+					{
+						std::lock_guard<std::mutex> lock(victim.mutex);
+						const size_t left = victim.end - victim.begin;
+						if (left == 0) { continue; }
+						end = victim.end;
+						begin = end - (left + 1) / 2;
+						victim.end = begin;
+					}
+					std::lock_guard<std::mutex> lock(queues[id].mutex);
+					queues[id].begin = begin;
+					queues[id].end = end;
+					return true;
+				}
+				return false;
+			}
+
+			void execute(const unsigned int id) {
+				size_t chunk;
+				do {
+					while (pop(id, chunk)) { (*task)(chunk); }
+				} while (steal(id));
+			}
+
+			void work(const unsigned int id) {
+				unsigned int seen = 0;
+				for (;;) {
+					{
+						std::unique_lock<std::mutex> lock(mutex);
+						wake.wait(lock, [&] { return stopping || generation != seen; });
+						if (stopping) { return; }
+						seen = generation;
+					}
+					if (id < participants) { execute(id); }
+					std::lock_guard<std::mutex> lock(mutex);
+					if (--busy == 0) { done.notify_one(); }
+				}
+			}
+
+			std::vector<std::thread> threads;
+			std::vector<queue> queues;
+			std::mutex run_mutex;
+			std::mutex mutex;
+			std::condition_variable wake;
+			std::condition_variable done;
+			bool stopping;
+			unsigned int generation;
+			unsigned int busy;
+			unsigned int participants;
+			const std::function<void(size_t)>* task;
+		};
+
+		// The pool the parallel methods use when they don't get an executor, started on first use
+		inline thread_pool& default_pool() {
+			static thread_pool pool(std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 0);
+			return pool;
+		}
+
+		// Calls work(chunk, begin, end) for every chunk of [0, n), on up to threads threads (1: on the calling thread)
+		template<typename method>
+		inline void for_chunks(const size_t n, const unsigned int threads, const method& work) {
+			const size_t chunks = (n + chunk_size - 1) / chunk_size;
+			if (chunks <= 1 || threads == 1) {
+				for (size_t c = 0; c < chunks; ++c) { work(c, c * chunk_size, std::min(n, (c + 1) * chunk_size)); }
+				return;
+			}
+			default_pool().run(chunks, [&](const size_t c) { work(c, c * chunk_size, std::min(n, (c + 1) * chunk_size)); }, threads);
+		}
+		template<typename method>
+		inline void for_chunks(const size_t n, const morton_executor& executor, const method& work) {
+			const size_t chunks = (n + chunk_size - 1) / chunk_size;
+			executor(chunks, [&](const size_t c) { work(c, c * chunk_size, std::min(n, (c + 1) * chunk_size)); });
+		}
+	}  // namespace parallel_detail
+
+	// An executor that runs on the libmorton thread pool, using up to threads threads (0: all of them)
+	inline morton_executor default_executor(const unsigned int threads = 0) {
+		return [threads](const size_t count, const std::function<void(size_t)>& task) { parallel_detail::default_pool().run(count, task, threads); };
+	}
+
+	// ENCODE 2D Morton codes in parallel, on the libmorton thread pool (threads = 0: all hardware threads) or on an executor
+	inline void parallel_encode2D(const uint16_t* x, const uint16_t* y, uint32_t* out, const size_t n, const unsigned int threads = 0) {
+		parallel_detail::for_chunks(n, threads, [=](const size_t, const size_t begin, const size_t end) { morton2D_32_encode_batch(x + begin, y + begin, out + begin, end - begin); });
+	}
+	inline void parallel_encode2D(const uint16_t* x, const uint16_t* y, uint32_t* out, const size_t n, const morton_executor& executor) {
+		parallel_detail::for_chunks(n, executor, [=](const size_t, const size_t begin, const size_t end) { morton2D_32_encode_batch(x + begin, y + begin, out + begin, end - begin); });
+	}
+
+	inline void parallel_encode2D(const uint32_t* x, const uint32_t* y, uint64_t* out, const size_t n, const unsigned int threads = 0) {
+		parallel_detail::for_chunks(n, threads, [=](const size_t, const size_t begin, const size_t end) { morton2D_64_encode_batch(x + begin, y + begin, out + begin, end - begin); });
+	}
+	inline void parallel_encode2D(const uint32_t* x, const uint32_t* y, uint64_t* out, const size_t n, const morton_executor& executor) {
+		parallel_detail::for_chunks(n, executor, [=](const size_t, const size_t begin, const size_t end) { morton2D_64_encode_batch(x + begin, y + begin, out + begin, end - begin); });
+	}
+
+	// DECODE 2D Morton codes in parallel, on the libmorton thread pool (threads = 0: all hardware threads) or on an executor
+	inline void parallel_decode2D(const uint32_t* m, uint16_t* x, uint16_t* y, const size_t n, const unsigned int threads = 0) {
+		parallel_detail::for_chunks(n, threads, [=](const size_t, const size_t begin, const size_t end) { morton2D_32_decode_batch(m + begin, x + begin, y + begin, end - begin); });
+	}
+	inline void parallel_decode2D(const uint32_t* m, uint16_t* x, uint16_t* y, const size_t n, const morton_executor& executor) {
+		parallel_detail::for_chunks(n, executor, [=](const size_t, const size_t begin, const size_t end) { morton2D_32_decode_batch(m + begin, x + begin, y + begin, end - begin); });
+	}
+
+	inline void parallel_decode2D(const uint64_t* m, uint32_t* x, uint32_t* y, const size_t n, const unsigned int threads = 0) {
+		parallel_detail::for_chunks(n, threads, [=](const size_t, const size_t begin, const size_t end) { morton2D_64_decode_batch(m + begin, x + begin, y + begin, end - begin); });
+	}
+	inline void parallel_decode2D(const uint64_t* m, uint32_t* x, uint32_t* y, const size_t n, const morton_executor& executor) {
+		parallel_detail::for_chunks(n, executor, [=](const size_t, const size_t begin, const size_t end) { morton2D_64_decode_batch(m + begin, x + begin, y + begin, end - begin); });
+	}
+
+	// ENCODE 3D Morton codes in parallel, on the libmorton thread pool (threads = 0: all hardware threads) or on an executor
+	inline void parallel_encode3D(const uint16_t* x, const uint16_t* y, const uint16_t* z, uint32_t* out, const size_t n, const unsigned int threads = 0) {
+		parallel_detail::for_chunks(n, threads, [=](const size_t, const size_t begin, const size_t end) { morton3D_32_encode_batch(x + begin, y + begin, z + begin, out + begin, end - begin); });
+	}
+	inline void parallel_encode3D(const uint16_t* x, const uint16_t* y, const uint16_t* z, uint32_t* out, const size_t n, const morton_executor& executor) {
+		parallel_detail::for_chunks(n, executor, [=](const size_t, const size_t begin, const size_t end) { morton3D_32_encode_batch(x + begin, y + begin, z + begin, out + begin, end - begin); });
+	}
+
+	inline void parallel_encode3D(const uint32_t* x, const uint32_t* y, const uint32_t* z, uint64_t* out, const size_t n, const unsigned int threads = 0) {
+		parallel_detail::for_chunks(n, threads, [=](const size_t, const size_t begin, const size_t end) { morton3D_64_encode_batch(x + begin, y + begin, z + begin, out + begin, end - begin); });
+	}
+	inline void parallel_encode3D(const uint32_t* x, const uint32_t* y, const uint32_t* z, uint64_t* out, const size_t n, const morton_executor& executor) {
+		parallel_detail::for_chunks(n, executor, [=](const size_t, const size_t begin, const size_t end) { morton3D_64_encode_batch(x + begin, y + begin, z + begin, out + begin, end - begin); });
+	}
+
+	// DECODE 3D Morton codes in parallel, on the libmorton thread pool (threads = 0: all hardware threads) or on an executor
+	inline void parallel_decode3D(const uint32_t* m, uint16_t* x, uint16_t* y, uint16_t* z, const size_t n, const unsigned int threads = 0) {
+		parallel_detail::for_chunks(n, threads, [=](const size_t, const size_t begin, const size_t end) { morton3D_32_decode_batch(m + begin, x + begin, y + begin, z + begin, end - begin); });
+	}
+	inline void parallel_decode3D(const uint32_t* m, uint16_t* x, uint16_t* y, uint16_t* z, const size_t n, const morton_executor& executor) {
+		parallel_detail::for_chunks(n, executor, [=](const size_t, const size_t begin, const size_t end) { morton3D_32_decode_batch(m + begin, x + begin, y + begin, z + begin, end - begin); });
+	}
+
+	inline void parallel_decode3D(const uint64_t* m, uint32_t* x, uint32_t* y, uint32_t* z, const size_t n, const unsigned int threads = 0) {
+		parallel_detail::for_chunks(n, threads, [=](const size_t, const size_t begin, const size_t end) { morton3D_64_decode_batch(m + begin, x + begin, y + begin, z + begin, end - begin); });
+	}
+	inline void parallel_decode3D(const uint64_t* m, uint32_t* x, uint32_t* y, uint32_t* z, const size_t n, const morton_executor& executor) {
+		parallel_detail::for_chunks(n, executor, [=](const size_t, const size_t begin, const size_t end) { morton3D_64_decode_batch(m + begin, x + begin, y + begin, z + begin, end - begin); });
+	}
+}
@@ -0,0 +1,186 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "morton_common.h"
+
+// Libmorton - Sorting Morton codes (optionally with a payload per code) : parallel LSD radix sort
+// Sorts on 8-bit digits, lowest digit first. Digits above the highest set bit of all keys are skipped (3D 64-bit codes use
+// 63 bits, and codes of small coordinates far less), and so is every pass where all keys have the same digit.
+// Each thread owns a slice of the array: in every pass it counts the digits in its slice, and after the counts of all threads
+// are turned into offsets, it scatters its slice. Threads are started once per sort. The sort is stable.
+// Points can also be sorted in Morton order without any codes: morton_less compares their coordinates directly.
+
+namespace libmorton {
+
+	namespace sort_detail {
+		static const unsigned int radix_bits = 8;
+		static const size_t radix_size = static_cast<size_t>(1) << radix_bits;
+		static const size_t min_keys_per_thread = static_cast<size_t>(1) << 16; // below this, threads cost more than they gain
+
+		// Blocks until count threads have called wait()
+		struct barrier {
+			explicit barrier(const unsigned int count) : count(count), waiting(0), generation(0) {}
+			void wait() {
+				std::unique_lock<std::mutex> lock(mutex);
+				const unsigned int gen = generation;
+				if (++waiting == count) {
+					waiting = 0;
+					++generation;
+					condition.notify_all();
+				}
+				else {
+					condition.wait(lock, [&] { return gen != generation; });
+				}
+			}
+			std::mutex mutex;
+			std::condition_variable condition;
+			const unsigned int count;
+			unsigned int waiting;
+			unsigned int generation;
+		};
+
+		// Number of threads to use for n keys (0 = one per hardware thread)
+		inline unsigned int sort_threads(const size_t n, unsigned int threads) {
+			if (threads == 0) { threads = std::thread::hardware_concurrency(); }
+			const size_t useful = n / min_keys_per_thread;
+			if (threads > useful) { threads = static_cast<unsigned int>(useful); }
+			return (threads == 0) ? 1 : threads;
+		}
+
+		// Sorts keys[0, n) and (when values isn't null) moves values[i] along with keys[i]
+		template<typename morton, typename payload>
+		inline void radix_sort(morton* keys, payload* values, const size_t n, unsigned int threads) {
+			if (n < 2) { return; }
+			threads = sort_threads(n, threads);
+			const size_t slice = (n + threads - 1) / threads;
+			std::vector<morton> key_buffer(n);
+			std::vector<payload> value_buffer(values ? n : 0);
+			std::vector<morton> used_bits(threads, 0);
+			std::vector<size_t> offsets(threads * radix_size);
+			bool skip = false;
+			barrier sync(threads);
+
+			const auto work = [&](const unsigned int t) {
+				const size_t begin = std::min(n, t * slice);
+				const size_t end = std::min(n, begin + slice);
+				// which bits are used at all
+				morton bits = 0;
+				for (size_t i = begin; i < end; ++i) { bits |= keys[i]; }
+				used_bits[t] = bits;
+				sync.wait();
+				for (unsigned int i = 0; i < threads; ++i) { bits |= used_bits[i]; }
+				unsigned long top = 0;
+				findFirstSetBit<morton>(bits, &top); // all keys zero: 0 passes
+				const unsigned int passes = static_cast<unsigned int>((top + radix_bits - 1) / radix_bits);
+
+				morton* src = keys;
+				morton* dst = key_buffer.data();
+				payload* value_src = values;
+				payload* value_dst = values ? value_buffer.data() : nullptr;
+				size_t* offset = &offsets[t * radix_size];
+				for (unsigned int pass = 0; pass < passes; ++pass) {
+					const unsigned int shift = pass * radix_bits;
+					for (size_t d = 0; d < radix_size; ++d) { offset[d] = 0; }
+					for (size_t i = begin; i < end; ++i) { ++offset[static_cast<size_t>((src[i] >> shift) & (radix_size - 1))]; }
+					sync.wait();
+					// counts -> offsets: digit by digit, and within a digit thread by thread, which keeps the sort stable
+					if (t == 0) {
+						size_t sum = 0;
+						skip = false;
+						for (size_t d = 0; d < radix_size; ++d) {
+							for (unsigned int i = 0; i < threads; ++i) {
+								const size_t count = offsets[i * radix_size + d];
+								skip |= (count == n);
+								offsets[i * radix_size + d] = sum;
+								sum += count;
+							}
+						}
+					}
+					sync.wait();
+					if (skip) { continue; } // every key has the same digit
+					if (value_src) {
+						for (size_t i = begin; i < end; ++i) {
+							const size_t to = offset[static_cast<size_t>((src[i] >> shift) & (radix_size - 1))]++;
+							dst[to] = src[i];
+							value_dst[to] = value_src[i];
+						}
+					}
+					else {
+						for (size_t i = begin; i < end; ++i) {
+							dst[offset[static_cast<size_t>((src[i] >> shift) & (radix_size - 1))]++] = src[i];
+						}
+					}
+					std::swap(src, dst);
+					std::swap(value_src, value_dst);
+					sync.wait();
+				}
+				// odd number of scatters: the result is in the buffers
+				if (src != keys) {
+					for (size_t i = begin; i < end; ++i) { keys[i] = src[i]; }
+					if (values) {
+						for (size_t i = begin; i < end; ++i) { values[i] = value_src[i]; }
+					}
+				}
+			};
+
+			std::vector<std::thread> pool;
+			pool.reserve(threads - 1);
+			for (unsigned int t = 1; t < threads; ++t) { pool.push_back(std::thread(work, t)); }
+			work(0);
+			for (size_t t = 0; t < pool.size(); ++t) { pool[t].join(); }
+		}
+
+		// Is the highest set bit of x below the highest set bit of y
+		template<typename ucoord>
+		inline bool lessMsb(const ucoord x, const ucoord y) {
+			return x < y && x < static_cast<ucoord>(x ^ y);
+		}
+	}  // namespace sort_detail
+
+	// SORT Morton codes : parallel LSD radix sort (threads = 0: one per hardware thread)
+	template<typename morton>
+	inline void morton_sort(morton* keys, const size_t n, const unsigned int threads = 0) {
+		sort_detail::radix_sort<morton, morton>(keys, nullptr, n, threads);
+	}
+
+	// SORT Morton codes and their payloads (an index, a struct, ...) : parallel LSD radix sort (threads = 0: one per hardware thread)
+	// values[i] ends up next to keys[i]. The payload type has to be default constructible and copy assignable.
+	template<typename morton, typename payload>
+	inline void morton_sort(morton* keys, payload* values, const size_t n, const unsigned int threads = 0) {
+		sort_detail::radix_sort<morton, payload>(keys, values, n, threads);
+	}
+
+	// COMPARE two dims-dimensional points in Morton order, without encoding them (Chan, 2002)
+	// The codes of a and b first differ at the highest bit of a[axis] ^ b[axis] over all axes (at equal highest bits, the
+	// highest axis, which comes first in a code), so comparing that axis compares the codes. Works for any coordinate width,
+	// also where the codes wouldn't fit in 64 bits. Signed coordinates compare like the codes of morton*_encode_signed.
+	template<unsigned int dims, typename coord>
+	inline bool morton_less(const coord* a, const coord* b) {
+		typedef typename std::make_unsigned<coord>::type ucoord;
+		unsigned int axis = dims - 1;
+		ucoord highest = static_cast<ucoord>(static_cast<ucoord>(a[axis]) ^ static_cast<ucoord>(b[axis]));
+		for (unsigned int d = dims - 1; d-- > 0;) {
+			const ucoord diff = static_cast<ucoord>(static_cast<ucoord>(a[d]) ^ static_cast<ucoord>(b[d]));
+			if (sort_detail::lessMsb<ucoord>(highest, diff)) {
+				axis = d;
+				highest = diff;
+			}
+		}
+		return a[axis] < b[axis];
+	}
+
+	// SORT points in Morton order with morton_less, without storing a code per point (not stable)
+	template<typename coord, size_t dims>
+	inline void morton_sort_points(std::array<coord, dims>* points, const size_t n) {
+		std::sort(points, points + n, [](const std::array<coord, dims>& a, const std::array<coord, dims>& b) {
+			return morton_less<static_cast<unsigned int>(dims), coord>(a.data(), b.data());
+		});
+	}
+}
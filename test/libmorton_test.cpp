@@ -9,6 +9,7 @@
 #include "test2D_performance.h"
 #include "test3D_correctness.h"
 #include "test3D_performance.h"
+#include "testND_correctness.h"
 
 using namespace std;
 using namespace std::chrono;
@@ -65,6 +66,9 @@ void printHeader(){
 	cout << " (Compiler: MSVC " << _MSC_VER << ")" << endl;
 #elif defined(__GNUC__)
     cout << " (Compiler: GCC) " << endl;
+#endif
+#if defined(LIBMORTON_RUNTIME_DISPATCH)
+	cout << "++ Runtime dispatch selected: " << dispatch().name << endl;
 #endif
 	cout << "++ Running tests until we've reached " << MAXRUNSIZE << "^3 codes" << endl;
 }
@@ -77,12 +81,14 @@ void registerFunctions() {
 	f3D_64_encode.push_back(encode_3D_64_wrapper("LUT Early Termination", &m3D_e_LUT_ET<uint_fast64_t, uint_fast32_t>));
 	f3D_64_encode.push_back(encode_3D_64_wrapper("LUT", &m3D_e_LUT<uint_fast64_t, uint_fast32_t>));
 	f3D_64_encode.push_back(encode_3D_64_wrapper("Magicbits", &m3D_e_magicbits<uint_fast64_t, uint_fast32_t>));
+	f3D_64_encode.push_back(encode_3D_64_wrapper("Magicbits (control: masks loaded from memory)", &control3D_e_magicbits_loads));
 	f3D_64_encode.push_back(encode_3D_64_wrapper("For ET", &m3D_e_for_ET<uint_fast64_t, uint_fast32_t>));
 	f3D_64_encode.push_back(encode_3D_64_wrapper("For", &m3D_e_for<uint_fast64_t, uint_fast32_t>));
 
 	// Register 3D 32-bit encode functions
 	f3D_32_encode.push_back(encode_3D_32_wrapper("LUT Pre-shifted Early Termination", &m3D_e_sLUT_ET<uint_fast32_t, uint_fast16_t>));
 	f3D_32_encode.push_back(encode_3D_32_wrapper("LUT Pre-shifted", &m3D_e_sLUT<uint_fast32_t, uint_fast16_t>));
+	f3D_32_encode.push_back(encode_3D_32_wrapper("LUT Pre-shifted (exact width)", &exact3D_32_e_sLUT));
 	f3D_32_encode.push_back(encode_3D_32_wrapper("LUT Early Termination", &m3D_e_LUT_ET<uint_fast32_t, uint_fast16_t>));
 	f3D_32_encode.push_back(encode_3D_32_wrapper("LUT", &m3D_e_LUT<uint_fast32_t, uint_fast16_t>));
 	f3D_32_encode.push_back(encode_3D_32_wrapper("Magicbits", &m3D_e_magicbits<uint_fast32_t, uint_fast16_t>));
@@ -95,24 +101,44 @@ void registerFunctions() {
 	f3D_64_decode.push_back(decode_3D_64_wrapper("LUT Early Termination", &m3D_d_LUT_ET<uint_fast64_t, uint_fast32_t>));
 	f3D_64_decode.push_back(decode_3D_64_wrapper("LUT", &m3D_d_LUT<uint_fast64_t, uint_fast32_t>));
 	f3D_64_decode.push_back(decode_3D_64_wrapper("Magicbits", &m3D_d_magicbits<uint_fast64_t, uint_fast32_t>));
+	f3D_64_decode.push_back(decode_3D_64_wrapper("Magicbits (control: masks loaded from memory)", &control3D_d_magicbits_loads));
 	f3D_64_decode.push_back(decode_3D_64_wrapper("For ET", &m3D_d_for_ET<uint_fast64_t, uint_fast32_t>));
 	f3D_64_decode.push_back(decode_3D_64_wrapper("For", &m3D_d_for<uint_fast64_t, uint_fast32_t>));
 
 	// Register 3D 32-bit decode functions
 	f3D_32_decode.push_back(decode_3D_32_wrapper("LUT Pre-shifted Early Termination", &m3D_d_sLUT_ET<uint_fast32_t, uint_fast16_t>));
 	f3D_32_decode.push_back(decode_3D_32_wrapper("LUT Pre-shifted", &m3D_d_sLUT<uint_fast32_t, uint_fast16_t>));
+	f3D_32_decode.push_back(decode_3D_32_wrapper("LUT Pre-shifted (exact width)", &exact3D_32_d_sLUT));
 	f3D_32_decode.push_back(decode_3D_32_wrapper("LUT Early Termination", &m3D_d_LUT_ET<uint_fast32_t, uint_fast16_t>));
 	f3D_32_decode.push_back(decode_3D_32_wrapper("LUT", &m3D_d_LUT<uint_fast32_t, uint_fast16_t>));
 	f3D_32_decode.push_back(decode_3D_32_wrapper("Magicbits", &m3D_d_magicbits<uint_fast32_t, uint_fast16_t>));
 	f3D_32_decode.push_back(decode_3D_32_wrapper("For ET", &m3D_d_for_ET<uint_fast32_t, uint_fast16_t>));
 	f3D_32_decode.push_back(decode_3D_32_wrapper("For", &m3D_d_for<uint_fast32_t, uint_fast16_t>));
 
+	// Register 3D generic N-dimensional functions (mortonND.h)
+	f3D_64_encode.push_back(encode_3D_64_wrapper("Generic ND Magicbits", &mND_e_magicbits<3, uint_fast64_t, uint_fast32_t>));
+	f3D_32_encode.push_back(encode_3D_32_wrapper("Generic ND Magicbits", &mND_e_magicbits<3, uint_fast32_t, uint_fast16_t>));
+	f3D_64_decode.push_back(decode_3D_64_wrapper("Generic ND Magicbits", &mND_d_magicbits<3, uint_fast64_t, uint_fast32_t>));
+	f3D_32_decode.push_back(decode_3D_32_wrapper("Generic ND Magicbits", &mND_d_magicbits<3, uint_fast32_t, uint_fast16_t>));
+	f3D_64_encode.push_back(encode_3D_64_wrapper("Anisotropic Magicbits (21/21/21)", &mAniso_e_magicbits<uint_fast64_t, uint_fast32_t, 21, 21, 21>));
+	f3D_32_encode.push_back(encode_3D_32_wrapper("Anisotropic Magicbits (10/10/10)", &mAniso_e_magicbits<uint_fast32_t, uint_fast16_t, 10, 10, 10>));
+	f3D_64_decode.push_back(decode_3D_64_wrapper("Anisotropic Magicbits (21/21/21)", &mAniso_d_magicbits<uint_fast64_t, uint_fast32_t, 21, 21, 21>));
+	f3D_32_decode.push_back(decode_3D_32_wrapper("Anisotropic Magicbits (10/10/10)", &mAniso_d_magicbits<uint_fast32_t, uint_fast16_t, 10, 10, 10>));
+
 	// Register 3D BMI intrinsics if available
 #if defined(__BMI2__) || defined(__AVX2__)
 	f3D_64_encode.push_back(encode_3D_64_wrapper("BMI2 instruction set", &m3D_e_BMI<uint_fast64_t, uint_fast32_t>));
 	f3D_32_encode.push_back(encode_3D_32_wrapper("BMI2 instruction set", &m3D_e_BMI<uint_fast32_t, uint_fast16_t>));
 	f3D_64_decode.push_back(decode_3D_64_wrapper("BMI2 Instruction set", &m3D_d_BMI<uint_fast64_t, uint_fast32_t>));
 	f3D_32_decode.push_back(decode_3D_32_wrapper("BMI2 Instruction set", &m3D_d_BMI<uint_fast32_t, uint_fast16_t>));
+	f3D_64_encode.push_back(encode_3D_64_wrapper("Generic ND BMI2 instruction set", &mND_e_BMI<3, uint_fast64_t, uint_fast32_t>));
+	f3D_32_encode.push_back(encode_3D_32_wrapper("Generic ND BMI2 instruction set", &mND_e_BMI<3, uint_fast32_t, uint_fast16_t>));
+	f3D_64_decode.push_back(decode_3D_64_wrapper("Generic ND BMI2 Instruction set", &mND_d_BMI<3, uint_fast64_t, uint_fast32_t>));
+	f3D_32_decode.push_back(decode_3D_32_wrapper("Generic ND BMI2 Instruction set", &mND_d_BMI<3, uint_fast32_t, uint_fast16_t>));
+	f3D_64_encode.push_back(encode_3D_64_wrapper("Anisotropic BMI2 instruction set (21/21/21)", &mAniso_e_BMI<uint_fast64_t, uint_fast32_t, 21, 21, 21>));
+	f3D_32_encode.push_back(encode_3D_32_wrapper("Anisotropic BMI2 instruction set (10/10/10)", &mAniso_e_BMI<uint_fast32_t, uint_fast16_t, 10, 10, 10>));
+	f3D_64_decode.push_back(decode_3D_64_wrapper("Anisotropic BMI2 Instruction set (21/21/21)", &mAniso_d_BMI<uint_fast64_t, uint_fast32_t, 21, 21, 21>));
+	f3D_32_decode.push_back(decode_3D_32_wrapper("Anisotropic BMI2 Instruction set (10/10/10)", &mAniso_d_BMI<uint_fast32_t, uint_fast16_t, 10, 10, 10>));
 #endif
 
 	// Register 3D AVX512 intrinsics if available
@@ -123,6 +149,18 @@ void registerFunctions() {
 	f3D_32_decode.push_back(decode_3D_32_wrapper("AVX512 Instruction set", &m3D_d_BITALG<uint_fast32_t, uint_fast16_t>));
 #endif
 
+	// Register the runtime dispatched morton.h functions
+#if defined(LIBMORTON_RUNTIME_DISPATCH)
+	f3D_64_encode.push_back(encode_3D_64_wrapper("morton.h (runtime dispatch)", &morton3D_64_encode));
+	f3D_32_encode.push_back(encode_3D_32_wrapper("morton.h (runtime dispatch)", &morton3D_32_encode));
+	f3D_64_decode.push_back(decode_3D_64_wrapper("morton.h (runtime dispatch)", &morton3D_64_decode));
+	f3D_32_decode.push_back(decode_3D_32_wrapper("morton.h (runtime dispatch)", &morton3D_32_decode));
+	f2D_64_encode.push_back(encode_2D_64_wrapper("morton.h (runtime dispatch)", &morton2D_64_encode));
+	f2D_32_encode.push_back(encode_2D_32_wrapper("morton.h (runtime dispatch)", &morton2D_32_encode));
+	f2D_64_decode.push_back(decode_2D_64_wrapper("morton.h (runtime dispatch)", &morton2D_64_decode));
+	f2D_32_decode.push_back(decode_2D_32_wrapper("morton.h (runtime dispatch)", &morton2D_32_decode));
+#endif
+
 	// Register 2D 64-bit encode functions	
 	f2D_64_encode.push_back(encode_2D_64_wrapper("LUT Pre-shifted Early Termination", &m2D_e_sLUT_ET<uint_fast64_t, uint_fast32_t>));
 	f2D_64_encode.push_back(encode_2D_64_wrapper("LUT Pre-shifted", &m2D_e_sLUT<uint_fast64_t, uint_fast32_t>));
@@ -135,6 +173,7 @@ void registerFunctions() {
 	// Register 2D 32-bit encode functions
 	f2D_32_encode.push_back(encode_2D_32_wrapper("LUT Pre-shifted Early Termination", &m2D_e_sLUT_ET<uint_fast32_t, uint_fast16_t>));
 	f2D_32_encode.push_back(encode_2D_32_wrapper("LUT Pre-shifted", &m2D_e_sLUT<uint_fast32_t, uint_fast16_t>));
+	f2D_32_encode.push_back(encode_2D_32_wrapper("LUT Pre-shifted (exact width)", &exact2D_32_e_sLUT));
 	f2D_32_encode.push_back(encode_2D_32_wrapper("LUT Early Termination", &m2D_e_LUT_ET<uint_fast32_t, uint_fast16_t>));
 	f2D_32_encode.push_back(encode_2D_32_wrapper("LUT", &m2D_e_LUT<uint_fast32_t, uint_fast16_t>));
 	f2D_32_encode.push_back(encode_2D_32_wrapper("Magicbits Combined", &m2D_e_magicbits_combined));
@@ -154,12 +193,25 @@ void registerFunctions() {
 	// Register 2D 32-bit decode functions
 	f2D_32_decode.push_back(decode_2D_32_wrapper("LUT Shifted Early Termination", &m2D_d_sLUT_ET<uint_fast32_t, uint_fast16_t>));
 	f2D_32_decode.push_back(decode_2D_32_wrapper("LUT Pre-shifted", &m2D_d_sLUT<uint_fast32_t, uint_fast16_t>));
+	f2D_32_decode.push_back(decode_2D_32_wrapper("LUT Pre-shifted (exact width)", &exact2D_32_d_sLUT));
 	f2D_32_decode.push_back(decode_2D_32_wrapper("LUT Early Termination", &m2D_d_LUT_ET<uint_fast32_t, uint_fast16_t>));
 	f2D_32_decode.push_back(decode_2D_32_wrapper("LUT", &m2D_d_LUT<uint_fast32_t, uint_fast16_t>));
 	f2D_32_decode.push_back(decode_2D_32_wrapper("Magicbits Combined", &m2D_d_magicbits_combined));
 	f2D_32_decode.push_back(decode_2D_32_wrapper("Magicbits", &m2D_d_magicbits<uint_fast32_t, uint_fast16_t>));
 	f2D_32_decode.push_back(decode_2D_32_wrapper("For", &m2D_d_for<uint_fast32_t, uint_fast16_t>));
 	f2D_32_decode.push_back(decode_2D_32_wrapper("For ET", &m2D_d_for_ET<uint_fast32_t, uint_fast16_t>));
+
+	// Register 2D generic N-dimensional functions (mortonND.h)
+	f2D_64_encode.push_back(encode_2D_64_wrapper("Generic ND Magicbits", &mND_e_magicbits<2, uint_fast64_t, uint_fast32_t>));
+	f2D_32_encode.push_back(encode_2D_32_wrapper("Generic ND Magicbits", &mND_e_magicbits<2, uint_fast32_t, uint_fast16_t>));
+	f2D_64_decode.push_back(decode_2D_64_wrapper("Generic ND Magicbits", &mND_d_magicbits<2, uint_fast64_t, uint_fast32_t>));
+	f2D_32_decode.push_back(decode_2D_32_wrapper("Generic ND Magicbits", &mND_d_magicbits<2, uint_fast32_t, uint_fast16_t>));
+#if defined(__BMI2__) || defined(__AVX2__)
+	f2D_64_encode.push_back(encode_2D_64_wrapper("Generic ND BMI2 instruction set", &mND_e_BMI<2, uint_fast64_t, uint_fast32_t>));
+	f2D_32_encode.push_back(encode_2D_32_wrapper("Generic ND BMI2 instruction set", &mND_e_BMI<2, uint_fast32_t, uint_fast16_t>));
+	f2D_64_decode.push_back(decode_2D_64_wrapper("Generic ND BMI2 Instruction set", &mND_d_BMI<2, uint_fast64_t, uint_fast32_t>));
+	f2D_32_decode.push_back(decode_2D_32_wrapper("Generic ND BMI2 Instruction set", &mND_d_BMI<2, uint_fast32_t, uint_fast16_t>));
+#endif
 	
 }
 
@@ -190,6 +242,49 @@ int main(int argc, char *argv[]) {
 	correct = correct && check3D_EncodeCorrectness<uint_fast32_t, uint_fast16_t, 32>(f3D_32_encode);
 	correct = correct && check3D_DecodeCorrectness<uint_fast64_t, uint_fast32_t, 64>(f3D_64_decode);
 	correct = correct && check3D_DecodeCorrectness<uint_fast32_t, uint_fast16_t, 32>(f3D_32_decode);
+	correct = correct && check3D_EncodeBatchCorrectness<uint64_t, uint32_t, 64>(&morton3D_64_encode_batch);
+	correct = correct && check3D_EncodeBatchCorrectness<uint32_t, uint16_t, 32>(&morton3D_32_encode_batch);
+	correct = correct && check3D_DecodeBatchCorrectness<uint64_t, uint32_t, 64>(&morton3D_64_decode_batch);
+	correct = correct && check3D_DecodeBatchCorrectness<uint32_t, uint16_t, 32>(&morton3D_32_decode_batch);
+	// packed {x, y, z} records, and padded records with the fields in a different order
+	correct = correct && check3D_EncodeStridedCorrectness<uint64_t, uint32_t, 64>(&morton3D_64_encode_strided, 12, 0, 4, 8);
+	correct = correct && check3D_EncodeStridedCorrectness<uint64_t, uint32_t, 64>(&morton3D_64_encode_strided, 23, 9, 1, 17);
+	correct = correct && check3D_EncodeStridedCorrectness<uint32_t, uint16_t, 32>(&morton3D_32_encode_strided, 6, 0, 2, 4);
+	correct = correct && check3D_EncodeStridedCorrectness<uint32_t, uint16_t, 32>(&morton3D_32_encode_strided, 11, 7, 3, 0);
+	correct = correct && check3D_EncodeFloatsCorrectness<uint64_t, uint32_t, float, 64>(&morton3D_64_encode_floats, &morton3D_64_decode_floats);
+	correct = correct && check3D_EncodeFloatsCorrectness<uint32_t, uint16_t, float, 32>(&morton3D_32_encode_floats, &morton3D_32_decode_floats);
+	correct = correct && check3D_EncodeFloatsCorrectness<uint64_t, uint32_t, double, 64>(&morton3D_64_encode_floats, &morton3D_64_decode_floats);
+	correct = correct && check3D_EncodeFloatsCorrectness<uint32_t, uint16_t, double, 32>(&morton3D_32_encode_floats, &morton3D_32_decode_floats);
+	correct = correct && check3D_SignedCorrectness<uint64_t, int32_t, 64>(&morton3D_64_encode_signed, &morton3D_64_decode_signed, &morton3D_64_encode_signed_batch, &morton3D_64_decode_signed_batch);
+	correct = correct && check3D_SignedCorrectness<uint32_t, int16_t, 32>(&morton3D_32_encode_signed, &morton3D_32_decode_signed, &morton3D_32_encode_signed_batch, &morton3D_32_decode_signed_batch);
+	correct = correct && check3D_ArithmeticCorrectness<uint64_t, uint32_t, 64>();
+	correct = correct && check3D_ArithmeticCorrectness<uint32_t, uint16_t, 32>();
+	correct = correct && check3D_NeighboursCorrectness<uint64_t, uint32_t, 64>(&morton3D_64_neighbours);
+	correct = correct && check3D_NeighboursCorrectness<uint32_t, uint16_t, 32>(&morton3D_32_neighbours);
+	correct = correct && check3D_BoxQueryCorrectness<uint64_t, uint32_t, 64>();
+	correct = correct && check3D_BoxQueryCorrectness<uint32_t, uint16_t, 32>();
+	correct = correct && check3D_BoxIntervalsCorrectness<uint64_t, uint32_t, 64>();
+	correct = correct && check3D_BoxIntervalsCorrectness<uint32_t, uint16_t, 32>();
+	correct = correct && check3D_BoxIteratorCorrectness<uint64_t, uint32_t, 64>();
+	correct = correct && check3D_BoxIteratorCorrectness<uint32_t, uint16_t, 32>();
+	correct = correct && check3D_HierarchyCorrectness<uint64_t, uint32_t, 64>();
+	correct = correct && check3D_HierarchyCorrectness<uint32_t, uint16_t, 32>();
+	correct = correct && check3D_ConstexprCorrectness<uint_fast64_t, uint_fast32_t, 64>();
+	correct = correct && check3D_ConstexprCorrectness<uint32_t, uint16_t, 32>();
+	correct = correct && check3D_ExactWidthCorrectness<uint64_t, uint32_t, 64>();
+	correct = correct && check3D_ExactWidthCorrectness<uint32_t, uint16_t, 32>();
+	correct = correct && check3D_SortCorrectness<uint64_t, uint32_t, 64>();
+	correct = correct && check3D_SortCorrectness<uint32_t, uint16_t, 32>();
+	correct = correct && check3D_ParallelCorrectness<uint64_t, uint32_t, 64>();
+	correct = correct && check3D_ParallelCorrectness<uint32_t, uint16_t, 32>();
+	correct = correct && check3D_OctreeCorrectness<uint64_t, uint32_t, 64>();
+	correct = correct && check3D_OctreeCorrectness<uint32_t, uint16_t, 32>();
+	correct = correct && check3D_BVHCorrectness<uint64_t, uint32_t, 64>();
+	correct = correct && check3D_BVHCorrectness<uint32_t, uint16_t, 32>();
+	correct = correct && check3D_HilbertCorrectness<uint_fast64_t, uint_fast32_t, 64>(&hilbert3D_64_encode, &hilbert3D_64_decode, &hilbert3D_64_encode_batch, &hilbert3D_64_decode_batch);
+	correct = correct && check3D_HilbertCorrectness<uint_fast32_t, uint_fast16_t, 32>(&hilbert3D_32_encode, &hilbert3D_32_decode, &hilbert3D_32_encode_batch, &hilbert3D_32_decode_batch);
+	correct = correct && check3D_GridCorrectness();
+	correct = correct && check3D_128Correctness();
 
 	cout << "++ Checking 2D methods for correctness" << endl;
 	correct = correct && check2D_EncodeDecodeMatch<uint_fast64_t, uint_fast32_t, 64>(f2D_64_encode, f2D_64_decode, times);
@@ -198,6 +293,79 @@ int main(int argc, char *argv[]) {
 	correct = correct && check2D_EncodeCorrectness<uint_fast32_t, uint_fast16_t, 32>(f2D_32_encode);
 	correct = correct && check2D_DecodeCorrectness<uint_fast64_t, uint_fast32_t, 64>(f2D_64_decode);
 	correct = correct && check2D_DecodeCorrectness<uint_fast32_t, uint_fast16_t, 32>(f2D_32_decode);
+	correct = correct && check2D_EncodeBatchCorrectness<uint64_t, uint32_t, 64>(&morton2D_64_encode_batch);
+	correct = correct && check2D_EncodeBatchCorrectness<uint32_t, uint16_t, 32>(&morton2D_32_encode_batch);
+	correct = correct && check2D_DecodeBatchCorrectness<uint64_t, uint32_t, 64>(&morton2D_64_decode_batch);
+	correct = correct && check2D_DecodeBatchCorrectness<uint32_t, uint16_t, 32>(&morton2D_32_decode_batch);
+	correct = correct && check2D_EncodeStridedCorrectness<uint64_t, uint32_t, 64>(&morton2D_64_encode_strided, 8, 0, 4);
+	correct = correct && check2D_EncodeStridedCorrectness<uint64_t, uint32_t, 64>(&morton2D_64_encode_strided, 13, 6, 1);
+	correct = correct && check2D_EncodeStridedCorrectness<uint32_t, uint16_t, 32>(&morton2D_32_encode_strided, 4, 0, 2);
+	correct = correct && check2D_EncodeStridedCorrectness<uint32_t, uint16_t, 32>(&morton2D_32_encode_strided, 7, 5, 1);
+	correct = correct && check2D_SignedCorrectness<uint64_t, int32_t, 64>(&morton2D_64_encode_signed, &morton2D_64_decode_signed, &morton2D_64_encode_signed_batch, &morton2D_64_decode_signed_batch);
+	correct = correct && check2D_SignedCorrectness<uint32_t, int16_t, 32>(&morton2D_32_encode_signed, &morton2D_32_decode_signed, &morton2D_32_encode_signed_batch, &morton2D_32_decode_signed_batch);
+	correct = correct && check2D_ArithmeticCorrectness<uint64_t, uint32_t, 64>();
+	correct = correct && check2D_ArithmeticCorrectness<uint32_t, uint16_t, 32>();
+	correct = correct && check2D_NeighboursCorrectness<uint64_t, uint32_t, 64>(&morton2D_64_neighbours);
+	correct = correct && check2D_NeighboursCorrectness<uint32_t, uint16_t, 32>(&morton2D_32_neighbours);
+	correct = correct && check2D_BoxQueryCorrectness<uint64_t, uint32_t, 64>();
+	correct = correct && check2D_BoxQueryCorrectness<uint32_t, uint16_t, 32>();
+	correct = correct && check2D_BoxIntervalsCorrectness<uint64_t, uint32_t, 64>();
+	correct = correct && check2D_BoxIntervalsCorrectness<uint32_t, uint16_t, 32>();
+	correct = correct && check2D_BoxIteratorCorrectness<uint64_t, uint32_t, 64>();
+	correct = correct && check2D_BoxIteratorCorrectness<uint32_t, uint16_t, 32>();
+	correct = correct && check2D_HierarchyCorrectness<uint64_t, uint32_t, 64>();
+	correct = correct && check2D_HierarchyCorrectness<uint32_t, uint16_t, 32>();
+	correct = correct && check2D_ConstexprCorrectness<uint_fast64_t, uint_fast32_t, 64>();
+	correct = correct && check2D_ConstexprCorrectness<uint32_t, uint16_t, 32>();
+	correct = correct && check2D_ExactWidthCorrectness<uint64_t, uint32_t, 64>();
+	correct = correct && check2D_ExactWidthCorrectness<uint32_t, uint16_t, 32>();
+	correct = correct && check2D_ParallelCorrectness<uint64_t, uint32_t, 64>();
+	correct = correct && check2D_ParallelCorrectness<uint32_t, uint16_t, 32>();
+	correct = correct && check2D_HilbertCorrectness<uint_fast64_t, uint_fast32_t, 64>(&hilbert2D_64_encode, &hilbert2D_64_decode, &hilbert2D_64_encode_batch, &hilbert2D_64_decode_batch);
+	correct = correct && check2D_HilbertCorrectness<uint_fast32_t, uint_fast16_t, 32>(&hilbert2D_32_encode, &hilbert2D_32_decode, &hilbert2D_32_encode_batch, &hilbert2D_32_decode_batch);
+	correct = correct && check2D_GridCorrectness();
+	correct = correct && check2D_128Correctness();
+	correct = correct && checkND_Correctness<uint64_t, uint32_t, 2>();
+	correct = correct && checkND_Correctness<uint64_t, uint32_t, 3>();
+	correct = correct && checkND_Correctness<uint64_t, uint16_t, 4>();
+	correct = correct && checkND_Correctness<uint64_t, uint16_t, 5>();
+	correct = correct && checkND_Correctness<uint64_t, uint16_t, 6>();
+	correct = correct && checkND_Correctness<uint32_t, uint8_t, 4>();
+	correct = correct && checkND_Correctness<uint64_t, uint8_t, 16>();
+	correct = correct && checkAniso_Correctness<uint64_t, uint32_t, 24, 24, 16>();
+	correct = correct && checkAniso_Correctness<uint64_t, uint32_t, 21, 21, 21>();
+	correct = correct && checkAniso_Correctness<uint64_t, uint32_t, 32, 20, 12>();
+	correct = correct && checkAniso_Correctness<uint64_t, uint32_t, 40, 17>();
+	correct = correct && checkAniso_Correctness<uint32_t, uint16_t, 12, 12, 8>();
+	correct = correct && checkAniso_Correctness<uint32_t, uint16_t, 8, 8, 8, 5>();
+	correct = correct && checkND_MortonLessCorrectness<uint16_t, 2>();
+	correct = correct && checkND_MortonLessCorrectness<uint32_t, 3>();
+	correct = correct && checkND_MortonLessCorrectness<int32_t, 3>();
+	correct = correct && checkND_MortonLessCorrectness<uint32_t, 4>();
+	correct = correct && checkND_MortonLessCorrectness<uint64_t, 3>();
+	correct = correct && checkND_MortonLessCorrectness<uint8_t, 5>();
+#if defined(LIBMORTON_RUNTIME_DISPATCH)
+	// morton.h points to the SIMD batch methods on most CPU's, so check the portable ones separately
+	const dispatch_detail::cpu_features baseline = { false, false, false };
+	const dispatch_table portable = make_dispatch_table(baseline);
+	cout << "++ Checking portable dispatch methods (" << portable.name << ") for correctness" << endl;
+	correct = correct && check3D_EncodeBatchCorrectness<uint64_t, uint32_t, 64>(portable.m3D_64_encode_batch);
+	correct = correct && check3D_EncodeBatchCorrectness<uint32_t, uint16_t, 32>(portable.m3D_32_encode_batch);
+	correct = correct && check3D_DecodeBatchCorrectness<uint64_t, uint32_t, 64>(portable.m3D_64_decode_batch);
+	correct = correct && check3D_DecodeBatchCorrectness<uint32_t, uint16_t, 32>(portable.m3D_32_decode_batch);
+	correct = correct && check3D_EncodeStridedCorrectness<uint64_t, uint32_t, 64>(portable.m3D_64_encode_strided, 12, 0, 4, 8);
+	correct = correct && check3D_EncodeStridedCorrectness<uint32_t, uint16_t, 32>(portable.m3D_32_encode_strided, 11, 7, 3, 0);
+	correct = correct && check3D_EncodeFloatsCorrectness<uint64_t, uint32_t, float, 64>(portable.m3D_64_encode_floats, &morton3D_64_decode_floats);
+	correct = correct && check3D_EncodeFloatsCorrectness<uint32_t, uint16_t, double, 32>(portable.m3D_32_encode_doubles, &morton3D_32_decode_floats);
+	correct = correct && check2D_EncodeBatchCorrectness<uint64_t, uint32_t, 64>(portable.m2D_64_encode_batch);
+	correct = correct && check2D_EncodeBatchCorrectness<uint32_t, uint16_t, 32>(portable.m2D_32_encode_batch);
+	correct = correct && check2D_DecodeBatchCorrectness<uint64_t, uint32_t, 64>(portable.m2D_64_decode_batch);
+	correct = correct && check2D_DecodeBatchCorrectness<uint32_t, uint16_t, 32>(portable.m2D_32_decode_batch);
+	correct = correct && check2D_EncodeStridedCorrectness<uint64_t, uint32_t, 64>(portable.m2D_64_encode_strided, 13, 6, 1);
+	correct = correct && check2D_EncodeStridedCorrectness<uint32_t, uint16_t, 32>(portable.m2D_32_encode_strided, 7, 5, 1);
+	correct = correct && check3D_NeighboursCorrectness<uint64_t, uint32_t, 64>(portable.m3D_64_neighbours);
+	correct = correct && check2D_NeighboursCorrectness<uint32_t, uint16_t, 32>(portable.m2D_32_neighbours);
+#endif
 	if (!correct) {
 		cout << "++ ERROR: One of the correctness tests failed." << endl;
 		exit(1);
@@ -13,6 +13,8 @@
 #include <limits>
 #include <valarray>
 #include <functional>
+#include <algorithm>
+#include <thread>
 
 // Load utils
 #include "util.h"
@@ -22,6 +24,7 @@
 // Load libraries we're going to test
 #include <libmorton/morton2D.h>
 #include <libmorton/morton3D.h>
+#include <libmorton/mortonND.h>
 #if defined(__BMI2__) || defined(__AVX2__)
 #include <libmorton/morton_BMI.h>
 #endif
@@ -31,6 +34,13 @@
 
 // Load main morton include file (should be unnecessary)
 #include <libmorton/morton.h>
+#include <libmorton/morton_sort.h>
+#include <libmorton/morton_parallel.h>
+#include <libmorton/morton_octree.h>
+#include <libmorton/morton_bvh.h>
+#include <libmorton/hilbert.h>
+#include <libmorton/morton_grid.h>
+#include <libmorton/morton_hierarchy.h>
 
 using std::string;
 
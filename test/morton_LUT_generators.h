@@ -4,6 +4,7 @@
 #include <libmorton/morton3D.h>
 
 #include <iostream>
+#include <vector>
 
 namespace libmorton {
 
@@ -99,4 +100,92 @@ namespace libmorton {
 			printTable<uint_fast8_t>(z_table, total, 16);
 		}
 	}
+
+	// HILBERT: one level of the compact Hilbert curve (Hamilton, "Compact Hilbert Indices", 2006), in dims dimensions
+	// The state is the entry point e and the direction d of the current cell. Takes a Morton digit (x in bit 0) to a Hilbert
+	// digit when to_hilbert is set, and the other way around when it isn't, and moves to the state of the chosen subcell.
+	struct hilbert_state {
+		unsigned int e;
+		unsigned int d;
+	};
+
+	inline unsigned int hilbertRotateRight(unsigned int x, unsigned int r, unsigned int dims) {
+		r %= dims;
+		return ((x >> r) | (x << (dims - r))) & ((1u << dims) - 1);
+	}
+
+	inline unsigned int hilbertRotateLeft(unsigned int x, unsigned int r, unsigned int dims) {
+		r %= dims;
+		return ((x << r) | (x >> (dims - r))) & ((1u << dims) - 1);
+	}
+
+	inline unsigned int hilbertGray(unsigned int i) {
+		return i ^ (i >> 1);
+	}
+
+	inline unsigned int hilbertGrayInverse(unsigned int g) {
+		unsigned int i = g;
+		for (unsigned int s = 1; (g >> s) != 0; s++) { i ^= g >> s; }
+		return i;
+	}
+
+	inline unsigned int hilbertTrailingSetBits(unsigned int i) {
+		unsigned int count = 0;
+		for (; i & 1; i >>= 1) { count++; }
+		return count;
+	}
+
+	inline unsigned int hilbertStep(unsigned int dims, hilbert_state& state, unsigned int digit, bool to_hilbert) {
+		const unsigned int w = to_hilbert ? hilbertGrayInverse(hilbertRotateRight(digit ^ state.e, state.d + 1, dims)) : digit;
+		const unsigned int result = to_hilbert ? w : (hilbertRotateLeft(hilbertGray(w), state.d + 1, dims) ^ state.e);
+		const unsigned int entry = (w == 0) ? 0 : hilbertGray(2 * ((w - 1) / 2));
+		const unsigned int direction = (w == 0) ? 0 : (((w & 1) ? hilbertTrailingSetBits(w) : hilbertTrailingSetBits(w - 1)) % dims);
+		state.e ^= hilbertRotateLeft(entry, state.d + 1, dims);
+		state.d = (state.d + direction + 1) % dims;
+		return result;
+	}
+
+	// The states reachable from the start state (0, 0), numbered in the order in which they are found
+	inline std::vector<hilbert_state> hilbertStates(unsigned int dims) {
+		std::vector<hilbert_state> states(1, hilbert_state{ 0, 0 });
+		for (size_t k = 0; k < states.size(); k++) {
+			for (unsigned int digit = 0; digit < (1u << dims); digit++) {
+				hilbert_state next = states[k];
+				hilbertStep(dims, next, digit, true);
+				bool known = false;
+				for (size_t i = 0; i < states.size(); i++) { known |= (states[i].e == next.e && states[i].d == next.d); }
+				if (!known) { states.push_back(next); }
+			}
+		}
+		return states;
+	}
+
+	// Generate a Morton <-> Hilbert state machine table: for every state and every block of how_many_levels digits, the
+	// converted block with the number of the next state above it (shifted by dims * how_many_levels)
+	void generateHilbert_LUT(unsigned int dims, unsigned int how_many_levels, bool to_hilbert, uint_fast16_t*& table, size_t& total, bool print_table) {
+		const std::vector<hilbert_state> states = hilbertStates(dims);
+		const unsigned int block_bits = dims * how_many_levels;
+		const size_t blocks = (size_t)1 << block_bits;
+		total = states.size() * blocks;
+		table = (uint_fast16_t*)malloc(total * sizeof(uint_fast16_t));
+
+		for (size_t s = 0; s < states.size(); s++) {
+			for (size_t block = 0; block < blocks; block++) {
+				hilbert_state state = states[s];
+				size_t converted = 0;
+				for (unsigned int level = how_many_levels; level-- > 0;) {
+					const unsigned int digit = static_cast<unsigned int>(block >> (dims * level)) & ((1u << dims) - 1);
+					converted |= (size_t)hilbertStep(dims, state, digit, to_hilbert) << (dims * level);
+				}
+				size_t next = 0;
+				while (states[next].e != state.e || states[next].d != state.d) { next++; }
+				table[s * blocks + block] = (uint_fast16_t)(converted | (next << block_bits));
+			}
+		}
+
+		if (print_table) {
+			std::cout << (to_hilbert ? "Morton to Hilbert Table \n" : "Hilbert to Morton Table \n");
+			printTable<uint_fast16_t>(table, total, 16);
+		}
+	}
 }
@@ -155,4 +155,792 @@ inline bool check2D_EncodeDecodeMatch(std::vector<encode_f_2D_wrapper<morton, co
 	}
 	ok ? printPassed() : printFailed();
 	return ok;
-}
\ No newline at end of file
+}
+
+// Check a 2D batch encode function against the scalar Magicbits method
+// Runs over all batch sizes up to 64 to hit every remainder, with random coordinates
+template <typename morton, typename coord, size_t bits>
+inline bool check2D_EncodeBatchCorrectness(void(*batch)(const coord*, const coord*, morton*, size_t)) {
+	printf("++ Checking correctness of 2D batch encoding (%zu bit) ... ", bits);
+	bool ok = true;
+	std::vector<coord> x(64), y(64);
+	std::vector<morton> result(64);
+	for (size_t n = 0; n <= 64; n++) {
+		for (size_t i = 0; i < n; i++) {
+			x[i] = static_cast<coord>((static_cast<uint32_t>(rand()) << 16) ^ static_cast<uint32_t>(rand()));
+			y[i] = static_cast<coord>((static_cast<uint32_t>(rand()) << 16) ^ static_cast<uint32_t>(rand()));
+		}
+		batch(x.data(), y.data(), result.data(), n);
+		for (size_t i = 0; i < n; i++) {
+			morton correct = libmorton::m2D_e_magicbits<morton, coord>(x[i], y[i]);
+			if (result[i] != correct) {
+				std::cout << "\n    Incorrect batch encoding of (" << x[i] << ", " << y[i] << ") at index " << i << " of " << n << ": "
+					<< result[i] << " != " << correct << "\n";
+				ok = false;
+			}
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check a 2D batch decode function against the scalar Magicbits method
+template <typename morton, typename coord, size_t bits>
+inline bool check2D_DecodeBatchCorrectness(void(*batch)(const morton*, coord*, coord*, size_t)) {
+	printf("++ Checking correctness of 2D batch decoding (%zu bit) ... ", bits);
+	bool ok = true;
+	std::vector<morton> m(64);
+	std::vector<coord> x(64), y(64);
+	for (size_t n = 0; n <= 64; n++) {
+		for (size_t i = 0; i < n; i++) {
+			m[i] = static_cast<morton>((static_cast<uint64_t>(rand()) << 42) ^ (static_cast<uint64_t>(rand()) << 21) ^ static_cast<uint64_t>(rand()));
+		}
+		batch(m.data(), x.data(), y.data(), n);
+		for (size_t i = 0; i < n; i++) {
+			coord correct_x, correct_y;
+			libmorton::m2D_d_magicbits<morton, coord>(m[i], correct_x, correct_y);
+			if (x[i] != correct_x || y[i] != correct_y) {
+				printIncorrectDecoding2D<morton, coord>("batch", m[i], x[i], y[i], correct_x, correct_y);
+				ok = false;
+			}
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check a 2D strided encode function against the scalar Magicbits method
+// Records of the given stride are filled with random bytes, the buffer is sized exactly so reads past the last record would be caught by sanitizers
+template <typename morton, typename coord, size_t bits>
+inline bool check2D_EncodeStridedCorrectness(void(*strided)(const void*, size_t, size_t, size_t, morton*, size_t),
+	size_t stride, size_t offx, size_t offy) {
+	printf("++ Checking correctness of 2D strided encoding (%zu bit, stride %zu, offsets %zu/%zu) ... ", bits, stride, offx, offy);
+	bool ok = true;
+	std::vector<morton> result(64);
+	for (size_t n = 0; n <= 64; n++) {
+		std::vector<unsigned char> records(n * stride);
+		for (size_t i = 0; i < records.size(); i++) {
+			records[i] = static_cast<unsigned char>(rand());
+		}
+		strided(records.data(), stride, offx, offy, result.data(), n);
+		for (size_t i = 0; i < n; i++) {
+			const unsigned char* record = records.data() + i * stride;
+			const coord x = libmorton::loadCoord<coord>(record + offx);
+			const coord y = libmorton::loadCoord<coord>(record + offy);
+			morton correct = libmorton::m2D_e_magicbits<morton, coord>(x, y);
+			if (result[i] != correct) {
+				std::cout << "\n    Incorrect strided encoding of (" << x << ", " << y << ") at index " << i << " of " << n << ": "
+					<< result[i] << " != " << correct << "\n";
+				ok = false;
+			}
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check the 2D signed coordinate methods of morton.h: a code is the Magicbits code of the coordinates plus 2^(fieldbits - 1),
+// codes keep the order of the coordinates on an axis across 0, and the batch methods (over more than one block) agree
+template <typename morton, typename scoord, size_t bits>
+inline bool check2D_SignedCorrectness(morton(*encode)(scoord, scoord), void(*decode)(morton, scoord&, scoord&),
+	void(*encode_batch)(const scoord*, const scoord*, morton*, size_t), void(*decode_batch)(const morton*, scoord*, scoord*, size_t)) {
+	printf("++ Checking correctness of 2D signed coordinates (%zd bit) ... ", bits);
+	const int64_t half = 1LL << (bits / 2 - 1);
+	const size_t n = 3000;
+	std::vector<scoord> c[2], d[2];
+	std::vector<morton> codes(n);
+	for (unsigned int axis = 0; axis < 2; axis++) {
+		c[axis].resize(n);
+		d[axis].resize(n);
+		for (size_t i = 0; i < n; i++) {
+			// mix in the edges of the range and the coordinates around 0
+			const int64_t edges[4] = { -half, half - 1, -1, 0 };
+			const int64_t r = static_cast<int64_t>((static_cast<uint64_t>(rand()) << 32) ^ (static_cast<uint64_t>(rand()) << 16) ^ rand()) % (2 * half) - half;
+			c[axis][i] = static_cast<scoord>((rand() % 5 == 0) ? edges[rand() % 4] : r);
+		}
+	}
+	encode_batch(c[0].data(), c[1].data(), codes.data(), n);
+	decode_batch(codes.data(), d[0].data(), d[1].data(), n);
+	bool ok = true;
+	for (size_t i = 0; i < n; i++) {
+		const scoord x = c[0][i], y = c[1][i];
+		const morton correct = libmorton::m2D_e_magicbits<morton, uint64_t>(static_cast<uint64_t>(x + half), static_cast<uint64_t>(y + half));
+		scoord dx, dy;
+		decode(correct, dx, dy);
+		if (encode(x, y) != correct || codes[i] != correct || dx != x || dy != y || d[0][i] != x || d[1][i] != y) {
+			std::cout << "\n    Incorrect signed encoding/decoding of (" << x << ", " << y << "): " << encode(x, y) << ", batch " << codes[i]
+				<< " != " << correct << ", decoded (" << dx << ", " << dy << ")\n";
+			ok = false;
+		}
+		// on one axis, the order of the codes is the order of the coordinates
+		const scoord py = c[1][(i + n - 1) % n];
+		if ((encode(x, py) < correct) != (py < y)) {
+			std::cout << "\n    Signed codes of y = " << py << " and " << y << " are out of order\n";
+			ok = false;
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check the 2D dilated arithmetic methods against decoding, changing the coordinates and encoding again
+template <typename morton, typename coord, size_t bits>
+inline bool check2D_ArithmeticCorrectness() {
+	printf("++ Checking correctness of 2D dilated arithmetic (%zu bit) ... ", bits);
+	const size_t fieldbits = bits / 2;
+	const uint64_t fieldmask = (fieldbits == 64) ? ~0ULL : (1ULL << fieldbits) - 1;
+	bool ok = true;
+	for (unsigned int i = 0; i < 10000; i++) {
+		coord c[2], d[2];
+		for (unsigned int axis = 0; axis < 2; axis++) {
+			// mix in the edges of the range, to check the wrap around
+			c[axis] = static_cast<coord>((i % 7 == 0) ? fieldmask : (static_cast<uint64_t>(rand()) << 16 ^ rand()) & fieldmask);
+			d[axis] = static_cast<coord>((i % 5 == 0) ? 0 : (static_cast<uint64_t>(rand()) << 16 ^ rand()) & fieldmask);
+		}
+		const morton m = libmorton::m2D_e_magicbits<morton, coord>(c[0], c[1]);
+		const morton dm = libmorton::m2D_e_magicbits<morton, coord>(d[0], d[1]);
+		morton (*const add[2])(const morton, const morton) = { &libmorton::m2D_add_x<morton>, &libmorton::m2D_add_y<morton> };
+		morton (*const sub[2])(const morton, const morton) = { &libmorton::m2D_sub_x<morton>, &libmorton::m2D_sub_y<morton> };
+		morton (*const inc[2])(const morton) = { &libmorton::m2D_inc_x<morton>, &libmorton::m2D_inc_y<morton> };
+		morton (*const dec[2])(const morton) = { &libmorton::m2D_dec_x<morton>, &libmorton::m2D_dec_y<morton> };
+		coord sum[2], diff[2];
+		for (unsigned int axis = 0; axis < 2; axis++) {
+			sum[axis] = static_cast<coord>((c[axis] + d[axis]) & fieldmask);
+			diff[axis] = static_cast<coord>((c[axis] - d[axis]) & fieldmask);
+			// expected results when only this axis changes
+			coord e[4][2];
+			for (unsigned int k = 0; k < 4; k++) {
+				e[k][0] = c[0];
+				e[k][1] = c[1];
+			}
+			e[0][axis] = sum[axis];
+			e[1][axis] = diff[axis];
+			e[2][axis] = static_cast<coord>((c[axis] + 1) & fieldmask);
+			e[3][axis] = static_cast<coord>((c[axis] - 1) & fieldmask);
+			const morton results[4] = { add[axis](m, dm), sub[axis](m, dm), inc[axis](m), dec[axis](m) };
+			for (unsigned int k = 0; k < 4; k++) {
+				const morton correct = libmorton::m2D_e_magicbits<morton, coord>(e[k][0], e[k][1]);
+				if (results[k] != correct) {
+					std::cout << "\n    Incorrect " << (k == 0 ? "add" : k == 1 ? "sub" : k == 2 ? "inc" : "dec") << " on axis " << axis
+						<< " of (" << c[0] << ", " << c[1] << "): " << results[k] << " != " << correct << "\n";
+					ok = false;
+				}
+			}
+		}
+		if (libmorton::m2D_add<morton>(m, dm) != libmorton::m2D_e_magicbits<morton, coord>(sum[0], sum[1])
+			|| libmorton::m2D_sub<morton>(m, dm) != libmorton::m2D_e_magicbits<morton, coord>(diff[0], diff[1])) {
+			std::cout << "\n    Incorrect full add/sub of (" << c[0] << ", " << c[1] << ") and (" << d[0] << ", " << d[1] << ")\n";
+			ok = false;
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check a 2D neighbour function against decoding, moving the coordinates and encoding again
+// Runs every connectivity and boundary policy on a few grid levels, with cells on the boundaries mixed in
+template <typename morton, typename coord, size_t bits>
+inline bool check2D_NeighboursCorrectness(size_t(*neighbours)(const morton*, morton*, size_t, unsigned int, unsigned int, libmorton::morton_boundary)) {
+	printf("++ Checking correctness of 2D neighbours (%zu bit) ... ", bits);
+	const unsigned int fieldbits = bits / 2;
+	const unsigned int levels[4] = { 0, 1, 4, fieldbits };
+	const unsigned int connectivities[2] = { 4, 8 };
+	const libmorton::morton_boundary boundaries[3] = { libmorton::morton_boundary::clamp, libmorton::morton_boundary::wrap, libmorton::morton_boundary::invalid };
+	bool ok = true;
+	std::vector<morton> m(37), result(37 * 8);
+	for (unsigned int l = 0; l < 4; l++) {
+		const uint64_t maxcoord = (levels[l] == 64) ? ~0ULL : (1ULL << levels[l]) - 1;
+		for (size_t i = 0; i < m.size(); i++) {
+			coord c[2];
+			for (unsigned int axis = 0; axis < 2; axis++) {
+				const unsigned int pick = static_cast<unsigned int>(rand()) % 4;
+				c[axis] = static_cast<coord>((pick == 0) ? 0 : ((pick == 1) ? maxcoord : (((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord)));
+			}
+			m[i] = libmorton::m2D_e_magicbits<morton, coord>(c[0], c[1]);
+		}
+		for (unsigned int k = 0; k < 2; k++) {
+			for (unsigned int b = 0; b < 3; b++) {
+				unsigned char offsets[26][3];
+				const unsigned int count = libmorton::mortonNeighbourOffsets(2, connectivities[k], offsets);
+				if (levels[l] == fieldbits && boundaries[b] == libmorton::morton_boundary::invalid) {
+					// all bits set is the code of the corner cell (maxcoord, maxcoord) here, so invalid is rejected
+					std::fill(result.begin(), result.end(), static_cast<morton>(0));
+					if (neighbours(m.data(), result.data(), m.size(), levels[l], connectivities[k], boundaries[b]) != 0
+						|| std::count(result.begin(), result.end(), static_cast<morton>(0)) != static_cast<std::ptrdiff_t>(result.size())) {
+						std::cout << "\n    Invalid boundary accepted at the full width, connectivity " << connectivities[k] << "\n";
+						ok = false;
+					}
+					continue;
+				}
+				if (neighbours(m.data(), result.data(), m.size(), levels[l], connectivities[k], boundaries[b]) != count || count != connectivities[k]) {
+					std::cout << "\n    Wrong neighbour count for connectivity " << connectivities[k] << "\n";
+					ok = false;
+					continue;
+				}
+				for (size_t i = 0; i < m.size(); i++) {
+					coord c[2];
+					libmorton::m2D_d_magicbits<morton, coord>(m[i], c[0], c[1]);
+					for (unsigned int j = 0; j < count; j++) {
+						bool outside = false;
+						coord nc[2];
+						for (unsigned int axis = 0; axis < 2; axis++) {
+							const int64_t v = static_cast<int64_t>(c[axis]) + offsets[j][axis] - 1;
+							if (v < 0 || v > static_cast<int64_t>(maxcoord)) {
+								outside = true;
+								nc[axis] = static_cast<coord>((boundaries[b] == libmorton::morton_boundary::clamp) ? c[axis] : (v < 0 ? maxcoord : 0));
+							}
+							else {
+								nc[axis] = static_cast<coord>(v);
+							}
+						}
+						const morton correct = (outside && boundaries[b] == libmorton::morton_boundary::invalid) ? libmorton::mortonInvalid<morton>() : libmorton::m2D_e_magicbits<morton, coord>(nc[0], nc[1]);
+						if (result[i * count + j] != correct) {
+							std::cout << "\n    Incorrect neighbour " << j << " of (" << c[0] << ", " << c[1] << ") at level " << levels[l]
+								<< ", connectivity " << connectivities[k] << ", boundary " << b << ": " << result[i * count + j] << " != " << correct << "\n";
+							ok = false;
+						}
+					}
+				}
+			}
+		}
+	}
+	// one level below the full width, the outside neighbours of the corner cell are invalid and its inside ones aren't
+	const uint64_t top = (1ULL << (fieldbits - 1)) - 1;
+	m[0] = libmorton::m2D_e_magicbits<morton, coord>(static_cast<coord>(top), static_cast<coord>(top));
+	if (neighbours(m.data(), result.data(), 1, fieldbits - 1, 8, libmorton::morton_boundary::invalid) != 8
+		|| std::count(result.begin(), result.begin() + 8, libmorton::mortonInvalid<morton>()) != 5) {
+		std::cout << "\n    Incorrect invalid neighbours of the corner cell at level " << fieldbits - 1 << "\n";
+		ok = false;
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check 2D BIGMIN / LITMAX and box scans against the sorted codes of every cell in random boxes
+// The boxes are small, but placed anywhere in the coordinate range so the high bits get used as well
+template <typename morton, typename coord, size_t bits>
+inline bool check2D_BoxQueryCorrectness() {
+	printf("++ Checking correctness of 2D box queries (%zu bit) ... ", bits);
+	const unsigned int fieldbits = bits / 2;
+	const uint64_t maxcoord = (fieldbits == 64) ? ~0ULL : (1ULL << fieldbits) - 1;
+	bool ok = true;
+	for (unsigned int t = 0; t < 200; t++) {
+		// a box of up to 16 cells per axis, and a region of up to 48 cells per axis around it (below maxcoord, so the loops end)
+		coord lo[2], hi[2], rlo[2], rhi[2];
+		for (unsigned int axis = 0; axis < 2; axis++) {
+			const uint64_t base = (t % 4 == 0) ? 0 : (((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord);
+			rlo[axis] = static_cast<coord>(std::min<uint64_t>(base, maxcoord - 48));
+			lo[axis] = static_cast<coord>(rlo[axis] + rand() % 32);
+			hi[axis] = static_cast<coord>(lo[axis] + rand() % 16);
+			rhi[axis] = static_cast<coord>(rlo[axis] + 47);
+		}
+		const morton zmin = libmorton::m2D_e_magicbits<morton, coord>(lo[0], lo[1]);
+		const morton zmax = libmorton::m2D_e_magicbits<morton, coord>(hi[0], hi[1]);
+		std::vector<morton> inside, keys;
+		for (coord y = rlo[1]; y <= rhi[1]; y++) {
+			for (coord x = rlo[0]; x <= rhi[0]; x++) {
+				const morton m = libmorton::m2D_e_magicbits<morton, coord>(x, y);
+				const bool in = x >= lo[0] && x <= hi[0] && y >= lo[1] && y <= hi[1];
+				if (in) { inside.push_back(m); }
+				if (in || rand() % 4 == 0) { keys.push_back(m); }
+				ok &= (libmorton::m2D_in_box<morton>(m, zmin, zmax) == in);
+			}
+		}
+		std::sort(inside.begin(), inside.end());
+		std::sort(keys.begin(), keys.end());
+		for (size_t i = 0; i < keys.size(); i++) {
+			const morton zcur = keys[i];
+			if (zcur < zmax) {
+				const morton correct = *std::upper_bound(inside.begin(), inside.end(), zcur);
+				if (libmorton::m2D_bigmin<morton>(zcur, zmin, zmax) != correct) {
+					std::cout << "\n    Incorrect BIGMIN of " << zcur << " in box [" << zmin << ", " << zmax << "]\n";
+					ok = false;
+				}
+			}
+			if (zcur > zmin) {
+				const morton correct = *(std::lower_bound(inside.begin(), inside.end(), zcur) - 1);
+				if (libmorton::m2D_litmax<morton>(zcur, zmin, zmax) != correct) {
+					std::cout << "\n    Incorrect LITMAX of " << zcur << " in box [" << zmin << ", " << zmax << "]\n";
+					ok = false;
+				}
+			}
+		}
+		// every key inside the box is visited exactly once, in order, in runs that don't touch each other
+		std::vector<morton> visited;
+		size_t last_end = 0;
+		const size_t hits = libmorton::m2D_box_scan<morton>(keys.data(), keys.size(), zmin, zmax, [&](size_t begin, size_t end) {
+			ok &= (begin < end) && (visited.empty() || begin > last_end);
+			for (size_t i = begin; i < end; i++) { visited.push_back(keys[i]); }
+			last_end = end;
+		});
+		if (hits != inside.size() || visited != inside) {
+			std::cout << "\n    Incorrect box scan of box [" << zmin << ", " << zmax << "]: " << hits << " hits, expected " << inside.size() << "\n";
+			ok = false;
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check 2D box interval decomposition against the codes of every cell in random boxes
+// Exact decompositions must cover exactly the box with maximal runs, budgeted ones must cover it within the budget
+template <typename morton, typename coord, size_t bits>
+inline bool check2D_BoxIntervalsCorrectness() {
+	printf("++ Checking correctness of 2D box intervals (%zu bit) ... ", bits);
+	const unsigned int fieldbits = bits / 2;
+	const uint64_t maxcoord = (fieldbits == 64) ? ~0ULL : (1ULL << fieldbits) - 1;
+	const size_t budgets[4] = { 0, 1, 4, 16 };
+	bool ok = true;
+	std::vector<libmorton::morton_interval<morton> > intervals;
+	for (unsigned int t = 0; t < 200; t++) {
+		// a box of up to 16 cells per axis anywhere in the coordinate range
+		coord lo[2], hi[2];
+		for (unsigned int axis = 0; axis < 2; axis++) {
+			const uint64_t base = (t % 4 == 0) ? 0 : (((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord);
+			lo[axis] = static_cast<coord>(std::min<uint64_t>(base, maxcoord - 16));
+			hi[axis] = static_cast<coord>(lo[axis] + rand() % 16);
+		}
+		const morton zmin = libmorton::m2D_e_magicbits<morton, coord>(lo[0], lo[1]);
+		const morton zmax = libmorton::m2D_e_magicbits<morton, coord>(hi[0], hi[1]);
+		std::vector<morton> inside;
+		for (coord y = lo[1]; y <= hi[1]; y++) {
+			for (coord x = lo[0]; x <= hi[0]; x++) {
+				inside.push_back(libmorton::m2D_e_magicbits<morton, coord>(x, y));
+			}
+		}
+		std::sort(inside.begin(), inside.end());
+		for (unsigned int b = 0; b < 4; b++) {
+			const size_t count = libmorton::m2D_box_intervals<morton>(zmin, zmax, budgets[b], intervals);
+			bool good = (count == intervals.size()) && (budgets[b] == 0 || count <= budgets[b]);
+			uint64_t covered = 0;
+			for (size_t i = 0; i < intervals.size(); i++) {
+				// sorted, with both ends inside the box, and (when exact) not touching the next interval
+				good &= intervals[i].lo <= intervals[i].hi;
+				good &= libmorton::m2D_in_box<morton>(intervals[i].lo, zmin, zmax) && libmorton::m2D_in_box<morton>(intervals[i].hi, zmin, zmax);
+				if (i > 0) { good &= intervals[i - 1].hi < intervals[i].lo && (budgets[b] != 0 || intervals[i - 1].hi + 1 < intervals[i].lo); }
+				covered += static_cast<uint64_t>(intervals[i].hi - intervals[i].lo) + 1;
+			}
+			// every code inside the box is covered
+			size_t k = 0;
+			for (size_t i = 0; i < inside.size() && good; i++) {
+				while (k < intervals.size() && intervals[k].hi < inside[i]) { k++; }
+				good &= k < intervals.size() && intervals[k].lo <= inside[i];
+			}
+			if (budgets[b] == 0) { good &= (covered == inside.size()); }
+			if (!good) {
+				std::cout << "\n    Incorrect decomposition of box [" << zmin << ", " << zmax << "] with budget " << budgets[b] << ": " << count << " intervals\n";
+				ok = false;
+			}
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check the parallel encoder/decoder on several thread counts and executors (one running the chunks backwards on the calling thread)
+// against the scalar Magicbits method. The size isn't a multiple of the chunk size, so the last chunk is a partial one.
+template <typename morton, typename coord, size_t bits>
+inline bool check2D_ParallelCorrectness() {
+	printf("++ Checking correctness of parallel 2D encoding/decoding (%zu bit) ... ", bits);
+	const size_t n = 5 * libmorton::parallel_detail::chunk_size + 123;
+	const unsigned int threads[3] = { 1, 3, 0 };
+	const libmorton::morton_executor executors[2] = { libmorton::default_executor(2),
+		[](size_t count, const std::function<void(size_t)>& task) { for (size_t i = count; i > 0; i--) { task(i - 1); } } };
+	bool ok = true;
+	std::vector<coord> x(n), y(n), dx(n), dy(n);
+	std::vector<morton> m(n);
+	for (unsigned int run = 0; run < 5; run++) {
+		for (size_t i = 0; i < n; i++) {
+			x[i] = static_cast<coord>((static_cast<uint64_t>(rand()) << 16) ^ rand());
+			y[i] = static_cast<coord>((static_cast<uint64_t>(rand()) << 16) ^ rand());
+		}
+		if (run < 3) {
+			libmorton::parallel_encode2D(x.data(), y.data(), m.data(), n, threads[run]);
+			libmorton::parallel_decode2D(m.data(), dx.data(), dy.data(), n, threads[run]);
+		}
+		else {
+			libmorton::parallel_encode2D(x.data(), y.data(), m.data(), n, executors[run - 3]);
+			libmorton::parallel_decode2D(m.data(), dx.data(), dy.data(), n, executors[run - 3]);
+		}
+		for (size_t i = 0; i < n; i++) {
+			const morton correct = libmorton::m2D_e_magicbits<morton, coord>(x[i], y[i]);
+			if (m[i] != correct) {
+				std::cout << "\n    Incorrect parallel encoding of (" << x[i] << ", " << y[i] << ") at index " << i << ": " << m[i] << " != " << correct << "\n";
+				ok = false;
+				break;
+			}
+			if (dx[i] != x[i] || dy[i] != y[i]) {
+				printIncorrectDecoding2D<morton, coord>("parallel", m[i], dx[i], dy[i], x[i], y[i]);
+				ok = false;
+				break;
+			}
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Control 2D Hilbert encoder: one level at a time with the state machine of the LUT generator
+inline uint64_t control_hilbert_encode(unsigned int levels, uint64_t x, uint64_t y) {
+	libmorton::hilbert_state state = { 0, 0 };
+	uint64_t h = 0;
+	for (unsigned int level = levels; level-- > 0;) {
+		const unsigned int digit = static_cast<unsigned int>(((x >> level) & 1) | (((y >> level) & 1) << 1));
+		h = (h << 2) | libmorton::hilbertStep(2, state, digit, true);
+	}
+	return h;
+}
+
+// Check the 2D Hilbert encoder/decoder against the control encoder, the curve for continuity (consecutive codes are
+// neighbouring cells) and the batch methods against the scalar ones. The batch size isn't a multiple of the block size.
+template <typename morton, typename coord, size_t bits, typename batch_morton, typename batch_coord>
+inline bool check2D_HilbertCorrectness(morton(*encode)(coord, coord), void(*decode)(morton, coord&, coord&),
+	void(*encode_batch)(const batch_coord*, const batch_coord*, batch_morton*, size_t), void(*decode_batch)(const batch_morton*, batch_coord*, batch_coord*, size_t)) {
+	printf("++ Checking correctness of 2D Hilbert encoding/decoding (%zu bit) ... ", bits);
+	const unsigned int levels = bits / 2;
+	const uint64_t maxcoord = (1ULL << levels) - 1;
+	const uint64_t maxcode = (levels == 32) ? ~0ULL : (1ULL << (2 * levels)) - 1;
+	bool ok = true;
+	// the curve starts at the origin and ends in the corner on the x axis
+	coord x, y;
+	decode(0, x, y);
+	ok &= (x == 0 && y == 0);
+	decode(static_cast<morton>(maxcode), x, y);
+	ok &= (x == maxcoord && y == 0);
+	if (!ok) { std::cout << "\n    Incorrect start or end of the curve\n"; }
+	for (unsigned int i = 0; i < 1000 && ok; i++) {
+		const coord px = static_cast<coord>(((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord);
+		const coord py = static_cast<coord>(((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord);
+		const morton h = encode(px, py);
+		const uint64_t correct = control_hilbert_encode(levels, px, py);
+		if (h != correct) {
+			std::cout << "\n    Incorrect Hilbert encoding of (" << px << ", " << py << "): " << h << " != " << correct << "\n";
+			ok = false;
+		}
+		decode(h, x, y);
+		if (x != px || y != py) {
+			printIncorrectDecoding2D<morton, coord>("Hilbert", h, x, y, px, py);
+			ok = false;
+		}
+		// a stretch of the curve from a random code
+		uint64_t start = ((static_cast<uint64_t>(rand()) << 48) ^ (static_cast<uint64_t>(rand()) << 32) ^ (static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcode;
+		start = std::min<uint64_t>(start, maxcode - 16);
+		decode(static_cast<morton>(start), x, y);
+		for (uint64_t c = start + 1; c <= start + 16 && ok; c++) {
+			coord nx, ny;
+			decode(static_cast<morton>(c), nx, ny);
+			const uint64_t distance = ((nx > x) ? nx - x : x - nx) + ((ny > y) ? ny - y : y - ny);
+			if (distance != 1) {
+				std::cout << "\n    Hilbert codes " << (c - 1) << " and " << c << " aren't neighbouring cells\n";
+				ok = false;
+			}
+			x = nx;
+			y = ny;
+		}
+	}
+	const size_t n = 3000;
+	std::vector<batch_coord> bx(n), by(n), dx(n), dy(n);
+	std::vector<batch_morton> h(n);
+	for (size_t i = 0; i < n; i++) {
+		bx[i] = static_cast<batch_coord>(((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord);
+		by[i] = static_cast<batch_coord>(((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord);
+	}
+	encode_batch(bx.data(), by.data(), h.data(), n);
+	decode_batch(h.data(), dx.data(), dy.data(), n);
+	for (size_t i = 0; i < n && ok; i++) {
+		if (h[i] != encode(bx[i], by[i]) || dx[i] != bx[i] || dy[i] != by[i]) {
+			std::cout << "\n    Incorrect Hilbert batch encoding/decoding of (" << bx[i] << ", " << by[i] << ") at index " << i << "\n";
+			ok = false;
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check the 2D Morton-ordered grid: coordinate access against the array position of the encoded cell, and both
+// iteration orders against a plain Cartesian loop (the Cartesian iterator has to keep its code in step with its coordinates)
+inline bool check2D_GridCorrectness() {
+	printf("++ Checking correctness of 2D Morton-ordered grids ... ");
+	bool ok = true;
+	for (unsigned int level = 0; level <= 8 && ok; level++) {
+		libmorton::morton_grid<uint32_t, 2> grid(level, 7);
+		const uint_fast32_t extent = grid.extent();
+		ok &= (grid.size() == static_cast<size_t>(extent) * extent) && grid(extent - 1, extent - 1) == 7;
+		uint32_t value = 0;
+		for (uint_fast32_t y = 0; y < extent; y++) {
+			for (uint_fast32_t x = 0; x < extent; x++) {
+				grid(x, y) = value;
+				ok &= (grid[libmorton::m2D_e_magicbits<uint_fast64_t, uint_fast32_t>(x, y)] == value);
+				value++;
+			}
+		}
+		// Morton order: the array, every code once
+		std::vector<bool> seen(grid.size(), false);
+		size_t count = 0;
+		for (libmorton::morton_grid<uint32_t, 2>::iterator it = grid.begin(); it != grid.end(); ++it, ++count) {
+			ok &= (*it < seen.size()) && !seen[*it];
+			if (*it < seen.size()) { seen[*it] = true; }
+		}
+		ok &= (count == grid.size());
+		// Cartesian order: the values come out in the order they were written
+		value = 0;
+		for (libmorton::morton_grid<uint32_t, 2>::cartesian_iterator it = grid.cartesian_begin(); it != grid.cartesian_end() && ok; ++it, ++value) {
+			const uint_fast32_t x = value % extent, y = value / extent;
+			ok &= (*it == value) && it.x() == x && it.y() == y && it.code() == libmorton::morton_grid<uint32_t, 2>::code(x, y);
+		}
+		ok &= (value == grid.size());
+		if (!ok) { std::cout << "\n    Incorrect grid of level " << level << "\n"; }
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check the constexpr encoders and decode helpers: a static table of codes computed at compile time by every encoder,
+// checked against the control encoder and decoded again at run time
+template <typename morton, typename coord, size_t bits>
+inline bool check2D_ConstexprCorrectness() {
+	printf("++ Checking correctness of 2D compile time encode/decode (%zd bit) ... ", bits);
+	static constexpr coord top = static_cast<coord>((static_cast<uint_fast64_t>(1) << (bits / 2)) - 1);
+	static constexpr coord points[4][2] = { { 0, 0 }, { 1, 2 }, { top, top / 2 }, { top, top } };
+	static constexpr morton table[4][4] = {
+		{ libmorton::m2D_e_magicbits<morton, coord>(points[0][0], points[0][1]), libmorton::m2D_e_for<morton, coord>(points[0][0], points[0][1]),
+			libmorton::m2D_e_sLUT<morton, coord>(points[0][0], points[0][1]), libmorton::m2D_e_LUT<morton, coord>(points[0][0], points[0][1]) },
+		{ libmorton::m2D_e_magicbits<morton, coord>(points[1][0], points[1][1]), libmorton::m2D_e_for<morton, coord>(points[1][0], points[1][1]),
+			libmorton::m2D_e_sLUT<morton, coord>(points[1][0], points[1][1]), libmorton::m2D_e_LUT<morton, coord>(points[1][0], points[1][1]) },
+		{ libmorton::m2D_e_magicbits<morton, coord>(points[2][0], points[2][1]), libmorton::m2D_e_for<morton, coord>(points[2][0], points[2][1]),
+			libmorton::m2D_e_sLUT<morton, coord>(points[2][0], points[2][1]), libmorton::m2D_e_LUT<morton, coord>(points[2][0], points[2][1]) },
+		{ libmorton::m2D_e_magicbits<morton, coord>(points[3][0], points[3][1]), libmorton::m2D_e_for<morton, coord>(points[3][0], points[3][1]),
+			libmorton::m2D_e_sLUT<morton, coord>(points[3][0], points[3][1]), libmorton::m2D_e_LUT<morton, coord>(points[3][0], points[3][1]) }
+	};
+	static_assert(table[1][0] == 0x9 && table[1][1] == 0x9 && table[1][2] == 0x9 && table[1][3] == 0x9, "compile time encode of (1, 2)");
+	static_assert(libmorton::morton2D_GetSecondBits<morton, coord>(table[2][0] >> 1) == top / 2, "compile time magic bits decode");
+	static_assert(libmorton::morton2D_DecodeCoord_for<morton, coord>(table[3][0], 1) == top, "compile time for loop decode");
+	static_assert(libmorton::morton2D_DecodeCoord_LUT256<morton, coord>(table[2][0], libmorton::Morton2D_decode_y_256, 0) == top / 2, "compile time LUT decode");
+	bool ok = true;
+	for (unsigned int i = 0; i < 4; i++) {
+		const morton correct = static_cast<morton>(control_encode(static_cast<uint64_t>(points[i][0]), static_cast<uint64_t>(points[i][1])));
+		for (unsigned int method = 0; method < 4; method++) { ok &= (table[i][method] == correct); }
+		coord x, y;
+		libmorton::m2D_d_magicbits<morton, coord>(correct, x, y);
+		ok &= (x == points[i][0] && y == points[i][1]);
+		libmorton::m2D_d_for<morton, coord>(correct, x, y);
+		ok &= (x == points[i][0] && y == points[i][1]);
+		if (!ok) { std::cout << "\n    Incorrect compile time code of (" << points[i][0] << ", " << points[i][1] << ")\n"; break; }
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Exact-width morton.h functions, by code type
+inline uint32_t exact2D_encode(const uint16_t x, const uint16_t y) { return libmorton::exact::morton2D_32_encode(x, y); }
+inline uint64_t exact2D_encode(const uint32_t x, const uint32_t y) { return libmorton::exact::morton2D_64_encode(x, y); }
+inline void exact2D_decode(const uint32_t m, uint16_t& x, uint16_t& y) { libmorton::exact::morton2D_32_decode(m, x, y); }
+inline void exact2D_decode(const uint64_t m, uint32_t& x, uint32_t& y) { libmorton::exact::morton2D_64_decode(m, x, y); }
+
+// Check the exact-width types (uint32_t codes of uint16_t coordinates, uint64_t codes of uint32_t coordinates): the exact
+// morton.h functions and the LUT, magic bits and for loop methods against the control encoder, and the size of the LUTs
+template <typename morton, typename coord, size_t bits>
+inline bool check2D_ExactWidthCorrectness() {
+	printf("++ Checking correctness of 2D exact-width encode/decode (%zd bit) ... ", bits);
+	static_assert(sizeof(libmorton::Morton2D_encode_x_256) == 256 * sizeof(uint16_t) && sizeof(libmorton::Morton2D_decode_x_256) == 256, "LUTs in the narrowest type that fits");
+	const uint64_t fieldmask = (1ULL << (bits / 2)) - 1;
+	bool ok = true;
+	for (unsigned int i = 0; i < 10000 && ok; i++) {
+		// mix in the edges of the range
+		const coord x = static_cast<coord>(((i % 7 == 0) ? ~0ULL : static_cast<uint64_t>(rand()) << 16 ^ rand()) & fieldmask);
+		const coord y = static_cast<coord>(((i % 7 == 1) ? ~0ULL : static_cast<uint64_t>(rand()) << 16 ^ rand()) & fieldmask);
+		const morton correct = static_cast<morton>(control_encode(static_cast<uint64_t>(x), static_cast<uint64_t>(y)));
+		const morton codes[7] = { exact2D_encode(x, y),
+			libmorton::m2D_e_sLUT<morton, coord>(x, y),
+			libmorton::m2D_e_LUT<morton, coord>(x, y),
+			libmorton::m2D_e_sLUT_ET<morton, coord>(x, y),
+			libmorton::m2D_e_LUT_ET<morton, coord>(x, y),
+			libmorton::m2D_e_magicbits<morton, coord>(x, y),
+			libmorton::m2D_e_for<morton, coord>(x, y) };
+		coord d[7][2];
+		exact2D_decode(correct, d[0][0], d[0][1]);
+		libmorton::m2D_d_sLUT<morton, coord>(correct, d[1][0], d[1][1]);
+		libmorton::m2D_d_LUT<morton, coord>(correct, d[2][0], d[2][1]);
+		libmorton::m2D_d_sLUT_ET<morton, coord>(correct, d[3][0], d[3][1]);
+		libmorton::m2D_d_LUT_ET<morton, coord>(correct, d[4][0], d[4][1]);
+		libmorton::m2D_d_magicbits<morton, coord>(correct, d[5][0], d[5][1]);
+		libmorton::m2D_d_for<morton, coord>(correct, d[6][0], d[6][1]);
+		for (unsigned int j = 0; j < 7; j++) { ok &= (codes[j] == correct) && d[j][0] == x && d[j][1] == y; }
+		if (!ok) { std::cout << "\n    Incorrect exact-width encode/decode of code " << correct << "\n"; }
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check the 2D box iterator against the sorted codes of every cell in random boxes, one code at a time,
+// and in runs against the exact box intervals (the runs have to be the maximal runs of codes inside the box)
+template <typename morton, typename coord, size_t bits>
+inline bool check2D_BoxIteratorCorrectness() {
+	printf("++ Checking correctness of 2D box iterators (%zu bit) ... ", bits);
+	const unsigned int fieldbits = bits / 2;
+	const uint64_t maxcoord = (fieldbits == 64) ? ~0ULL : (1ULL << fieldbits) - 1;
+	bool ok = true;
+	std::vector<libmorton::morton_interval<morton> > intervals;
+	for (unsigned int t = 0; t < 200 && ok; t++) {
+		// a box of up to 16 cells per axis anywhere in the coordinate range
+		coord lo[2], hi[2];
+		for (unsigned int axis = 0; axis < 2; axis++) {
+			const uint64_t base = (t % 4 == 0) ? 0 : (((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord);
+			lo[axis] = static_cast<coord>(std::min<uint64_t>(base, maxcoord - 16));
+			hi[axis] = static_cast<coord>(lo[axis] + rand() % 16);
+		}
+		const morton zmin = libmorton::m2D_e_magicbits<morton, coord>(lo[0], lo[1]);
+		const morton zmax = libmorton::m2D_e_magicbits<morton, coord>(hi[0], hi[1]);
+		std::vector<morton> inside;
+		for (coord y = lo[1]; y <= hi[1]; y++) {
+			for (coord x = lo[0]; x <= hi[0]; x++) {
+				inside.push_back(libmorton::m2D_e_magicbits<morton, coord>(x, y));
+			}
+		}
+		std::sort(inside.begin(), inside.end());
+		libmorton::morton_box_iterator<morton> it = libmorton::m2D_box_iterator<morton>(zmin, zmax);
+		size_t k = 0;
+		for (; !it.done() && k < inside.size(); ++it, k++) { ok &= (*it == inside[k]); }
+		ok &= it.done() && k == inside.size();
+		libmorton::m2D_box_intervals<morton>(zmin, zmax, 0, intervals);
+		libmorton::morton_interval<morton> run = { 0, 0 };
+		it = libmorton::m2D_box_iterator<morton>(zmin, zmax);
+		k = 0;
+		for (; it.next_run(run) && k < intervals.size(); k++) { ok &= (run.lo == intervals[k].lo && run.hi == intervals[k].hi); }
+		ok &= it.done() && k == intervals.size();
+		if (!ok) { std::cout << "\n    Incorrect walk over box [" << zmin << ", " << zmax << "]\n"; }
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check the 2D hierarchy methods against shifting the coordinates: the parent, the children and the descendants of a cell,
+// and the level of the common ancestor of two codes (and the same cell predicate) against the coordinates they share
+template <typename morton, typename coord, size_t bits>
+inline bool check2D_HierarchyCorrectness() {
+	printf("++ Checking correctness of 2D hierarchy methods (%zu bit) ... ", bits);
+	const unsigned int fieldbits = bits / 2;
+	const uint64_t maxcoord = (1ULL << fieldbits) - 1;
+	bool ok = true;
+	const size_t n = 256;
+	std::vector<morton> a(n), b(n), batch(n);
+	std::vector<unsigned int> levels(n);
+	std::vector<libmorton::morton_interval<morton> > ranges(n);
+	bool same[n];
+	for (unsigned int t = 0; t < 20 && ok; t++) {
+		const unsigned int level = t % (fieldbits + 1);
+		const unsigned int depth = (t * 7) % (level + 1);
+		for (size_t i = 0; i < n && ok; i++) {
+			uint64_t p[2], q[2];
+			const unsigned int split = rand() % (fieldbits + 1);
+			for (unsigned int axis = 0; axis < 2; axis++) {
+				p[axis] = ((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord;
+				q[axis] = p[axis] ^ (((static_cast<uint64_t>(rand()) << 16) ^ rand()) & ((1ULL << split) - 1));
+			}
+			a[i] = libmorton::m2D_e_magicbits<morton, uint64_t>(p[0], p[1]);
+			b[i] = libmorton::m2D_e_magicbits<morton, uint64_t>(q[0], q[1]);
+			const morton cell = libmorton::m2D_e_magicbits<morton, uint64_t>(p[0] >> level, p[1] >> level);
+			ok &= libmorton::m2D_parent<morton>(a[i], level) == cell;
+			// a cell at level 0 has no children inside the coordinate range
+			ok &= level == 0 || libmorton::m2D_first_child<morton>(cell) == libmorton::m2D_e_magicbits<morton, uint64_t>((p[0] >> level) << 1, (p[1] >> level) << 1);
+			ok &= level == 0 || libmorton::m2D_last_child<morton>(cell) == libmorton::m2D_e_magicbits<morton, uint64_t>(((p[0] >> level) << 1) | 1, ((p[1] >> level) << 1) | 1);
+			const uint64_t low = (1ULL << depth) - 1;
+			const libmorton::morton_interval<morton> range = libmorton::m2D_descendants<morton>(cell, depth);
+			ok &= range.lo == libmorton::m2D_e_magicbits<morton, uint64_t>((p[0] >> level) << depth, (p[1] >> level) << depth);
+			ok &= range.hi == libmorton::m2D_e_magicbits<morton, uint64_t>(((p[0] >> level) << depth) | low, ((p[1] >> level) << depth) | low);
+			unsigned int common = 0;
+			while (((p[0] ^ q[0]) | (p[1] ^ q[1])) >> common) { common++; }
+			ok &= libmorton::m2D_common_ancestor_level<morton>(a[i], b[i]) == common;
+			ok &= libmorton::m2D_same_cell<morton>(a[i], b[i], level) == (level >= common);
+			if (!ok) { std::cout << "\n    Incorrect hierarchy of codes " << a[i] << " and " << b[i] << " at level " << level << "\n"; }
+		}
+		// the batch methods against the scalar ones, in place for the ones returning codes
+		libmorton::m2D_common_ancestor_level<morton>(a.data(), b.data(), levels.data(), n);
+		libmorton::m2D_same_cell<morton>(a.data(), b.data(), same, n, level);
+		for (size_t i = 0; i < n; i++) {
+			ok &= levels[i] == libmorton::m2D_common_ancestor_level<morton>(a[i], b[i]) && same[i] == libmorton::m2D_same_cell<morton>(a[i], b[i], level);
+		}
+		libmorton::m2D_parent<morton>(a.data(), batch.data(), n, level);
+		libmorton::m2D_descendants<morton>(batch.data(), ranges.data(), n, depth);
+		for (size_t i = 0; i < n; i++) {
+			const libmorton::morton_interval<morton> range = libmorton::m2D_descendants<morton>(libmorton::m2D_parent<morton>(a[i], level), depth);
+			ok &= batch[i] == libmorton::m2D_parent<morton>(a[i], level) && ranges[i].lo == range.lo && ranges[i].hi == range.hi;
+		}
+		libmorton::m2D_first_child<morton>(batch.data(), b.data(), n);
+		libmorton::m2D_last_child<morton>(batch.data(), batch.data(), n);
+		for (size_t i = 0; i < n; i++) {
+			const morton cell = libmorton::m2D_parent<morton>(a[i], level);
+			ok &= b[i] == libmorton::m2D_first_child<morton>(cell) && batch[i] == libmorton::m2D_last_child<morton>(cell);
+		}
+		if (!ok) { std::cout << "\n    Incorrect batch hierarchy methods at level " << level << "\n"; }
+	}
+	// levels past the top of the code
+	ok &= libmorton::m2D_parent<morton>(static_cast<morton>(~static_cast<morton>(0)), bits / 2 + 1) == 0;
+	ok &= libmorton::m2D_same_cell<morton>(0, static_cast<morton>(~static_cast<morton>(0)), bits / 2 + 1);
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check the 2D 128-bit methods against a bit by bit encoder, and decode what they encode. Also checks the dilated arithmetic
+// and the box iterator on 128-bit codes.
+inline bool check2D_128Correctness() {
+	printf("++ Checking correctness of 2D encode/decode (128 bit) ... ");
+	using libmorton::morton128_t;
+	typedef morton128_t(*encoder)(uint_fast64_t, uint_fast64_t);
+	typedef void(*decoder)(morton128_t, uint_fast64_t&, uint_fast64_t&);
+	std::vector<encoder> encoders = { &libmorton::morton2D_128_encode, &libmorton::m2D_e_magicbits_128, &libmorton::m2D_e_sLUT_128 };
+	std::vector<decoder> decoders = { &libmorton::morton2D_128_decode, &libmorton::m2D_d_magicbits_128, &libmorton::m2D_d_sLUT_128 };
+#if defined(__BMI2__) || defined(__AVX2__)
+	encoders.push_back(&libmorton::m2D_e_BMI_128);
+	decoders.push_back(&libmorton::m2D_d_BMI_128);
+#elif defined(LIBMORTON_RUNTIME_DISPATCH)
+	if (libmorton::dispatch_detail::detect_cpu_features().bmi2) {
+		encoders.push_back(&libmorton::m2D_e_BMI_128);
+		decoders.push_back(&libmorton::m2D_d_BMI_128);
+	}
+#endif
+	const auto control = [](const uint_fast64_t* c) {
+		morton128_t m = 0;
+		for (unsigned int bit = 0; bit < 64; bit++) {
+			for (unsigned int axis = 0; axis < 2; axis++) { m |= static_cast<morton128_t>((c[axis] >> bit) & 1) << (bit * 2 + axis); }
+		}
+		return m;
+	};
+	bool ok = true;
+	for (unsigned int i = 0; i < 10000 && ok; i++) {
+		uint_fast64_t c[2], d[2];
+		for (unsigned int axis = 0; axis < 2; axis++) {
+			// mix in the edges of the range, and of the lower half of the coordinates
+			c[axis] = (i % 7 == 0) ? ~0ULL : ((i % 5 == 0) ? 0xFFFFFFFFULL : (static_cast<uint64_t>(rand()) << 48) ^ (static_cast<uint64_t>(rand()) << 32) ^ (static_cast<uint64_t>(rand()) << 16) ^ rand());
+		}
+		const morton128_t correct = control(c);
+		for (size_t f = 0; f < encoders.size(); f++) {
+			ok &= (encoders[f](c[0], c[1]) == correct);
+			decoders[f](correct, d[0], d[1]);
+			ok &= (d[0] == c[0] && d[1] == c[1]);
+		}
+		const uint_fast64_t ex[2] = { c[0] + 1, c[1] }, ey[2] = { c[0], c[1] - 1 };
+		ok &= (libmorton::m2D_inc_x<morton128_t>(correct) == control(ex)) && (libmorton::m2D_dec_y<morton128_t>(correct) == control(ey));
+		if (!ok) { std::cout << "\n    Incorrect encode/decode of (" << c[0] << ", " << c[1] << ")\n"; }
+	}
+	for (unsigned int t = 0; t < 50 && ok; t++) {
+		// a box of up to 16 cells per axis anywhere in the coordinate range
+		uint_fast64_t lo[2], hi[2];
+		for (unsigned int axis = 0; axis < 2; axis++) {
+			lo[axis] = std::min<uint64_t>((static_cast<uint64_t>(rand()) << 48) ^ (static_cast<uint64_t>(rand()) << 32) ^ (static_cast<uint64_t>(rand()) << 16) ^ rand(), ~0ULL - 15);
+			hi[axis] = lo[axis] + rand() % 16;
+		}
+		std::vector<morton128_t> inside;
+		for (uint_fast64_t y = lo[1]; y <= hi[1]; y++) {
+			for (uint_fast64_t x = lo[0]; x <= hi[0]; x++) { inside.push_back(libmorton::morton2D_128_encode(x, y)); }
+		}
+		std::sort(inside.begin(), inside.end());
+		libmorton::morton_box_iterator<morton128_t> it = libmorton::m2D_box_iterator<morton128_t>(libmorton::morton2D_128_encode(lo[0], lo[1]), libmorton::morton2D_128_encode(hi[0], hi[1]));
+		size_t k = 0;
+		for (; !it.done() && k < inside.size(); ++it, k++) { ok &= (*it == inside[k]); }
+		ok &= it.done() && k == inside.size();
+		if (!ok) { std::cout << "\n    Incorrect walk over box (" << lo[0] << ", " << lo[1] << ") - (" << hi[0] << ", " << hi[1] << ")\n"; }
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
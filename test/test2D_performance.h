@@ -10,6 +10,18 @@ extern size_t CURRENT_TEST_MAX;
 extern unsigned int times;
 extern std::vector<uint_fast64_t> running_sums;
 
+// Exact-width (uint32_t / uint16_t) LUT methods, timed next to the uint_fast ones: where uint_fast16_t / uint_fast32_t are
+// 8 bytes, those do lookups for bytes a 32-bit code has no room for
+static uint_fast32_t exact2D_32_e_sLUT(const uint_fast16_t x, const uint_fast16_t y) {
+	return libmorton::m2D_e_sLUT<uint32_t, uint16_t>(static_cast<uint16_t>(x), static_cast<uint16_t>(y));
+}
+
+static void exact2D_32_d_sLUT(const uint_fast32_t m, uint_fast16_t& x, uint_fast16_t& y) {
+	uint16_t ex, ey;
+	libmorton::m2D_d_sLUT<uint32_t, uint16_t>(static_cast<uint32_t>(m), ex, ey);
+	x = ex; y = ey;
+}
+
 // Check 2D encode function performance (linear)
 template <typename morton, typename coord>
 static double testEncode_2D_Linear_Perf(morton(*function)(coord, coord), size_t times) {
@@ -24,7 +36,7 @@ static double testEncode_2D_Linear_Perf(morton(*function)(coord, coord), size_t
 		}
 	}
 	timer.stop();
-	running_sums.push_back(runningsum);
+	running_sums.push_back(static_cast<uint_fast64_t>(runningsum));
 	return timer.elapsed_time_milliseconds / (float)times;
 }
 
@@ -52,7 +64,7 @@ static double testEncode_2D_Random_Perf(morton(*function)(coord, coord), size_t
 		}
 		timer.stop();
 	}
-	running_sums.push_back(runningsum);
+	running_sums.push_back(static_cast<uint_fast64_t>(runningsum));
 	return timer.elapsed_time_milliseconds / (float)times;
 }
 
@@ -121,6 +133,110 @@ static double testDecode_2D_Random_Perf(void(*function)(const morton, coord&, co
 	return timer.elapsed_time_milliseconds / (float)times;
 }
 
+// Check 2D batch encode function performance (linear), one row of y at a time
+template <typename morton, typename coord>
+static double testEncode_2D_Batch_Linear_Perf(void(*function)(const coord*, const coord*, morton*, size_t), size_t times) {
+	Timer timer = Timer();
+	morton runningsum = 0;
+	std::vector<coord> x(CURRENT_TEST_MAX), y(CURRENT_TEST_MAX);
+	std::vector<morton> result(CURRENT_TEST_MAX);
+	for (size_t j = 0; j < CURRENT_TEST_MAX; j++) {
+		y[j] = static_cast<coord>(j);
+	}
+	timer.start();
+	for (size_t t = 0; t < times; t++) {
+		for (size_t i = 0; i < CURRENT_TEST_MAX; i++) {
+			std::fill(x.begin(), x.end(), static_cast<coord>(i));
+			function(x.data(), y.data(), result.data(), CURRENT_TEST_MAX);
+			for (size_t j = 0; j < CURRENT_TEST_MAX; j++) {
+				runningsum += result[j];
+			}
+		}
+	}
+	timer.stop();
+	running_sums.push_back(runningsum);
+	return timer.elapsed_time_milliseconds / (float)times;
+}
+
+// Check 2D batch encode function performance (random)
+template <typename morton, typename coord>
+static double testEncode_2D_Batch_Random_Perf(void(*function)(const coord*, const coord*, morton*, size_t), size_t times) {
+	Timer timer = Timer();
+	morton runningsum = 0;
+	std::vector<coord> x(RAND_POOL_SIZE), y(RAND_POOL_SIZE);
+	std::vector<morton> result(RAND_POOL_SIZE);
+	for (size_t i = 0; i < RAND_POOL_SIZE; i++) {
+		x[i] = static_cast<coord>(rand());
+		y[i] = static_cast<coord>(rand());
+	}
+	timer.start();
+	for (size_t t = 0; t < times; t++) {
+		for (size_t i = 0; i < total; i += RAND_POOL_SIZE) {
+			size_t n = std::min(RAND_POOL_SIZE, total - i);
+			function(x.data(), y.data(), result.data(), n);
+			for (size_t k = 0; k < n; k++) {
+				runningsum += result[k];
+			}
+		}
+	}
+	timer.stop();
+	running_sums.push_back(runningsum);
+	return timer.elapsed_time_milliseconds / (float)times;
+}
+
+// Check 2D batch decode function performance (linear)
+template <typename morton, typename coord>
+static double testDecode_2D_Batch_Linear_Perf(void(*function)(const morton*, coord*, coord*, size_t), size_t times) {
+	size_t max_morton = CURRENT_TEST_MAX * CURRENT_TEST_MAX;
+	Timer timer = Timer();
+	coord runningsum = 0;
+	std::vector<morton> m(RAND_POOL_SIZE);
+	std::vector<coord> x(RAND_POOL_SIZE), y(RAND_POOL_SIZE);
+	timer.start();
+	for (size_t t = 0; t < times; t++) {
+		for (size_t i = 0; i < max_morton; i += RAND_POOL_SIZE) {
+			size_t n = std::min(RAND_POOL_SIZE, max_morton - i);
+			for (size_t k = 0; k < n; k++) {
+				m[k] = static_cast<morton>(i + k);
+			}
+			function(m.data(), x.data(), y.data(), n);
+			for (size_t k = 0; k < n; k++) {
+				runningsum += x[k] + y[k];
+			}
+		}
+	}
+	timer.stop();
+	running_sums.push_back(runningsum);
+	return timer.elapsed_time_milliseconds / (float)times;
+}
+
+// Check 2D batch decode function performance (random)
+template <typename morton, typename coord>
+static double testDecode_2D_Batch_Random_Perf(void(*function)(const morton*, coord*, coord*, size_t), size_t times) {
+	Timer timer = Timer();
+	morton maximum = ~0; // maximum for the random morton codes
+	coord runningsum = 0;
+	size_t max_morton = CURRENT_TEST_MAX * CURRENT_TEST_MAX;
+	std::vector<morton> m(RAND_POOL_SIZE);
+	std::vector<coord> x(RAND_POOL_SIZE), y(RAND_POOL_SIZE);
+	for (size_t i = 0; i < RAND_POOL_SIZE; i++) {
+		m[i] = (morton(rand()) + morton(rand())) % maximum;
+	}
+	timer.start();
+	for (size_t t = 0; t < times; t++) {
+		for (size_t i = 0; i < max_morton; i += RAND_POOL_SIZE) {
+			size_t n = std::min(RAND_POOL_SIZE, max_morton - i);
+			function(m.data(), x.data(), y.data(), n);
+			for (size_t k = 0; k < n; k++) {
+				runningsum += x[k] + y[k];
+			}
+		}
+	}
+	timer.stop();
+	running_sums.push_back(runningsum);
+	return timer.elapsed_time_milliseconds / (float)times;
+}
+
 static void test_2D_performance(vector<encode_2D_64_wrapper>* funcs64_encode, vector<encode_2D_32_wrapper>* funcs32_encode,
 	vector<decode_2D_64_wrapper>* funcs64_decode, vector<decode_2D_32_wrapper>* funcs32_decode) {
 	cout << "++ (2D) Encoding " << CURRENT_TEST_MAX << "^2 morton codes (" << total << " in total)" << endl;
@@ -133,6 +249,22 @@ static void test_2D_performance(vector<encode_2D_64_wrapper>* funcs64_encode, ve
 		os << testEncode_2D_Random_Perf((*it).encode, times) << " ms\t";
 		cout << os.str() << "64-bit " << (*it).description << endl;
 	}
+	os.str("");
+	os << testEncode_2D_Batch_Linear_Perf(&libmorton::morton2D_64_encode_batch, times) << " ms\t";
+	os << testEncode_2D_Batch_Random_Perf(&libmorton::morton2D_64_encode_batch, times) << " ms\t";
+	cout << os.str() << "64-bit Batch (morton.h)" << endl;
+	os.str("");
+	os << testEncode_2D_Linear_Perf(&libmorton::hilbert2D_64_encode, times) << " ms\t";
+	os << testEncode_2D_Random_Perf(&libmorton::hilbert2D_64_encode, times) << " ms\t";
+	cout << os.str() << "64-bit Hilbert (hilbert.h)" << endl;
+	os.str("");
+	os << testEncode_2D_Batch_Linear_Perf(&libmorton::hilbert2D_64_encode_batch, times) << " ms\t";
+	os << testEncode_2D_Batch_Random_Perf(&libmorton::hilbert2D_64_encode_batch, times) << " ms\t";
+	cout << os.str() << "64-bit Hilbert Batch (hilbert.h)" << endl;
+	os.str("");
+	os << testEncode_2D_Linear_Perf(&libmorton::morton2D_128_encode, times) << " ms\t";
+	os << testEncode_2D_Random_Perf(&libmorton::morton2D_128_encode, times) << " ms\t";
+	cout << os.str() << "128-bit (morton.h)" << endl;
 	cout << "+++ (2D) Encoding 32-bit sized morton codes" << endl;
 	for (auto it = (*funcs32_encode).begin(); it != (*funcs32_encode).end(); it++) {
 		os.str("");
@@ -140,6 +272,18 @@ static void test_2D_performance(vector<encode_2D_64_wrapper>* funcs64_encode, ve
 		os << testEncode_2D_Random_Perf((*it).encode, times) << " ms\t";
 		cout << os.str() << "32-bit " << (*it).description << endl;
 	}
+	os.str("");
+	os << testEncode_2D_Batch_Linear_Perf(&libmorton::morton2D_32_encode_batch, times) << " ms\t";
+	os << testEncode_2D_Batch_Random_Perf(&libmorton::morton2D_32_encode_batch, times) << " ms\t";
+	cout << os.str() << "32-bit Batch (morton.h)" << endl;
+	os.str("");
+	os << testEncode_2D_Linear_Perf(&libmorton::hilbert2D_32_encode, times) << " ms\t";
+	os << testEncode_2D_Random_Perf(&libmorton::hilbert2D_32_encode, times) << " ms\t";
+	cout << os.str() << "32-bit Hilbert (hilbert.h)" << endl;
+	os.str("");
+	os << testEncode_2D_Batch_Linear_Perf(&libmorton::hilbert2D_32_encode_batch, times) << " ms\t";
+	os << testEncode_2D_Batch_Random_Perf(&libmorton::hilbert2D_32_encode_batch, times) << " ms\t";
+	cout << os.str() << "32-bit Hilbert Batch (hilbert.h)" << endl;
 	 cout << "++ (2D) Decoding " << CURRENT_TEST_MAX << "^2 morton codes (" << total << " in total)" << endl;
 	 cout << "+++ (2D) Decoding 64-bit sized morton codes" << endl;
 	 for (auto it = (*funcs64_decode).begin(); it != (*funcs64_decode).end(); it++) {
@@ -148,6 +292,18 @@ static void test_2D_performance(vector<encode_2D_64_wrapper>* funcs64_encode, ve
 	 	os << testDecode_2D_Random_Perf((*it).decode, times) << " ms\t";
 	 	cout << os.str() << "64-bit " << (*it).description << endl;
 	 }
+	os.str("");
+	os << testDecode_2D_Batch_Linear_Perf(&libmorton::morton2D_64_decode_batch, times) << " ms\t";
+	os << testDecode_2D_Batch_Random_Perf(&libmorton::morton2D_64_decode_batch, times) << " ms\t";
+	cout << os.str() << "64-bit Batch (morton.h)" << endl;
+	os.str("");
+	os << testDecode_2D_Linear_Perf(&libmorton::hilbert2D_64_decode, times) << " ms\t";
+	os << testDecode_2D_Random_Perf(&libmorton::hilbert2D_64_decode, times) << " ms\t";
+	cout << os.str() << "64-bit Hilbert (hilbert.h)" << endl;
+	os.str("");
+	os << testDecode_2D_Batch_Linear_Perf(&libmorton::hilbert2D_64_decode_batch, times) << " ms\t";
+	os << testDecode_2D_Batch_Random_Perf(&libmorton::hilbert2D_64_decode_batch, times) << " ms\t";
+	cout << os.str() << "64-bit Hilbert Batch (hilbert.h)" << endl;
 	 cout << "+++ (2D) Decoding 32-bit sized morton codes" << endl;
 	 for (auto it = (*funcs32_decode).begin(); it != (*funcs32_decode).end(); it++) {
 	 	os.str("");
@@ -156,4 +312,16 @@ static void test_2D_performance(vector<encode_2D_64_wrapper>* funcs64_encode, ve
 	 	os << testDecode_2D_Random_Perf((*it).decode, times) << " ms\t";
 	 	cout << os.str() << "32-bit " << (*it).description << endl;
 	 }
+	os.str("");
+	os << testDecode_2D_Batch_Linear_Perf(&libmorton::morton2D_32_decode_batch, times) << " ms\t";
+	os << testDecode_2D_Batch_Random_Perf(&libmorton::morton2D_32_decode_batch, times) << " ms\t";
+	cout << os.str() << "32-bit Batch (morton.h)" << endl;
+	os.str("");
+	os << testDecode_2D_Linear_Perf(&libmorton::hilbert2D_32_decode, times) << " ms\t";
+	os << testDecode_2D_Random_Perf(&libmorton::hilbert2D_32_decode, times) << " ms\t";
+	cout << os.str() << "32-bit Hilbert (hilbert.h)" << endl;
+	os.str("");
+	os << testDecode_2D_Batch_Linear_Perf(&libmorton::hilbert2D_32_decode_batch, times) << " ms\t";
+	os << testDecode_2D_Batch_Random_Perf(&libmorton::hilbert2D_32_decode_batch, times) << " ms\t";
+	cout << os.str() << "32-bit Hilbert Batch (hilbert.h)" << endl;
 }
\ No newline at end of file
@@ -161,4 +161,1103 @@ inline bool check3D_EncodeDecodeMatch(std::vector<encode_f_3D_wrapper<morton, co
 	}
 	ok ? printPassed() : printFailed();
 	return ok;
-}
\ No newline at end of file
+}
+
+// Check a 3D batch encode function against the scalar Magicbits method
+// Runs over all batch sizes up to 64 to hit every remainder, with random coordinates that also have bits outside the encodable range
+template <typename morton, typename coord, size_t bits>
+inline bool check3D_EncodeBatchCorrectness(void(*batch)(const coord*, const coord*, const coord*, morton*, size_t)) {
+	printf("++ Checking correctness of 3D batch encoding (%zd bit) ... ", bits);
+	bool ok = true;
+	std::vector<coord> x(64), y(64), z(64);
+	std::vector<morton> result(64);
+	for (size_t n = 0; n <= 64; n++) {
+		for (size_t i = 0; i < n; i++) {
+			x[i] = static_cast<coord>((static_cast<uint32_t>(rand()) << 16) ^ static_cast<uint32_t>(rand()));
+			y[i] = static_cast<coord>((static_cast<uint32_t>(rand()) << 16) ^ static_cast<uint32_t>(rand()));
+			z[i] = static_cast<coord>((static_cast<uint32_t>(rand()) << 16) ^ static_cast<uint32_t>(rand()));
+		}
+		batch(x.data(), y.data(), z.data(), result.data(), n);
+		for (size_t i = 0; i < n; i++) {
+			morton correct = libmorton::m3D_e_magicbits<morton, coord>(x[i], y[i], z[i]);
+			if (result[i] != correct) {
+				std::cout << "\n    Incorrect batch encoding of (" << x[i] << ", " << y[i] << ", " << z[i] << ") at index " << i << " of " << n << ": "
+					<< result[i] << " != " << correct << "\n";
+				ok = false;
+			}
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check a 3D batch decode function against the scalar Magicbits method
+template <typename morton, typename coord, size_t bits>
+inline bool check3D_DecodeBatchCorrectness(void(*batch)(const morton*, coord*, coord*, coord*, size_t)) {
+	printf("++ Checking correctness of 3D batch decoding (%zd bit) ... ", bits);
+	bool ok = true;
+	std::vector<morton> m(64);
+	std::vector<coord> x(64), y(64), z(64);
+	for (size_t n = 0; n <= 64; n++) {
+		for (size_t i = 0; i < n; i++) {
+			m[i] = static_cast<morton>((static_cast<uint64_t>(rand()) << 42) ^ (static_cast<uint64_t>(rand()) << 21) ^ static_cast<uint64_t>(rand()));
+		}
+		batch(m.data(), x.data(), y.data(), z.data(), n);
+		for (size_t i = 0; i < n; i++) {
+			coord correct_x, correct_y, correct_z;
+			libmorton::m3D_d_magicbits<morton, coord>(m[i], correct_x, correct_y, correct_z);
+			if (x[i] != correct_x || y[i] != correct_y || z[i] != correct_z) {
+				printIncorrectDecoding3D<morton, coord>("batch", m[i], x[i], y[i], z[i], correct_x, correct_y, correct_z);
+				ok = false;
+			}
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check a 3D strided encode function against the scalar Magicbits method
+// Records of the given stride are filled with random bytes, the buffer is sized exactly so reads past the last record would be caught by sanitizers
+template <typename morton, typename coord, size_t bits>
+inline bool check3D_EncodeStridedCorrectness(void(*strided)(const void*, size_t, size_t, size_t, size_t, morton*, size_t),
+	size_t stride, size_t offx, size_t offy, size_t offz) {
+	printf("++ Checking correctness of 3D strided encoding (%zd bit, stride %zd, offsets %zd/%zd/%zd) ... ", bits, stride, offx, offy, offz);
+	bool ok = true;
+	std::vector<morton> result(64);
+	for (size_t n = 0; n <= 64; n++) {
+		std::vector<unsigned char> records(n * stride);
+		for (size_t i = 0; i < records.size(); i++) {
+			records[i] = static_cast<unsigned char>(rand());
+		}
+		strided(records.data(), stride, offx, offy, offz, result.data(), n);
+		for (size_t i = 0; i < n; i++) {
+			const unsigned char* record = records.data() + i * stride;
+			const coord x = libmorton::loadCoord<coord>(record + offx);
+			const coord y = libmorton::loadCoord<coord>(record + offy);
+			const coord z = libmorton::loadCoord<coord>(record + offz);
+			morton correct = libmorton::m3D_e_magicbits<morton, coord>(x, y, z);
+			if (result[i] != correct) {
+				std::cout << "\n    Incorrect strided encoding of (" << x << ", " << y << ", " << z << ") at index " << i << " of " << n << ": "
+					<< result[i] << " != " << correct << "\n";
+				ok = false;
+			}
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check a 3D floating point encode function against quantizing each position on its own and encoding with the Magicbits method,
+// then check that the cell centres the decode method gives encode to the same codes
+// Positions are spread over a larger box than the grid, with NaN, infinities and the box edges mixed in.
+template <typename morton, typename coord, typename real, size_t bits>
+inline bool check3D_EncodeFloatsCorrectness(void(*encode)(const real*, morton*, size_t, const libmorton::morton_box<real>&, unsigned int),
+	void(*decode)(const morton*, real*, size_t, const libmorton::morton_box<real>&, unsigned int)) {
+	printf("++ Checking correctness of 3D %s position encoding (%zd bit) ... ", sizeof(real) == 4 ? "float" : "double", bits);
+	const libmorton::morton_box<real> box = { { static_cast<real>(-10), static_cast<real>(0.5), static_cast<real>(1000) }, { static_cast<real>(30), static_cast<real>(1.5), static_cast<real>(4000) } };
+	const real specials[6] = { std::numeric_limits<real>::quiet_NaN(), std::numeric_limits<real>::infinity(), -std::numeric_limits<real>::infinity(), 0, 0, 0 };
+	const unsigned int levels[4] = { 0, 1, bits / 3, bits / 3 + 5 }; // the last one is clamped
+	bool ok = true;
+	for (unsigned int l = 0; l < 4; l++) {
+		const unsigned int level = std::min(levels[l], static_cast<unsigned int>(bits / 3));
+		const real top = static_cast<real>((1ULL << level) - 1);
+		for (size_t n = 0; n <= 67; n++) {
+			std::vector<real> xyz(3 * n), centres(3 * n);
+			std::vector<morton> codes(n), recoded(n);
+			for (size_t i = 0; i < 3 * n; i++) {
+				const unsigned int axis = i % 3;
+				const real extent = box.max[axis] - box.min[axis];
+				xyz[i] = box.min[axis] + extent * static_cast<real>(rand() % 1400 - 200) / 1000;
+				if (rand() % 13 == 0) { xyz[i] = specials[rand() % 6]; }
+				if (rand() % 13 == 0) { xyz[i] = (rand() % 2) ? box.min[axis] : box.max[axis]; }
+			}
+			encode(xyz.data(), codes.data(), n, box, levels[l]);
+			for (size_t i = 0; i < n; i++) {
+				coord c[3];
+				for (unsigned int axis = 0; axis < 3; axis++) {
+					const real scale = static_cast<real>(1ULL << level) / (box.max[axis] - box.min[axis]);
+					const real v = (xyz[3 * i + axis] - box.min[axis]) * scale;
+					c[axis] = !(v > 0) ? 0 : ((v >= top) ? static_cast<coord>(top) : static_cast<coord>(v));
+				}
+				const morton correct = libmorton::m3D_e_magicbits<morton, coord>(c[0], c[1], c[2]);
+				if (codes[i] != correct) {
+					std::cout << "\n    Incorrect encoding of (" << xyz[3 * i] << ", " << xyz[3 * i + 1] << ", " << xyz[3 * i + 2] << ") at level " << level
+						<< ", index " << i << " of " << n << ": " << codes[i] << " != " << correct << "\n";
+					ok = false;
+				}
+			}
+			decode(codes.data(), centres.data(), n, box, levels[l]);
+			encode(centres.data(), recoded.data(), n, box, levels[l]);
+			if (codes != recoded) {
+				std::cout << "\n    Cell centres of " << n << " codes at level " << level << " don't encode to the same codes\n";
+				ok = false;
+			}
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check the 3D signed coordinate methods of morton.h: a code is the Magicbits code of the coordinates plus 2^(fieldbits - 1),
+// codes keep the order of the coordinates on an axis across 0, and the batch methods (over more than one block) agree
+template <typename morton, typename scoord, size_t bits>
+inline bool check3D_SignedCorrectness(morton(*encode)(scoord, scoord, scoord), void(*decode)(morton, scoord&, scoord&, scoord&),
+	void(*encode_batch)(const scoord*, const scoord*, const scoord*, morton*, size_t), void(*decode_batch)(const morton*, scoord*, scoord*, scoord*, size_t)) {
+	printf("++ Checking correctness of 3D signed coordinates (%zd bit) ... ", bits);
+	const int64_t half = 1LL << (bits / 3 - 1);
+	const size_t n = 3000;
+	std::vector<scoord> c[3], d[3];
+	std::vector<morton> codes(n);
+	for (unsigned int axis = 0; axis < 3; axis++) {
+		c[axis].resize(n);
+		d[axis].resize(n);
+		for (size_t i = 0; i < n; i++) {
+			// mix in the edges of the range and the coordinates around 0
+			const int64_t edges[4] = { -half, half - 1, -1, 0 };
+			const int64_t r = static_cast<int64_t>((static_cast<uint64_t>(rand()) << 16) ^ rand()) % (2 * half) - half;
+			c[axis][i] = static_cast<scoord>((rand() % 5 == 0) ? edges[rand() % 4] : r);
+		}
+	}
+	encode_batch(c[0].data(), c[1].data(), c[2].data(), codes.data(), n);
+	decode_batch(codes.data(), d[0].data(), d[1].data(), d[2].data(), n);
+	bool ok = true;
+	for (size_t i = 0; i < n; i++) {
+		const scoord x = c[0][i], y = c[1][i], z = c[2][i];
+		const morton correct = libmorton::m3D_e_magicbits<morton, uint64_t>(static_cast<uint64_t>(x + half), static_cast<uint64_t>(y + half), static_cast<uint64_t>(z + half));
+		scoord dx, dy, dz;
+		decode(correct, dx, dy, dz);
+		if (encode(x, y, z) != correct || codes[i] != correct || dx != x || dy != y || dz != z || d[0][i] != x || d[1][i] != y || d[2][i] != z) {
+			std::cout << "\n    Incorrect signed encoding/decoding of (" << x << ", " << y << ", " << z << "): " << encode(x, y, z) << ", batch " << codes[i]
+				<< " != " << correct << ", decoded (" << dx << ", " << dy << ", " << dz << ")\n";
+			ok = false;
+		}
+		// on one axis, the order of the codes is the order of the coordinates
+		const scoord px = c[0][(i + n - 1) % n];
+		if ((encode(px, y, z) < correct) != (px < x)) {
+			std::cout << "\n    Signed codes of x = " << px << " and " << x << " are out of order\n";
+			ok = false;
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check the 3D dilated arithmetic methods against decoding, changing the coordinates and encoding again
+template <typename morton, typename coord, size_t bits>
+inline bool check3D_ArithmeticCorrectness() {
+	printf("++ Checking correctness of 3D dilated arithmetic (%zd bit) ... ", bits);
+	const size_t fieldbits = bits / 3;
+	const uint64_t fieldmask = (1ULL << fieldbits) - 1;
+	bool ok = true;
+	for (unsigned int i = 0; i < 10000; i++) {
+		coord c[3], d[3];
+		for (unsigned int axis = 0; axis < 3; axis++) {
+			// mix in the edges of the range, to check the wrap around
+			c[axis] = static_cast<coord>((i % 7 == 0) ? fieldmask : (static_cast<uint64_t>(rand()) << 16 ^ rand()) & fieldmask);
+			d[axis] = static_cast<coord>((i % 5 == 0) ? 0 : (static_cast<uint64_t>(rand()) << 16 ^ rand()) & fieldmask);
+		}
+		const morton m = libmorton::m3D_e_magicbits<morton, coord>(c[0], c[1], c[2]);
+		const morton dm = libmorton::m3D_e_magicbits<morton, coord>(d[0], d[1], d[2]);
+		morton (*const add[3])(const morton, const morton) = { &libmorton::m3D_add_x<morton>, &libmorton::m3D_add_y<morton>, &libmorton::m3D_add_z<morton> };
+		morton (*const sub[3])(const morton, const morton) = { &libmorton::m3D_sub_x<morton>, &libmorton::m3D_sub_y<morton>, &libmorton::m3D_sub_z<morton> };
+		morton (*const inc[3])(const morton) = { &libmorton::m3D_inc_x<morton>, &libmorton::m3D_inc_y<morton>, &libmorton::m3D_inc_z<morton> };
+		morton (*const dec[3])(const morton) = { &libmorton::m3D_dec_x<morton>, &libmorton::m3D_dec_y<morton>, &libmorton::m3D_dec_z<morton> };
+		coord sum[3], diff[3];
+		for (unsigned int axis = 0; axis < 3; axis++) {
+			sum[axis] = static_cast<coord>((c[axis] + d[axis]) & fieldmask);
+			diff[axis] = static_cast<coord>((c[axis] - d[axis]) & fieldmask);
+			// expected results when only this axis changes
+			coord e[4][3];
+			for (unsigned int k = 0; k < 4; k++) {
+				for (unsigned int j = 0; j < 3; j++) { e[k][j] = c[j]; }
+			}
+			e[0][axis] = sum[axis];
+			e[1][axis] = diff[axis];
+			e[2][axis] = static_cast<coord>((c[axis] + 1) & fieldmask);
+			e[3][axis] = static_cast<coord>((c[axis] - 1) & fieldmask);
+			const morton results[4] = { add[axis](m, dm), sub[axis](m, dm), inc[axis](m), dec[axis](m) };
+			for (unsigned int k = 0; k < 4; k++) {
+				const morton correct = libmorton::m3D_e_magicbits<morton, coord>(e[k][0], e[k][1], e[k][2]);
+				if (results[k] != correct) {
+					std::cout << "\n    Incorrect " << (k == 0 ? "add" : k == 1 ? "sub" : k == 2 ? "inc" : "dec") << " on axis " << axis
+						<< " of (" << c[0] << ", " << c[1] << ", " << c[2] << "): " << results[k] << " != " << correct << "\n";
+					ok = false;
+				}
+			}
+		}
+		if (libmorton::m3D_add<morton>(m, dm) != libmorton::m3D_e_magicbits<morton, coord>(sum[0], sum[1], sum[2])
+			|| libmorton::m3D_sub<morton>(m, dm) != libmorton::m3D_e_magicbits<morton, coord>(diff[0], diff[1], diff[2])) {
+			std::cout << "\n    Incorrect full add/sub of (" << c[0] << ", " << c[1] << ", " << c[2] << ") and ("
+				<< d[0] << ", " << d[1] << ", " << d[2] << ")\n";
+			ok = false;
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check a 3D neighbour function against decoding, moving the coordinates and encoding again
+// Runs every connectivity and boundary policy on a few grid levels, with cells on the boundaries mixed in
+template <typename morton, typename coord, size_t bits>
+inline bool check3D_NeighboursCorrectness(size_t(*neighbours)(const morton*, morton*, size_t, unsigned int, unsigned int, libmorton::morton_boundary)) {
+	printf("++ Checking correctness of 3D neighbours (%zd bit) ... ", bits);
+	const unsigned int fieldbits = bits / 3;
+	const unsigned int levels[4] = { 0, 1, 4, fieldbits };
+	const unsigned int connectivities[3] = { 6, 18, 26 };
+	const libmorton::morton_boundary boundaries[3] = { libmorton::morton_boundary::clamp, libmorton::morton_boundary::wrap, libmorton::morton_boundary::invalid };
+	bool ok = true;
+	std::vector<morton> m(37), result(37 * 26);
+	for (unsigned int l = 0; l < 4; l++) {
+		const uint64_t maxcoord = (1ULL << levels[l]) - 1;
+		for (size_t i = 0; i < m.size(); i++) {
+			coord c[3];
+			for (unsigned int axis = 0; axis < 3; axis++) {
+				const unsigned int pick = static_cast<unsigned int>(rand()) % 4;
+				c[axis] = static_cast<coord>((pick == 0) ? 0 : ((pick == 1) ? maxcoord : (static_cast<uint64_t>(rand()) & maxcoord)));
+			}
+			m[i] = libmorton::m3D_e_magicbits<morton, coord>(c[0], c[1], c[2]);
+		}
+		for (unsigned int k = 0; k < 3; k++) {
+			for (unsigned int b = 0; b < 3; b++) {
+				unsigned char offsets[26][3];
+				const unsigned int count = libmorton::mortonNeighbourOffsets(3, connectivities[k], offsets);
+				if (neighbours(m.data(), result.data(), m.size(), levels[l], connectivities[k], boundaries[b]) != count || count != connectivities[k]) {
+					std::cout << "\n    Wrong neighbour count for connectivity " << connectivities[k] << "\n";
+					ok = false;
+					continue;
+				}
+				for (size_t i = 0; i < m.size(); i++) {
+					coord c[3];
+					libmorton::m3D_d_magicbits<morton, coord>(m[i], c[0], c[1], c[2]);
+					for (unsigned int j = 0; j < count; j++) {
+						morton correct = 0;
+						bool outside = false;
+						coord nc[3];
+						for (unsigned int axis = 0; axis < 3; axis++) {
+							const int64_t v = static_cast<int64_t>(c[axis]) + offsets[j][axis] - 1;
+							if (v < 0 || v > static_cast<int64_t>(maxcoord)) {
+								outside = true;
+								nc[axis] = static_cast<coord>((boundaries[b] == libmorton::morton_boundary::clamp) ? c[axis] : (v < 0 ? maxcoord : 0));
+							}
+							else {
+								nc[axis] = static_cast<coord>(v);
+							}
+						}
+						correct = (outside && boundaries[b] == libmorton::morton_boundary::invalid) ? libmorton::mortonInvalid<morton>() : libmorton::m3D_e_magicbits<morton, coord>(nc[0], nc[1], nc[2]);
+						if (result[i * count + j] != correct) {
+							std::cout << "\n    Incorrect neighbour " << j << " of (" << c[0] << ", " << c[1] << ", " << c[2] << ") at level " << levels[l]
+								<< ", connectivity " << connectivities[k] << ", boundary " << b << ": " << result[i * count + j] << " != " << correct << "\n";
+							ok = false;
+						}
+					}
+				}
+			}
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check 3D BIGMIN / LITMAX and box scans against the sorted codes of every cell in random boxes
+// The boxes are small, but placed anywhere in the coordinate range so the high bits get used as well
+template <typename morton, typename coord, size_t bits>
+inline bool check3D_BoxQueryCorrectness() {
+	printf("++ Checking correctness of 3D box queries (%zd bit) ... ", bits);
+	const unsigned int fieldbits = bits / 3;
+	const uint64_t maxcoord = (1ULL << fieldbits) - 1;
+	bool ok = true;
+	for (unsigned int t = 0; t < 200; t++) {
+		// a box of up to 8 cells per axis, and a region of up to 24 cells per axis around it
+		coord lo[3], hi[3], rlo[3], rhi[3];
+		for (unsigned int axis = 0; axis < 3; axis++) {
+			const uint64_t base = (t % 4 == 0) ? 0 : (((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord);
+			rlo[axis] = static_cast<coord>(std::min<uint64_t>(base, maxcoord - 23));
+			lo[axis] = static_cast<coord>(rlo[axis] + rand() % 16);
+			hi[axis] = static_cast<coord>(lo[axis] + rand() % 8);
+			rhi[axis] = static_cast<coord>(rlo[axis] + 23);
+		}
+		const morton zmin = libmorton::m3D_e_magicbits<morton, coord>(lo[0], lo[1], lo[2]);
+		const morton zmax = libmorton::m3D_e_magicbits<morton, coord>(hi[0], hi[1], hi[2]);
+		std::vector<morton> inside, keys;
+		for (coord z = rlo[2]; z <= rhi[2]; z++) {
+			for (coord y = rlo[1]; y <= rhi[1]; y++) {
+				for (coord x = rlo[0]; x <= rhi[0]; x++) {
+					const morton m = libmorton::m3D_e_magicbits<morton, coord>(x, y, z);
+					const bool in = x >= lo[0] && x <= hi[0] && y >= lo[1] && y <= hi[1] && z >= lo[2] && z <= hi[2];
+					if (in) { inside.push_back(m); }
+					if (in || rand() % 4 == 0) { keys.push_back(m); }
+					ok &= (libmorton::m3D_in_box<morton>(m, zmin, zmax) == in);
+				}
+			}
+		}
+		std::sort(inside.begin(), inside.end());
+		std::sort(keys.begin(), keys.end());
+		for (size_t i = 0; i < keys.size(); i++) {
+			const morton zcur = keys[i];
+			if (zcur < zmax) {
+				const morton correct = *std::upper_bound(inside.begin(), inside.end(), zcur);
+				if (libmorton::m3D_bigmin<morton>(zcur, zmin, zmax) != correct) {
+					std::cout << "\n    Incorrect BIGMIN of " << zcur << " in box [" << zmin << ", " << zmax << "]\n";
+					ok = false;
+				}
+			}
+			if (zcur > zmin) {
+				const morton correct = *(std::lower_bound(inside.begin(), inside.end(), zcur) - 1);
+				if (libmorton::m3D_litmax<morton>(zcur, zmin, zmax) != correct) {
+					std::cout << "\n    Incorrect LITMAX of " << zcur << " in box [" << zmin << ", " << zmax << "]\n";
+					ok = false;
+				}
+			}
+		}
+		// every key inside the box is visited exactly once, in order, in runs that don't touch each other
+		std::vector<morton> visited;
+		size_t last_end = 0;
+		const size_t hits = libmorton::m3D_box_scan<morton>(keys.data(), keys.size(), zmin, zmax, [&](size_t begin, size_t end) {
+			ok &= (begin < end) && (visited.empty() || begin > last_end);
+			for (size_t i = begin; i < end; i++) { visited.push_back(keys[i]); }
+			last_end = end;
+		});
+		if (hits != inside.size() || visited != inside) {
+			std::cout << "\n    Incorrect box scan of box [" << zmin << ", " << zmax << "]: " << hits << " hits, expected " << inside.size() << "\n";
+			ok = false;
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check 3D box interval decomposition against the codes of every cell in random boxes
+// Exact decompositions must cover exactly the box with maximal runs, budgeted ones must cover it within the budget
+template <typename morton, typename coord, size_t bits>
+inline bool check3D_BoxIntervalsCorrectness() {
+	printf("++ Checking correctness of 3D box intervals (%zd bit) ... ", bits);
+	const unsigned int fieldbits = bits / 3;
+	const uint64_t maxcoord = (1ULL << fieldbits) - 1;
+	const size_t budgets[4] = { 0, 1, 4, 16 };
+	bool ok = true;
+	std::vector<libmorton::morton_interval<morton> > intervals;
+	for (unsigned int t = 0; t < 200; t++) {
+		// a box of up to 8 cells per axis anywhere in the coordinate range
+		coord lo[3], hi[3];
+		for (unsigned int axis = 0; axis < 3; axis++) {
+			const uint64_t base = (t % 4 == 0) ? 0 : (((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord);
+			lo[axis] = static_cast<coord>(std::min<uint64_t>(base, maxcoord - 7));
+			hi[axis] = static_cast<coord>(lo[axis] + rand() % 8);
+		}
+		const morton zmin = libmorton::m3D_e_magicbits<morton, coord>(lo[0], lo[1], lo[2]);
+		const morton zmax = libmorton::m3D_e_magicbits<morton, coord>(hi[0], hi[1], hi[2]);
+		std::vector<morton> inside;
+		for (coord z = lo[2]; z <= hi[2]; z++) {
+			for (coord y = lo[1]; y <= hi[1]; y++) {
+				for (coord x = lo[0]; x <= hi[0]; x++) {
+					inside.push_back(libmorton::m3D_e_magicbits<morton, coord>(x, y, z));
+				}
+			}
+		}
+		std::sort(inside.begin(), inside.end());
+		for (unsigned int b = 0; b < 4; b++) {
+			const size_t count = libmorton::m3D_box_intervals<morton>(zmin, zmax, budgets[b], intervals);
+			bool good = (count == intervals.size()) && (budgets[b] == 0 || count <= budgets[b]);
+			uint64_t covered = 0;
+			for (size_t i = 0; i < intervals.size(); i++) {
+				// sorted, with both ends inside the box, and (when exact) not touching the next interval
+				good &= intervals[i].lo <= intervals[i].hi;
+				good &= libmorton::m3D_in_box<morton>(intervals[i].lo, zmin, zmax) && libmorton::m3D_in_box<morton>(intervals[i].hi, zmin, zmax);
+				if (i > 0) { good &= intervals[i - 1].hi < intervals[i].lo && (budgets[b] != 0 || intervals[i - 1].hi + 1 < intervals[i].lo); }
+				covered += static_cast<uint64_t>(intervals[i].hi - intervals[i].lo) + 1;
+			}
+			// every code inside the box is covered
+			size_t k = 0;
+			for (size_t i = 0; i < inside.size() && good; i++) {
+				while (k < intervals.size() && intervals[k].hi < inside[i]) { k++; }
+				good &= k < intervals.size() && intervals[k].lo <= inside[i];
+			}
+			if (budgets[b] == 0) { good &= (covered == inside.size()); }
+			if (!good) {
+				std::cout << "\n    Incorrect decomposition of box [" << zmin << ", " << zmax << "] with budget " << budgets[b] << ": " << count << " intervals\n";
+				ok = false;
+			}
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Sorts codes of random points (full range, and a small range with many duplicates and zero high digits) with and without
+// an index payload, on one and on several threads, and compares against std::stable_sort
+template <typename morton, typename coord, size_t bits>
+inline bool check3D_SortCorrectness() {
+	printf("++ Checking correctness of sorting 3D morton codes (%zd bit) ... ", bits);
+	const size_t n = 300000; // enough for several threads
+	const unsigned int fieldbits = bits / 3;
+	const uint64_t ranges[2] = { (1ULL << fieldbits) - 1, 0xFF };
+	const unsigned int threads[2] = { 1, 4 };
+	bool ok = true;
+	std::vector<morton> keys(n), sorted_keys(n);
+	std::vector<size_t> values(n);
+	std::vector<std::pair<morton, size_t> > expected(n);
+	for (unsigned int r = 0; r < 2; r++) {
+		for (size_t i = 0; i < n; i++) {
+			const coord x = static_cast<coord>(((static_cast<uint64_t>(rand()) << 16) ^ rand()) & ranges[r]);
+			const coord y = static_cast<coord>(((static_cast<uint64_t>(rand()) << 16) ^ rand()) & ranges[r]);
+			const coord z = static_cast<coord>(((static_cast<uint64_t>(rand()) << 16) ^ rand()) & ranges[r]);
+			expected[i] = std::make_pair(libmorton::m3D_e_magicbits<morton, coord>(x, y, z), i);
+		}
+		std::vector<std::pair<morton, size_t> > input(expected);
+		std::stable_sort(expected.begin(), expected.end(), [](const std::pair<morton, size_t>& a, const std::pair<morton, size_t>& b) { return a.first < b.first; });
+		for (unsigned int t = 0; t < 2; t++) {
+			for (size_t i = 0; i < n; i++) {
+				keys[i] = input[i].first;
+				sorted_keys[i] = input[i].first;
+				values[i] = input[i].second;
+			}
+			libmorton::morton_sort<morton, size_t>(keys.data(), values.data(), n, threads[t]);
+			libmorton::morton_sort<morton>(sorted_keys.data(), n, threads[t]);
+			for (size_t i = 0; i < n; i++) {
+				if (keys[i] != expected[i].first || values[i] != expected[i].second || sorted_keys[i] != expected[i].first) {
+					std::cout << "\n    Incorrect sort on " << threads[t] << " threads at position " << i << ": got " << keys[i] << " (index " << values[i] << "), expected " << expected[i].first << " (index " << expected[i].second << ")\n";
+					ok = false;
+					break;
+				}
+			}
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check the parallel encoder/decoder on several thread counts and executors (one running the chunks backwards on the calling thread)
+// against the scalar Magicbits method. The size isn't a multiple of the chunk size, so the last chunk is a partial one.
+template <typename morton, typename coord, size_t bits>
+inline bool check3D_ParallelCorrectness() {
+	printf("++ Checking correctness of parallel 3D encoding/decoding (%zd bit) ... ", bits);
+	const size_t n = 5 * libmorton::parallel_detail::chunk_size + 123;
+	const unsigned int threads[3] = { 1, 3, 0 };
+	const libmorton::morton_executor executors[2] = { libmorton::default_executor(2),
+		[](size_t count, const std::function<void(size_t)>& task) { for (size_t i = count; i > 0; i--) { task(i - 1); } } };
+	bool ok = true;
+	std::vector<coord> x(n), y(n), z(n), dx(n), dy(n), dz(n);
+	std::vector<morton> m(n);
+	const uint64_t maxcoord = (1ULL << (bits / 3)) - 1;
+	for (unsigned int run = 0; run < 5; run++) {
+		for (size_t i = 0; i < n; i++) {
+			x[i] = static_cast<coord>(((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord);
+			y[i] = static_cast<coord>(((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord);
+			z[i] = static_cast<coord>(((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord);
+		}
+		if (run < 3) {
+			libmorton::parallel_encode3D(x.data(), y.data(), z.data(), m.data(), n, threads[run]);
+			libmorton::parallel_decode3D(m.data(), dx.data(), dy.data(), dz.data(), n, threads[run]);
+		}
+		else {
+			libmorton::parallel_encode3D(x.data(), y.data(), z.data(), m.data(), n, executors[run - 3]);
+			libmorton::parallel_decode3D(m.data(), dx.data(), dy.data(), dz.data(), n, executors[run - 3]);
+		}
+		for (size_t i = 0; i < n; i++) {
+			const morton correct = libmorton::m3D_e_magicbits<morton, coord>(x[i], y[i], z[i]);
+			if (m[i] != correct) {
+				std::cout << "\n    Incorrect parallel encoding of (" << x[i] << ", " << y[i] << ", " << z[i] << ") at index " << i << ": " << m[i] << " != " << correct << "\n";
+				ok = false;
+				break;
+			}
+			if (dx[i] != x[i] || dy[i] != y[i] || dz[i] != z[i]) {
+				printIncorrectDecoding3D<morton, coord>("parallel", m[i], dx[i], dy[i], dz[i], x[i], y[i], z[i]);
+				ok = false;
+				break;
+			}
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Build octrees over sorted codes of clustered random points (with duplicates), in both orders, on one thread and on an executor
+// with 3 threads, and check every node against the keys: all keys of a node share its cell, children split where the cell of
+// the next level changes, a node is a leaf exactly when it has at most leaf_capacity keys (or is a single cell), and so on
+template <typename morton, typename coord, size_t bits>
+inline bool check3D_OctreeCorrectness() {
+	printf("++ Checking correctness of 3D linear octrees (%zd bit) ... ", bits);
+	const unsigned int top = static_cast<unsigned int>(sizeof(morton) * 8) / 3;
+	const uint64_t maxcoord = (1ULL << (bits / 3)) - 1;
+	const libmorton::morton_executor three_threads = [](size_t count, const std::function<void(size_t)>& task) {
+		std::vector<std::thread> pool;
+		for (unsigned int t = 0; t < 3; t++) { pool.push_back(std::thread([&, t] { for (size_t i = t; i < count; i += 3) { task(i); } })); }
+		for (size_t t = 0; t < pool.size(); t++) { pool[t].join(); }
+	};
+	bool ok = true;
+	const size_t sizes[3] = { 1, 1000, 40000 };
+	const size_t capacities[2] = { 1, 8 };
+	for (unsigned int s = 0; s < 3; s++) {
+		std::vector<morton> keys(sizes[s]);
+		for (size_t i = 0; i < keys.size(); i++) {
+			// a few clusters of nearby points
+			const uint64_t cluster = (i % 5) * (maxcoord / 5);
+			const coord x = static_cast<coord>(cluster + rand() % 64), y = static_cast<coord>(cluster + rand() % 64), z = static_cast<coord>(rand() % 32);
+			keys[i] = libmorton::m3D_e_magicbits<morton, coord>(x, y, z);
+		}
+		std::sort(keys.begin(), keys.end());
+		for (unsigned int c = 0; c < 2; c++) {
+			for (unsigned int run = 0; run < 4; run++) {
+				const libmorton::morton_octree_order order = (run % 2) ? libmorton::morton_octree_order::depth_first : libmorton::morton_octree_order::breadth_first;
+				std::vector<libmorton::morton_octree_node> nodes;
+				const size_t count = (run < 2) ? libmorton::m3D_build_octree<morton>(keys.data(), keys.size(), capacities[c], nodes, order)
+					: libmorton::m3D_build_octree<morton>(keys.data(), keys.size(), capacities[c], nodes, order, three_threads);
+				bool good = (count == nodes.size()) && !nodes.empty() && nodes[0].first == 0 && nodes[0].last == keys.size() - 1
+					&& nodes[0].level == top && nodes[0].parent == libmorton::morton_octree_none;
+				std::vector<size_t> covered(nodes.size(), 0), children(nodes.size(), 0);
+				for (size_t j = 0; j < nodes.size() && good; j++) {
+					const libmorton::morton_octree_node& node = nodes[j];
+					const unsigned int shift = 3 * node.level;
+					good &= node.first <= node.last && node.last < keys.size();
+					good &= (shift >= sizeof(morton) * 8) || (keys[node.first] >> shift) == (keys[node.last] >> shift);
+					const bool leaf = (node.first_child == libmorton::morton_octree_none);
+					good &= leaf == (node.last - node.first < capacities[c] || node.level == 0);
+					good &= leaf == (node.child_mask == 0);
+					if (order == libmorton::morton_octree_order::depth_first) { good &= leaf || node.first_child == j + 1; }
+					else { good &= j == 0 || nodes[j - 1].level >= node.level; }
+					if (j == 0) { continue; }
+					const libmorton::morton_octree_node& parent = nodes[node.parent];
+					good &= node.parent < j && parent.level == node.level + 1;
+					good &= parent.first <= node.first && node.last <= parent.last;
+					good &= (parent.child_mask >> ((keys[node.first] >> shift) & 7)) & 1;
+					// the next key belongs to another cell of this level
+					good &= node.last == parent.last || (keys[node.last] >> shift) != (keys[node.last + 1] >> shift);
+					covered[node.parent] += node.last - node.first + 1;
+					children[node.parent]++;
+				}
+				for (size_t j = 0; j < nodes.size() && good; j++) {
+					if (nodes[j].first_child == libmorton::morton_octree_none) { continue; }
+					unsigned int octants = 0;
+					for (unsigned int mask = nodes[j].child_mask; mask; mask &= mask - 1) { octants++; }
+					good &= covered[j] == nodes[j].last - nodes[j].first + 1 && children[j] == octants;
+				}
+				if (!good) {
+					std::cout << "\n    Incorrect octree over " << keys.size() << " keys with leaf capacity " << capacities[c] << " (run " << run << ")\n";
+					ok = false;
+				}
+			}
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Build hierarchies over sorted codes of random points (with duplicates) on one thread and on an executor with 3 threads, and
+// check them against the keys: every key is a leaf reached once from the root in key order, every internal node splits its range
+// where the common prefix (with the index as tie-breaker) of its first and last key ends, and its box holds exactly its leaves
+template <typename morton, typename coord, size_t bits>
+inline bool check3D_BVHCorrectness() {
+	printf("++ Checking correctness of 3D bounding volume hierarchies (%zd bit) ... ", bits);
+	const libmorton::morton_executor three_threads = [](size_t count, const std::function<void(size_t)>& task) {
+		std::vector<std::thread> pool;
+		for (unsigned int t = 0; t < 3; t++) { pool.push_back(std::thread([&, t] { for (size_t i = t; i < count; i += 3) { task(i); } })); }
+		for (size_t t = 0; t < pool.size(); t++) { pool[t].join(); }
+	};
+	// common prefix of keys a and b with the index as tie-breaker, as a 128-bit number compared by its leading zeros
+	const auto prefix = [](const std::vector<morton>& keys, size_t a, size_t b) {
+		const morton x = keys[a] ^ keys[b];
+		int length = 0;
+		for (int bit = static_cast<int>(sizeof(morton) * 8) - 1; bit >= 0 && !((x >> bit) & 1); bit--) { length++; }
+		if (x == 0) { for (int bit = 63; bit >= 0 && !(((static_cast<uint64_t>(a) ^ b) >> bit) & 1); bit--) { length++; } }
+		return length;
+	};
+	bool ok = true;
+	const size_t sizes[4] = { 1, 2, 1000, 40000 };
+	for (unsigned int s = 0; s < 4; s++) {
+		const size_t n = sizes[s];
+		std::vector<morton> keys(n);
+		std::vector<libmorton::morton_aabb> boxes(n);
+		for (size_t i = 0; i < n; i++) {
+			const coord x = static_cast<coord>(rand() % 200), y = static_cast<coord>(rand() % 200), z = static_cast<coord>(rand() % 200);
+			keys[i] = libmorton::m3D_e_magicbits<morton, coord>(x, y, z);
+		}
+		std::sort(keys.begin(), keys.end());
+		for (size_t i = 0; i < n; i++) {
+			coord x, y, z;
+			libmorton::m3D_d_magicbits<morton, coord>(keys[i], x, y, z);
+			const libmorton::morton_aabb box = { { x - 0.5f, y - 0.5f, z - 0.5f }, { x + 0.5f, y + 0.5f, z + 1.5f } };
+			boxes[i] = box;
+		}
+		for (unsigned int run = 0; run < 2; run++) {
+			libmorton::morton_bvh bvh;
+			const size_t internal = (run == 0) ? libmorton::m3D_build_bvh<morton>(keys.data(), n, bvh) : libmorton::m3D_build_bvh<morton>(keys.data(), n, bvh, three_threads);
+			if (run == 0) { libmorton::m3D_refit_bvh(bvh, boxes.data()); }
+			else { libmorton::m3D_refit_bvh(bvh, boxes.data(), three_threads); }
+			bool good = internal == n - 1 && bvh.nodes.size() == n - 1 && bvh.leaf_parent.size() == n;
+			if (good && n > 1) {
+				good &= bvh.nodes[0].parent == libmorton::morton_bvh_none;
+				// walk the tree depth-first, left to right: the leaves have to come in key order
+				struct item { size_t child; size_t parent; };
+				std::vector<item> stack(1, item{ 0, libmorton::morton_bvh_none });
+				size_t next_leaf = 0, visited = 0;
+				std::vector<size_t> first(n - 1), last(n - 1);
+				std::vector<size_t> order;
+				while (!stack.empty() && good) {
+					const item it = stack.back();
+					stack.pop_back();
+					if (it.child & libmorton::morton_bvh_leaf) {
+						const size_t leaf = it.child & ~libmorton::morton_bvh_leaf;
+						good &= leaf == next_leaf++ && bvh.leaf_parent[leaf] == it.parent;
+						continue;
+					}
+					good &= it.child < n - 1 && bvh.nodes[it.child].parent == it.parent && visited++ < n - 1;
+					order.push_back(it.child);
+					stack.push_back(item{ bvh.nodes[it.child].right, it.child });
+					stack.push_back(item{ bvh.nodes[it.child].left, it.child });
+				}
+				good &= next_leaf == n && visited == n - 1;
+				// ranges and boxes, bottom-up
+				for (size_t k = order.size(); k-- > 0 && good;) {
+					const libmorton::morton_bvh_node& node = bvh.nodes[order[k]];
+					const bool left_leaf = (node.left & libmorton::morton_bvh_leaf) != 0, right_leaf = (node.right & libmorton::morton_bvh_leaf) != 0;
+					const size_t l = node.left & ~libmorton::morton_bvh_leaf, r = node.right & ~libmorton::morton_bvh_leaf;
+					const size_t split = left_leaf ? l : last[l];
+					first[order[k]] = left_leaf ? l : first[l];
+					last[order[k]] = right_leaf ? r : last[r];
+					good &= split + 1 == (right_leaf ? r : first[r]);
+					good &= prefix(keys, first[order[k]], last[order[k]]) == prefix(keys, split, split + 1);
+					libmorton::morton_aabb expected = boxes[first[order[k]]];
+					for (size_t i = first[order[k]]; i <= last[order[k]]; i++) {
+						for (int axis = 0; axis < 3; axis++) {
+							expected.min[axis] = std::min(expected.min[axis], boxes[i].min[axis]);
+							expected.max[axis] = std::max(expected.max[axis], boxes[i].max[axis]);
+						}
+					}
+					if (last[order[k]] - first[order[k]] < 64 || order[k] == 0) {
+						for (int axis = 0; axis < 3; axis++) {
+							good &= node.bounds.min[axis] == expected.min[axis] && node.bounds.max[axis] == expected.max[axis];
+						}
+					}
+				}
+			}
+			if (!good) {
+				std::cout << "\n    Incorrect hierarchy over " << n << " keys (run " << run << ")\n";
+				ok = false;
+			}
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Control 3D Hilbert encoder: one level at a time with the state machine of the LUT generator
+inline uint64_t control_hilbert_encode(unsigned int levels, uint64_t x, uint64_t y, uint64_t z) {
+	libmorton::hilbert_state state = { 0, 0 };
+	uint64_t h = 0;
+	for (unsigned int level = levels; level-- > 0;) {
+		const unsigned int digit = static_cast<unsigned int>(((x >> level) & 1) | (((y >> level) & 1) << 1) | (((z >> level) & 1) << 2));
+		h = (h << 3) | libmorton::hilbertStep(3, state, digit, true);
+	}
+	return h;
+}
+
+// Check the 3D Hilbert encoder/decoder against the control encoder, the curve for continuity (consecutive codes are
+// neighbouring cells) and the batch methods against the scalar ones. The batch size isn't a multiple of the block size.
+template <typename morton, typename coord, size_t bits, typename batch_morton, typename batch_coord>
+inline bool check3D_HilbertCorrectness(morton(*encode)(coord, coord, coord), void(*decode)(morton, coord&, coord&, coord&),
+	void(*encode_batch)(const batch_coord*, const batch_coord*, const batch_coord*, batch_morton*, size_t),
+	void(*decode_batch)(const batch_morton*, batch_coord*, batch_coord*, batch_coord*, size_t)) {
+	printf("++ Checking correctness of 3D Hilbert encoding/decoding (%zd bit) ... ", bits);
+	const unsigned int levels = bits / 3;
+	const uint64_t maxcoord = (1ULL << levels) - 1;
+	const uint64_t maxcode = (1ULL << (3 * levels)) - 1;
+	bool ok = true;
+	// the curve starts at the origin and ends in the corner on the x axis
+	coord x, y, z;
+	decode(0, x, y, z);
+	ok &= (x == 0 && y == 0 && z == 0);
+	decode(static_cast<morton>(maxcode), x, y, z);
+	ok &= (x == maxcoord && y == 0 && z == 0);
+	if (!ok) { std::cout << "\n    Incorrect start or end of the curve\n"; }
+	for (unsigned int i = 0; i < 1000 && ok; i++) {
+		const coord px = static_cast<coord>(((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord);
+		const coord py = static_cast<coord>(((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord);
+		const coord pz = static_cast<coord>(((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord);
+		const morton h = encode(px, py, pz);
+		const uint64_t correct = control_hilbert_encode(levels, px, py, pz);
+		if (h != correct) {
+			std::cout << "\n    Incorrect Hilbert encoding of (" << px << ", " << py << ", " << pz << "): " << h << " != " << correct << "\n";
+			ok = false;
+		}
+		decode(h, x, y, z);
+		if (x != px || y != py || z != pz) {
+			printIncorrectDecoding3D<morton, coord>("Hilbert", h, x, y, z, px, py, pz);
+			ok = false;
+		}
+		// a stretch of the curve from a random code
+		uint64_t start = ((static_cast<uint64_t>(rand()) << 48) ^ (static_cast<uint64_t>(rand()) << 32) ^ (static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcode;
+		start = std::min<uint64_t>(start, maxcode - 16);
+		decode(static_cast<morton>(start), x, y, z);
+		for (uint64_t c = start + 1; c <= start + 16 && ok; c++) {
+			coord nx, ny, nz;
+			decode(static_cast<morton>(c), nx, ny, nz);
+			const uint64_t distance = ((nx > x) ? nx - x : x - nx) + ((ny > y) ? ny - y : y - ny) + ((nz > z) ? nz - z : z - nz);
+			if (distance != 1) {
+				std::cout << "\n    Hilbert codes " << (c - 1) << " and " << c << " aren't neighbouring cells\n";
+				ok = false;
+			}
+			x = nx;
+			y = ny;
+			z = nz;
+		}
+	}
+	const size_t n = 3000;
+	std::vector<batch_coord> bx(n), by(n), bz(n), dx(n), dy(n), dz(n);
+	std::vector<batch_morton> h(n);
+	for (size_t i = 0; i < n; i++) {
+		bx[i] = static_cast<batch_coord>(((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord);
+		by[i] = static_cast<batch_coord>(((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord);
+		bz[i] = static_cast<batch_coord>(((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord);
+	}
+	encode_batch(bx.data(), by.data(), bz.data(), h.data(), n);
+	decode_batch(h.data(), dx.data(), dy.data(), dz.data(), n);
+	for (size_t i = 0; i < n && ok; i++) {
+		if (h[i] != encode(bx[i], by[i], bz[i]) || dx[i] != bx[i] || dy[i] != by[i] || dz[i] != bz[i]) {
+			std::cout << "\n    Incorrect Hilbert batch encoding/decoding of (" << bx[i] << ", " << by[i] << ", " << bz[i] << ") at index " << i << "\n";
+			ok = false;
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check the 3D Morton-ordered grid: coordinate access against the array position of the encoded cell, and both
+// iteration orders against a plain Cartesian loop (the Cartesian iterator has to keep its code in step with its coordinates)
+inline bool check3D_GridCorrectness() {
+	printf("++ Checking correctness of 3D Morton-ordered grids ... ");
+	bool ok = true;
+	for (unsigned int level = 0; level <= 5 && ok; level++) {
+		libmorton::morton_grid<uint32_t, 3> grid(level);
+		const uint_fast32_t extent = grid.extent();
+		ok &= (grid.size() == static_cast<size_t>(extent) * extent * extent);
+		uint32_t value = 0;
+		for (uint_fast32_t z = 0; z < extent; z++) {
+			for (uint_fast32_t y = 0; y < extent; y++) {
+				for (uint_fast32_t x = 0; x < extent; x++) {
+					grid(x, y, z) = value;
+					ok &= (grid.data()[libmorton::m3D_e_magicbits<uint_fast64_t, uint_fast32_t>(x, y, z)] == value);
+					value++;
+				}
+			}
+		}
+		// Morton order: the array, every code once
+		std::vector<bool> seen(grid.size(), false);
+		size_t count = 0;
+		for (libmorton::morton_grid<uint32_t, 3>::const_iterator it = grid.begin(); it != grid.end(); ++it, ++count) {
+			ok &= (*it < seen.size()) && !seen[*it];
+			if (*it < seen.size()) { seen[*it] = true; }
+		}
+		ok &= (count == grid.size());
+		// Cartesian order: the values come out in the order they were written
+		const libmorton::morton_grid<uint32_t, 3>& cgrid = grid;
+		value = 0;
+		for (libmorton::morton_grid<uint32_t, 3>::const_cartesian_iterator it = cgrid.cartesian_begin(); it != cgrid.cartesian_end() && ok; ++it, ++value) {
+			const uint_fast32_t x = value % extent, y = (value / extent) % extent, z = value / extent / extent;
+			ok &= (*it == value) && it.x() == x && it.y() == y && it.z() == z && it.code() == libmorton::morton_grid<uint32_t, 3>::code(x, y, z);
+		}
+		ok &= (value == grid.size());
+		for (libmorton::morton_grid<uint32_t, 3>::cartesian_iterator it = grid.cartesian_begin(); it != grid.cartesian_end(); it++) { *it += 1; }
+		ok &= (grid(extent - 1, 0, 0) == extent);
+		if (!ok) { std::cout << "\n    Incorrect grid of level " << level << "\n"; }
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check the constexpr encoders and decode helpers: a static table of codes computed at compile time by every encoder,
+// checked against the control encoder and decoded again at run time
+template <typename morton, typename coord, size_t bits>
+inline bool check3D_ConstexprCorrectness() {
+	printf("++ Checking correctness of 3D compile time encode/decode (%zd bit) ... ", bits);
+	static constexpr coord top = static_cast<coord>((static_cast<uint_fast64_t>(1) << (bits / 3)) - 1);
+	static constexpr coord points[4][3] = { { 0, 0, 0 }, { 1, 2, 3 }, { top, 0, top / 2 }, { top, top, top } };
+	static constexpr morton table[4][4] = {
+		{ libmorton::m3D_e_magicbits<morton, coord>(points[0][0], points[0][1], points[0][2]), libmorton::m3D_e_for<morton, coord>(points[0][0], points[0][1], points[0][2]),
+			libmorton::m3D_e_sLUT<morton, coord>(points[0][0], points[0][1], points[0][2]), libmorton::m3D_e_LUT<morton, coord>(points[0][0], points[0][1], points[0][2]) },
+		{ libmorton::m3D_e_magicbits<morton, coord>(points[1][0], points[1][1], points[1][2]), libmorton::m3D_e_for<morton, coord>(points[1][0], points[1][1], points[1][2]),
+			libmorton::m3D_e_sLUT<morton, coord>(points[1][0], points[1][1], points[1][2]), libmorton::m3D_e_LUT<morton, coord>(points[1][0], points[1][1], points[1][2]) },
+		{ libmorton::m3D_e_magicbits<morton, coord>(points[2][0], points[2][1], points[2][2]), libmorton::m3D_e_for<morton, coord>(points[2][0], points[2][1], points[2][2]),
+			libmorton::m3D_e_sLUT<morton, coord>(points[2][0], points[2][1], points[2][2]), libmorton::m3D_e_LUT<morton, coord>(points[2][0], points[2][1], points[2][2]) },
+		{ libmorton::m3D_e_magicbits<morton, coord>(points[3][0], points[3][1], points[3][2]), libmorton::m3D_e_for<morton, coord>(points[3][0], points[3][1], points[3][2]),
+			libmorton::m3D_e_sLUT<morton, coord>(points[3][0], points[3][1], points[3][2]), libmorton::m3D_e_LUT<morton, coord>(points[3][0], points[3][1], points[3][2]) }
+	};
+	static_assert(table[1][0] == 0x35 && table[1][1] == 0x35 && table[1][2] == 0x35 && table[1][3] == 0x35, "compile time encode of (1, 2, 3)");
+	static_assert(libmorton::morton3D_GetThirdBits<morton, coord>(table[3][0] >> 1) == top, "compile time magic bits decode");
+	static_assert(libmorton::morton3D_DecodeCoord_for<morton, coord>(table[2][0], 2) == top / 2, "compile time for loop decode");
+	static_assert(libmorton::morton3D_DecodeCoord_LUT256<morton, coord>(table[2][0], libmorton::Morton3D_decode_z_512, 0) == top / 2, "compile time LUT decode");
+	bool ok = true;
+	for (unsigned int i = 0; i < 4; i++) {
+		const morton correct = static_cast<morton>(control_encode(static_cast<uint64_t>(points[i][0]), static_cast<uint64_t>(points[i][1]), static_cast<uint64_t>(points[i][2])));
+		for (unsigned int method = 0; method < 4; method++) { ok &= (table[i][method] == correct); }
+		coord x, y, z;
+		libmorton::m3D_d_magicbits<morton, coord>(correct, x, y, z);
+		ok &= (x == points[i][0] && y == points[i][1] && z == points[i][2]);
+		libmorton::m3D_d_for<morton, coord>(correct, x, y, z);
+		ok &= (x == points[i][0] && y == points[i][1] && z == points[i][2]);
+		if (!ok) { std::cout << "\n    Incorrect compile time code of (" << points[i][0] << ", " << points[i][1] << ", " << points[i][2] << ")\n"; break; }
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Exact-width morton.h functions, by code type
+inline uint32_t exact3D_encode(const uint16_t x, const uint16_t y, const uint16_t z) { return libmorton::exact::morton3D_32_encode(x, y, z); }
+inline uint64_t exact3D_encode(const uint32_t x, const uint32_t y, const uint32_t z) { return libmorton::exact::morton3D_64_encode(x, y, z); }
+inline void exact3D_decode(const uint32_t m, uint16_t& x, uint16_t& y, uint16_t& z) { libmorton::exact::morton3D_32_decode(m, x, y, z); }
+inline void exact3D_decode(const uint64_t m, uint32_t& x, uint32_t& y, uint32_t& z) { libmorton::exact::morton3D_64_decode(m, x, y, z); }
+
+// Check the exact-width types (uint32_t codes of uint16_t coordinates, uint64_t codes of uint32_t coordinates): the exact
+// morton.h functions and the LUT, magic bits and for loop methods against the control encoder, and the size of the LUTs
+template <typename morton, typename coord, size_t bits>
+inline bool check3D_ExactWidthCorrectness() {
+	printf("++ Checking correctness of 3D exact-width encode/decode (%zd bit) ... ", bits);
+	static_assert(sizeof(libmorton::Morton3D_encode_x_256) == 256 * sizeof(uint32_t) && sizeof(libmorton::Morton3D_decode_x_512) == 512, "LUTs in the narrowest type that fits");
+	const uint64_t fieldmask = (1ULL << (bits / 3)) - 1;
+	bool ok = true;
+	for (unsigned int i = 0; i < 10000 && ok; i++) {
+		// mix in the edges of the range
+		const coord x = static_cast<coord>(((i % 7 == 0) ? ~0ULL : static_cast<uint64_t>(rand()) << 16 ^ rand()) & fieldmask);
+		const coord y = static_cast<coord>(((i % 7 == 1) ? ~0ULL : static_cast<uint64_t>(rand()) << 16 ^ rand()) & fieldmask);
+		const coord z = static_cast<coord>(((i % 7 == 2) ? ~0ULL : static_cast<uint64_t>(rand()) << 16 ^ rand()) & fieldmask);
+		const morton correct = static_cast<morton>(control_encode(static_cast<uint64_t>(x), static_cast<uint64_t>(y), static_cast<uint64_t>(z)));
+		const morton codes[7] = { exact3D_encode(x, y, z),
+			libmorton::m3D_e_sLUT<morton, coord>(x, y, z),
+			libmorton::m3D_e_LUT<morton, coord>(x, y, z),
+			libmorton::m3D_e_sLUT_ET<morton, coord>(x, y, z),
+			libmorton::m3D_e_LUT_ET<morton, coord>(x, y, z),
+			libmorton::m3D_e_magicbits<morton, coord>(x, y, z),
+			libmorton::m3D_e_for<morton, coord>(x, y, z) };
+		coord d[7][3];
+		exact3D_decode(correct, d[0][0], d[0][1], d[0][2]);
+		libmorton::m3D_d_sLUT<morton, coord>(correct, d[1][0], d[1][1], d[1][2]);
+		libmorton::m3D_d_LUT<morton, coord>(correct, d[2][0], d[2][1], d[2][2]);
+		libmorton::m3D_d_sLUT_ET<morton, coord>(correct, d[3][0], d[3][1], d[3][2]);
+		libmorton::m3D_d_LUT_ET<morton, coord>(correct, d[4][0], d[4][1], d[4][2]);
+		libmorton::m3D_d_magicbits<morton, coord>(correct, d[5][0], d[5][1], d[5][2]);
+		libmorton::m3D_d_for<morton, coord>(correct, d[6][0], d[6][1], d[6][2]);
+		for (unsigned int j = 0; j < 7; j++) { ok &= (codes[j] == correct) && d[j][0] == x && d[j][1] == y && d[j][2] == z; }
+		if (!ok) { std::cout << "\n    Incorrect exact-width encode/decode of code " << correct << "\n"; }
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check the 3D box iterator against the sorted codes of every cell in random boxes, one code at a time,
+// and in runs against the exact box intervals (the runs have to be the maximal runs of codes inside the box)
+template <typename morton, typename coord, size_t bits>
+inline bool check3D_BoxIteratorCorrectness() {
+	printf("++ Checking correctness of 3D box iterators (%zd bit) ... ", bits);
+	const unsigned int fieldbits = bits / 3;
+	const uint64_t maxcoord = (fieldbits == 64) ? ~0ULL : (1ULL << fieldbits) - 1;
+	bool ok = true;
+	std::vector<libmorton::morton_interval<morton> > intervals;
+	for (unsigned int t = 0; t < 200 && ok; t++) {
+		// a box of up to 8 cells per axis anywhere in the coordinate range
+		coord lo[3], hi[3];
+		for (unsigned int axis = 0; axis < 3; axis++) {
+			const uint64_t base = (t % 4 == 0) ? 0 : (((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord);
+			lo[axis] = static_cast<coord>(std::min<uint64_t>(base, maxcoord - 7));
+			hi[axis] = static_cast<coord>(lo[axis] + rand() % 8);
+		}
+		const morton zmin = libmorton::m3D_e_magicbits<morton, coord>(lo[0], lo[1], lo[2]);
+		const morton zmax = libmorton::m3D_e_magicbits<morton, coord>(hi[0], hi[1], hi[2]);
+		std::vector<morton> inside;
+		for (coord z = lo[2]; z <= hi[2]; z++) {
+			for (coord y = lo[1]; y <= hi[1]; y++) {
+				for (coord x = lo[0]; x <= hi[0]; x++) {
+					inside.push_back(libmorton::m3D_e_magicbits<morton, coord>(x, y, z));
+				}
+			}
+		}
+		std::sort(inside.begin(), inside.end());
+		libmorton::morton_box_iterator<morton> it = libmorton::m3D_box_iterator<morton>(zmin, zmax);
+		size_t k = 0;
+		for (; !it.done() && k < inside.size(); ++it, k++) { ok &= (*it == inside[k]); }
+		ok &= it.done() && k == inside.size();
+		libmorton::m3D_box_intervals<morton>(zmin, zmax, 0, intervals);
+		libmorton::morton_interval<morton> run = { 0, 0 };
+		it = libmorton::m3D_box_iterator<morton>(zmin, zmax);
+		k = 0;
+		for (; it.next_run(run) && k < intervals.size(); k++) { ok &= (run.lo == intervals[k].lo && run.hi == intervals[k].hi); }
+		ok &= it.done() && k == intervals.size();
+		if (!ok) { std::cout << "\n    Incorrect walk over box [" << zmin << ", " << zmax << "]\n"; }
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check the 3D hierarchy methods against shifting the coordinates: the parent, the children and the descendants of a cell,
+// and the level of the common ancestor of two codes (and the same cell predicate) against the coordinates they share
+template <typename morton, typename coord, size_t bits>
+inline bool check3D_HierarchyCorrectness() {
+	printf("++ Checking correctness of 3D hierarchy methods (%zu bit) ... ", bits);
+	const unsigned int fieldbits = bits / 3;
+	const uint64_t maxcoord = (1ULL << fieldbits) - 1;
+	bool ok = true;
+	const size_t n = 256;
+	std::vector<morton> a(n), b(n), batch(n);
+	std::vector<unsigned int> levels(n);
+	std::vector<libmorton::morton_interval<morton> > ranges(n);
+	bool same[n];
+	for (unsigned int t = 0; t < 20 && ok; t++) {
+		const unsigned int level = t % (fieldbits + 1);
+		const unsigned int depth = (t * 7) % (level + 1);
+		for (size_t i = 0; i < n && ok; i++) {
+			uint64_t p[3], q[3];
+			const unsigned int split = rand() % (fieldbits + 1);
+			for (unsigned int axis = 0; axis < 3; axis++) {
+				p[axis] = ((static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord;
+				q[axis] = p[axis] ^ (((static_cast<uint64_t>(rand()) << 16) ^ rand()) & ((1ULL << split) - 1));
+			}
+			a[i] = libmorton::m3D_e_magicbits<morton, uint64_t>(p[0], p[1], p[2]);
+			b[i] = libmorton::m3D_e_magicbits<morton, uint64_t>(q[0], q[1], q[2]);
+			const morton cell = libmorton::m3D_e_magicbits<morton, uint64_t>(p[0] >> level, p[1] >> level, p[2] >> level);
+			ok &= libmorton::m3D_parent<morton>(a[i], level) == cell;
+			// a cell at level 0 has no children inside the coordinate range
+			ok &= level == 0 || libmorton::m3D_first_child<morton>(cell) == libmorton::m3D_e_magicbits<morton, uint64_t>((p[0] >> level) << 1, (p[1] >> level) << 1, (p[2] >> level) << 1);
+			ok &= level == 0 || libmorton::m3D_last_child<morton>(cell) == libmorton::m3D_e_magicbits<morton, uint64_t>(((p[0] >> level) << 1) | 1, ((p[1] >> level) << 1) | 1, ((p[2] >> level) << 1) | 1);
+			const uint64_t low = (1ULL << depth) - 1;
+			const libmorton::morton_interval<morton> range = libmorton::m3D_descendants<morton>(cell, depth);
+			ok &= range.lo == libmorton::m3D_e_magicbits<morton, uint64_t>((p[0] >> level) << depth, (p[1] >> level) << depth, (p[2] >> level) << depth);
+			ok &= range.hi == libmorton::m3D_e_magicbits<morton, uint64_t>(((p[0] >> level) << depth) | low, ((p[1] >> level) << depth) | low, ((p[2] >> level) << depth) | low);
+			unsigned int common = 0;
+			while (((p[0] ^ q[0]) | (p[1] ^ q[1]) | (p[2] ^ q[2])) >> common) { common++; }
+			ok &= libmorton::m3D_common_ancestor_level<morton>(a[i], b[i]) == common;
+			ok &= libmorton::m3D_same_cell<morton>(a[i], b[i], level) == (level >= common);
+			if (!ok) { std::cout << "\n    Incorrect hierarchy of codes " << a[i] << " and " << b[i] << " at level " << level << "\n"; }
+		}
+		// the batch methods against the scalar ones, in place for the ones returning codes
+		libmorton::m3D_common_ancestor_level<morton>(a.data(), b.data(), levels.data(), n);
+		libmorton::m3D_same_cell<morton>(a.data(), b.data(), same, n, level);
+		for (size_t i = 0; i < n; i++) {
+			ok &= levels[i] == libmorton::m3D_common_ancestor_level<morton>(a[i], b[i]) && same[i] == libmorton::m3D_same_cell<morton>(a[i], b[i], level);
+		}
+		libmorton::m3D_parent<morton>(a.data(), batch.data(), n, level);
+		libmorton::m3D_descendants<morton>(batch.data(), ranges.data(), n, depth);
+		for (size_t i = 0; i < n; i++) {
+			const libmorton::morton_interval<morton> range = libmorton::m3D_descendants<morton>(libmorton::m3D_parent<morton>(a[i], level), depth);
+			ok &= batch[i] == libmorton::m3D_parent<morton>(a[i], level) && ranges[i].lo == range.lo && ranges[i].hi == range.hi;
+		}
+		libmorton::m3D_first_child<morton>(batch.data(), b.data(), n);
+		libmorton::m3D_last_child<morton>(batch.data(), batch.data(), n);
+		for (size_t i = 0; i < n; i++) {
+			const morton cell = libmorton::m3D_parent<morton>(a[i], level);
+			ok &= b[i] == libmorton::m3D_first_child<morton>(cell) && batch[i] == libmorton::m3D_last_child<morton>(cell);
+		}
+		if (!ok) { std::cout << "\n    Incorrect batch hierarchy methods at level " << level << "\n"; }
+	}
+	// levels past the top of the code
+	ok &= libmorton::m3D_parent<morton>(static_cast<morton>(~static_cast<morton>(0)), bits / 3 + 1) == 0;
+	ok &= libmorton::m3D_same_cell<morton>(0, static_cast<morton>(~static_cast<morton>(0)), bits / 3 + 1);
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Check the 3D 128-bit methods against a bit by bit encoder, and decode what they encode. Also checks the dilated arithmetic,
+// the box iterator, the box intervals, the box scan and the sort on 128-bit codes.
+inline bool check3D_128Correctness() {
+	printf("++ Checking correctness of 3D encode/decode (128 bit) ... ");
+	using libmorton::morton128_t;
+	typedef morton128_t(*encoder)(uint_fast64_t, uint_fast64_t, uint_fast64_t);
+	typedef void(*decoder)(morton128_t, uint_fast64_t&, uint_fast64_t&, uint_fast64_t&);
+	std::vector<encoder> encoders = { &libmorton::morton3D_128_encode, &libmorton::m3D_e_magicbits_128, &libmorton::m3D_e_sLUT_128 };
+	std::vector<decoder> decoders = { &libmorton::morton3D_128_decode, &libmorton::m3D_d_magicbits_128, &libmorton::m3D_d_sLUT_128 };
+#if defined(__BMI2__) || defined(__AVX2__)
+	encoders.push_back(&libmorton::m3D_e_BMI_128);
+	decoders.push_back(&libmorton::m3D_d_BMI_128);
+#elif defined(LIBMORTON_RUNTIME_DISPATCH)
+	if (libmorton::dispatch_detail::detect_cpu_features().bmi2) {
+		encoders.push_back(&libmorton::m3D_e_BMI_128);
+		decoders.push_back(&libmorton::m3D_d_BMI_128);
+	}
+#endif
+	const uint64_t maxcoord = (1ULL << 42) - 1;
+	const auto control = [](const uint_fast64_t* c) {
+		morton128_t m = 0;
+		for (unsigned int bit = 0; bit < 42; bit++) {
+			for (unsigned int axis = 0; axis < 3; axis++) { m |= static_cast<morton128_t>((c[axis] >> bit) & 1) << (bit * 3 + axis); }
+		}
+		return m;
+	};
+	bool ok = true;
+	for (unsigned int i = 0; i < 10000 && ok; i++) {
+		uint_fast64_t c[3], d[3];
+		for (unsigned int axis = 0; axis < 3; axis++) {
+			// mix in the edges of the range, and of the lower half of the coordinates
+			c[axis] = (i % 7 == 0) ? maxcoord : ((i % 5 == 0) ? (1ULL << 21) - 1 : ((static_cast<uint64_t>(rand()) << 32) ^ (static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord);
+		}
+		const morton128_t correct = control(c);
+		for (size_t f = 0; f < encoders.size(); f++) {
+			ok &= (encoders[f](c[0], c[1], c[2]) == correct);
+			decoders[f](correct, d[0], d[1], d[2]);
+			ok &= (d[0] == c[0] && d[1] == c[1] && d[2] == c[2]);
+		}
+		for (unsigned int axis = 0; axis < 3; axis++) {
+			morton128_t (*const inc[3])(const morton128_t) = { &libmorton::m3D_inc_x<morton128_t>, &libmorton::m3D_inc_y<morton128_t>, &libmorton::m3D_inc_z<morton128_t> };
+			morton128_t (*const dec[3])(const morton128_t) = { &libmorton::m3D_dec_x<morton128_t>, &libmorton::m3D_dec_y<morton128_t>, &libmorton::m3D_dec_z<morton128_t> };
+			uint_fast64_t e[3] = { c[0], c[1], c[2] };
+			e[axis] = (c[axis] + 1) & maxcoord;
+			ok &= (inc[axis](correct) == control(e));
+			e[axis] = (c[axis] - 1) & maxcoord;
+			ok &= (dec[axis](correct) == control(e));
+		}
+		if (!ok) { std::cout << "\n    Incorrect encode/decode of (" << c[0] << ", " << c[1] << ", " << c[2] << ")\n"; }
+	}
+	std::vector<libmorton::morton_interval<morton128_t> > intervals;
+	for (unsigned int t = 0; t < 50 && ok; t++) {
+		// a box of up to 8 cells per axis anywhere in the coordinate range
+		uint_fast64_t lo[3], hi[3];
+		for (unsigned int axis = 0; axis < 3; axis++) {
+			lo[axis] = std::min<uint64_t>(((static_cast<uint64_t>(rand()) << 32) ^ (static_cast<uint64_t>(rand()) << 16) ^ rand()) & maxcoord, maxcoord - 7);
+			hi[axis] = lo[axis] + rand() % 8;
+		}
+		const morton128_t zmin = libmorton::morton3D_128_encode(lo[0], lo[1], lo[2]);
+		const morton128_t zmax = libmorton::morton3D_128_encode(hi[0], hi[1], hi[2]);
+		std::vector<morton128_t> inside;
+		for (uint_fast64_t z = lo[2]; z <= hi[2]; z++) {
+			for (uint_fast64_t y = lo[1]; y <= hi[1]; y++) {
+				for (uint_fast64_t x = lo[0]; x <= hi[0]; x++) { inside.push_back(libmorton::morton3D_128_encode(x, y, z)); }
+			}
+		}
+		std::sort(inside.begin(), inside.end());
+		libmorton::morton_box_iterator<morton128_t> it = libmorton::m3D_box_iterator<morton128_t>(zmin, zmax);
+		size_t k = 0;
+		for (; !it.done() && k < inside.size(); ++it, k++) { ok &= (*it == inside[k]); }
+		ok &= it.done() && k == inside.size();
+		// every interval is a run of consecutive codes inside the box
+		libmorton::m3D_box_intervals<morton128_t>(zmin, zmax, 0, intervals);
+		k = 0;
+		for (size_t j = 0; j < intervals.size() && ok; j++) {
+			for (morton128_t m = intervals[j].lo; k < inside.size() && inside[k] == m; ++m, k++) {
+				if (m == intervals[j].hi) { break; }
+			}
+			ok &= (k < inside.size() && inside[k] == intervals[j].hi);
+			k++;
+		}
+		ok &= (k == inside.size());
+		// the box scan finds the cells of the box between random keys
+		std::vector<morton128_t> keys(inside);
+		for (unsigned int j = 0; j < 1000; j++) { keys.push_back(libmorton::morton128_make(static_cast<uint64_t>(rand()) << 32 ^ rand(), static_cast<uint64_t>(rand()) << 32 ^ rand())); }
+		std::sort(keys.begin(), keys.end());
+		size_t hits = 0;
+		for (size_t j = 0; j < keys.size(); j++) {
+			uint_fast64_t p[3];
+			libmorton::morton3D_128_decode(keys[j], p[0], p[1], p[2]);
+			hits += (p[0] >= lo[0] && p[0] <= hi[0] && p[1] >= lo[1] && p[1] <= hi[1] && p[2] >= lo[2] && p[2] <= hi[2]);
+		}
+		ok &= (libmorton::m3D_box_scan<morton128_t>(keys.data(), keys.size(), zmin, zmax, [](size_t, size_t) {}) == hits);
+		if (!ok) { std::cout << "\n    Incorrect walk over box (" << lo[0] << ", " << lo[1] << ", " << lo[2] << ") - (" << hi[0] << ", " << hi[1] << ", " << hi[2] << ")\n"; }
+	}
+	// radix sort on all 16 digits
+	std::vector<morton128_t> keys(100000);
+	for (size_t i = 0; i < keys.size(); i++) { keys[i] = libmorton::morton128_make(static_cast<uint64_t>(rand()) << 32 ^ rand(), static_cast<uint64_t>(rand()) << 32 ^ rand()); }
+	std::vector<morton128_t> sorted(keys);
+	std::sort(sorted.begin(), sorted.end());
+	libmorton::morton_sort(keys.data(), keys.size(), 2);
+	if (ok && keys != sorted) {
+		std::cout << "\n    Incorrect sort of 128-bit codes\n";
+		ok = false;
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
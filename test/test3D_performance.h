@@ -12,6 +12,56 @@ extern std::vector<uint_fast64_t> running_sums;
 
 
 
+// CONTROL: Magic bits with the masks loaded from memory, like the mask tables in morton3D.h were before they became
+// constexpr, whenever the compiler couldn't prove they never change (the volatile pointer keeps it from folding them here).
+// Timed next to "Magicbits" (masks as immediates), the difference is the cost of the loads.
+static uint_fast64_t control3D_masks64_table[6] = { 0x1fffff, 0x1f00000000ffff, 0x1f0000ff0000ff, 0x100f00f00f00f00f, 0x10c30c30c30c30c3, 0x1249249249249249 };
+static const uint_fast64_t* volatile control3D_masks64 = control3D_masks64_table;
+
+static uint_fast64_t control3D_SplitBy3bits_loads(const uint_fast32_t a) {
+	const uint_fast64_t* masks = control3D_masks64;
+	uint_fast64_t x = a & masks[0];
+	x = (x | x << 32) & masks[1];
+	x = (x | x << 16) & masks[2];
+	x = (x | x << 8) & masks[3];
+	x = (x | x << 4) & masks[4];
+	x = (x | x << 2) & masks[5];
+	return x;
+}
+
+static uint_fast32_t control3D_GetThirdBits_loads(const uint_fast64_t m) {
+	const uint_fast64_t* masks = control3D_masks64;
+	uint_fast64_t x = m & masks[5];
+	x = (x ^ (x >> 2)) & masks[4];
+	x = (x ^ (x >> 4)) & masks[3];
+	x = (x ^ (x >> 8)) & masks[2];
+	x = (x ^ (x >> 16)) & masks[1];
+	x = (x ^ (x >> 32)) & masks[0];
+	return static_cast<uint_fast32_t>(x);
+}
+
+static uint_fast64_t control3D_e_magicbits_loads(const uint_fast32_t x, const uint_fast32_t y, const uint_fast32_t z) {
+	return control3D_SplitBy3bits_loads(x) | (control3D_SplitBy3bits_loads(y) << 1) | (control3D_SplitBy3bits_loads(z) << 2);
+}
+
+static void control3D_d_magicbits_loads(const uint_fast64_t m, uint_fast32_t& x, uint_fast32_t& y, uint_fast32_t& z) {
+	x = control3D_GetThirdBits_loads(m);
+	y = control3D_GetThirdBits_loads(m >> 1);
+	z = control3D_GetThirdBits_loads(m >> 2);
+}
+
+// Exact-width (uint32_t / uint16_t) LUT methods, timed next to the uint_fast ones: where uint_fast16_t / uint_fast32_t are
+// 8 bytes, those do lookups for bytes a 32-bit code has no room for
+static uint_fast32_t exact3D_32_e_sLUT(const uint_fast16_t x, const uint_fast16_t y, const uint_fast16_t z) {
+	return libmorton::m3D_e_sLUT<uint32_t, uint16_t>(static_cast<uint16_t>(x), static_cast<uint16_t>(y), static_cast<uint16_t>(z));
+}
+
+static void exact3D_32_d_sLUT(const uint_fast32_t m, uint_fast16_t& x, uint_fast16_t& y, uint_fast16_t& z) {
+	uint16_t ex, ey, ez;
+	libmorton::m3D_d_sLUT<uint32_t, uint16_t>(static_cast<uint32_t>(m), ex, ey, ez);
+	x = ex; y = ey; z = ez;
+}
+
 // Test performance of encoding a linearly increasing set of coordinates
 template <typename morton, typename coord>
 static double testEncode_3D_Linear_Perf(morton(*function)(coord, coord, coord), size_t times) {
@@ -35,7 +85,7 @@ static double testEncode_3D_Linear_Perf(morton(*function)(coord, coord, coord),
 		}
 	}
 	timer.stop();
-	running_sums.push_back(runningsum);
+	running_sums.push_back(static_cast<uint_fast64_t>(runningsum));
 	return timer.elapsed_time_milliseconds / (float)times;
 }
 
@@ -75,7 +125,7 @@ static double testEncode_3D_Random_Perf(morton(*function)(coord, coord, coord),
 		}
 	}
 	timer.stop();
-	running_sums.push_back(runningsum);
+	running_sums.push_back(static_cast<uint_fast64_t>(runningsum));
 	return timer.elapsed_time_milliseconds / (float)times;
 }
 
@@ -138,6 +188,189 @@ static double testDecode_3D_Random_Perf(void(*function)(const morton, coord&, co
 	return timer.elapsed_time_milliseconds / (float)times;
 }
 
+// Test performance of batch encoding a linearly increasing set of coordinates, one row of z at a time
+template <typename morton, typename coord>
+static double testEncode_3D_Batch_Linear_Perf(void(*function)(const coord*, const coord*, const coord*, morton*, size_t), size_t times) {
+	Timer timer = Timer();
+	morton runningsum = 0;
+	std::vector<coord> x(CURRENT_TEST_MAX), y(CURRENT_TEST_MAX), z(CURRENT_TEST_MAX);
+	std::vector<morton> result(CURRENT_TEST_MAX);
+	for (size_t k = 0; k < CURRENT_TEST_MAX; k++) {
+		z[k] = static_cast<coord>(k);
+	}
+	timer.start();
+	for (size_t t = 0; t < times; t++) {
+		for (size_t i = 0; i < CURRENT_TEST_MAX; i++) {
+			std::fill(x.begin(), x.end(), static_cast<coord>(i));
+			for (size_t j = 0; j < CURRENT_TEST_MAX; j++) {
+				std::fill(y.begin(), y.end(), static_cast<coord>(j));
+				function(x.data(), y.data(), z.data(), result.data(), CURRENT_TEST_MAX);
+				for (size_t k = 0; k < CURRENT_TEST_MAX; k++) {
+					runningsum += result[k];
+				}
+			}
+		}
+	}
+	timer.stop();
+	running_sums.push_back(runningsum);
+	return timer.elapsed_time_milliseconds / (float)times;
+}
+
+// Test performance of batch encoding a pool of random coordinates
+template <typename morton, typename coord>
+static double testEncode_3D_Batch_Random_Perf(void(*function)(const coord*, const coord*, const coord*, morton*, size_t), size_t times) {
+	Timer timer = Timer();
+	morton runningsum = 0;
+	std::vector<coord> x(RAND_POOL_SIZE), y(RAND_POOL_SIZE), z(RAND_POOL_SIZE);
+	std::vector<morton> result(RAND_POOL_SIZE);
+	for (size_t i = 0; i < RAND_POOL_SIZE; i++) {
+		x[i] = static_cast<coord>(rand());
+		y[i] = static_cast<coord>(rand());
+		z[i] = static_cast<coord>(rand());
+	}
+	timer.start();
+	for (size_t t = 0; t < times; t++) {
+		for (size_t i = 0; i < total; i += RAND_POOL_SIZE) {
+			size_t n = std::min(RAND_POOL_SIZE, total - i);
+			function(x.data(), y.data(), z.data(), result.data(), n);
+			for (size_t k = 0; k < n; k++) {
+				runningsum += result[k];
+			}
+		}
+	}
+	timer.stop();
+	running_sums.push_back(runningsum);
+	return timer.elapsed_time_milliseconds / (float)times;
+}
+
+// CONTROL: a separate quantization pass that writes the cells to coordinate arrays, followed by the batch encoder
+// This is what morton3D_64_encode_floats does in one pass, without the intermediate arrays.
+static void control3D_64_encode_floats_twopass(const float* xyz, uint64_t* out, size_t n, const libmorton::morton_aabb& box, unsigned int level) {
+	static std::vector<uint32_t> x, y, z;
+	x.resize(n);
+	y.resize(n);
+	z.resize(n);
+	const float top = static_cast<float>((1u << level) - 1);
+	float scale[3];
+	for (unsigned int axis = 0; axis < 3; axis++) {
+		scale[axis] = libmorton::mortonQuantizeScale(box, axis, level);
+	}
+	for (size_t i = 0; i < n; i++) {
+		x[i] = libmorton::mortonQuantize<uint32_t>(xyz[3 * i], box.min[0], scale[0], top);
+		y[i] = libmorton::mortonQuantize<uint32_t>(xyz[3 * i + 1], box.min[1], scale[1], top);
+		z[i] = libmorton::mortonQuantize<uint32_t>(xyz[3 * i + 2], box.min[2], scale[2], top);
+	}
+	libmorton::morton3D_64_encode_batch(x.data(), y.data(), z.data(), out, n);
+}
+
+// Test performance of encoding the float centres of the cells of the grid, one row of z at a time
+template <typename morton>
+static double testEncode_3D_Floats_Linear_Perf(void(*function)(const float*, morton*, size_t, const libmorton::morton_aabb&, unsigned int), size_t times) {
+	Timer timer = Timer();
+	morton runningsum = 0;
+	const float extent = static_cast<float>(CURRENT_TEST_MAX);
+	const libmorton::morton_aabb box = { { 0, 0, 0 }, { extent, extent, extent } };
+	std::vector<float> xyz(3 * CURRENT_TEST_MAX);
+	std::vector<morton> result(CURRENT_TEST_MAX);
+	timer.start();
+	for (size_t t = 0; t < times; t++) {
+		for (size_t i = 0; i < CURRENT_TEST_MAX; i++) {
+			for (size_t j = 0; j < CURRENT_TEST_MAX; j++) {
+				for (size_t k = 0; k < CURRENT_TEST_MAX; k++) {
+					xyz[3 * k] = i + 0.5f;
+					xyz[3 * k + 1] = j + 0.5f;
+					xyz[3 * k + 2] = k + 0.5f;
+				}
+				function(xyz.data(), result.data(), CURRENT_TEST_MAX, box, 21);
+				for (size_t k = 0; k < CURRENT_TEST_MAX; k++) {
+					runningsum += result[k];
+				}
+			}
+		}
+	}
+	timer.stop();
+	running_sums.push_back(runningsum);
+	return timer.elapsed_time_milliseconds / (float)times;
+}
+
+// Test performance of encoding a pool of random float positions
+template <typename morton>
+static double testEncode_3D_Floats_Random_Perf(void(*function)(const float*, morton*, size_t, const libmorton::morton_aabb&, unsigned int), size_t times) {
+	Timer timer = Timer();
+	morton runningsum = 0;
+	const libmorton::morton_aabb box = { { -1, -1, -1 }, { 1, 1, 1 } };
+	std::vector<float> xyz(3 * RAND_POOL_SIZE);
+	std::vector<morton> result(RAND_POOL_SIZE);
+	for (size_t i = 0; i < xyz.size(); i++) {
+		xyz[i] = static_cast<float>(rand()) / RAND_MAX * 2 - 1;
+	}
+	timer.start();
+	for (size_t t = 0; t < times; t++) {
+		for (size_t i = 0; i < total; i += RAND_POOL_SIZE) {
+			size_t n = std::min(RAND_POOL_SIZE, total - i);
+			function(xyz.data(), result.data(), n, box, 21);
+			for (size_t k = 0; k < n; k++) {
+				runningsum += result[k];
+			}
+		}
+	}
+	timer.stop();
+	running_sums.push_back(runningsum);
+	return timer.elapsed_time_milliseconds / (float)times;
+}
+
+// Test performance of batch decoding a linearly increasing set of morton codes
+template <typename morton, typename coord>
+static double testDecode_3D_Batch_Linear_Perf(void(*function)(const morton*, coord*, coord*, coord*, size_t), size_t times) {
+	size_t max_morton = CURRENT_TEST_MAX * CURRENT_TEST_MAX * CURRENT_TEST_MAX;
+	Timer timer = Timer();
+	coord runningsum = 0;
+	std::vector<morton> m(RAND_POOL_SIZE);
+	std::vector<coord> x(RAND_POOL_SIZE), y(RAND_POOL_SIZE), z(RAND_POOL_SIZE);
+	timer.start();
+	for (size_t t = 0; t < times; t++) {
+		for (size_t i = 0; i < max_morton; i += RAND_POOL_SIZE) {
+			size_t n = std::min(RAND_POOL_SIZE, max_morton - i);
+			for (size_t k = 0; k < n; k++) {
+				m[k] = static_cast<morton>(i + k);
+			}
+			function(m.data(), x.data(), y.data(), z.data(), n);
+			for (size_t k = 0; k < n; k++) {
+				runningsum += x[k] + y[k] + z[k];
+			}
+		}
+	}
+	timer.stop();
+	running_sums.push_back(runningsum);
+	return timer.elapsed_time_milliseconds / (float)times;
+}
+
+// Test performance of batch decoding a pool of random morton codes
+template <typename morton, typename coord>
+static double testDecode_3D_Batch_Random_Perf(void(*function)(const morton*, coord*, coord*, coord*, size_t), size_t times) {
+	Timer timer = Timer();
+	morton maximum = ~0; // maximum for the random morton codes
+	coord runningsum = 0;
+	std::vector<morton> m(RAND_POOL_SIZE);
+	std::vector<coord> x(RAND_POOL_SIZE), y(RAND_POOL_SIZE), z(RAND_POOL_SIZE);
+	for (size_t i = 0; i < RAND_POOL_SIZE; i++) {
+		m[i] = (morton(rand()) + morton(rand())) % maximum;
+	}
+	timer.start();
+	for (size_t t = 0; t < times; t++) {
+		for (size_t i = 0; i < total; i += RAND_POOL_SIZE) {
+			size_t n = std::min(RAND_POOL_SIZE, total - i);
+			function(m.data(), x.data(), y.data(), z.data(), n);
+			for (size_t k = 0; k < n; k++) {
+				runningsum += x[k] + y[k] + z[k];
+			}
+		}
+	}
+	timer.stop();
+	running_sums.push_back(runningsum);
+	return timer.elapsed_time_milliseconds / (float)times;
+}
+
 static void test_3D_performance(vector<encode_3D_64_wrapper>* funcs64_encode, vector<encode_3D_32_wrapper>* funcs32_encode,
 	vector<decode_3D_64_wrapper>* funcs64_decode, vector<decode_3D_32_wrapper>* funcs32_decode) {
 	stringstream os;
@@ -151,6 +384,30 @@ static void test_3D_performance(vector<encode_3D_64_wrapper>* funcs64_encode, ve
 		os << testEncode_3D_Random_Perf((*it).encode, times) << " ms\t";
 		cout << os.str() << "64-bit " << (*it).description << endl;
 	}
+	os.str("");
+	os << testEncode_3D_Batch_Linear_Perf(&libmorton::morton3D_64_encode_batch, times) << " ms\t";
+	os << testEncode_3D_Batch_Random_Perf(&libmorton::morton3D_64_encode_batch, times) << " ms\t";
+	cout << os.str() << "64-bit Batch (morton.h)" << endl;
+	os.str("");
+	os << testEncode_3D_Floats_Linear_Perf<uint64_t>(&libmorton::morton3D_64_encode_floats, times) << " ms\t";
+	os << testEncode_3D_Floats_Random_Perf<uint64_t>(&libmorton::morton3D_64_encode_floats, times) << " ms\t";
+	cout << os.str() << "64-bit Float positions (morton.h)" << endl;
+	os.str("");
+	os << testEncode_3D_Floats_Linear_Perf<uint64_t>(&control3D_64_encode_floats_twopass, times) << " ms\t";
+	os << testEncode_3D_Floats_Random_Perf<uint64_t>(&control3D_64_encode_floats_twopass, times) << " ms\t";
+	cout << os.str() << "64-bit Float positions (control: quantize pass + batch)" << endl;
+	os.str("");
+	os << testEncode_3D_Linear_Perf(&libmorton::hilbert3D_64_encode, times) << " ms\t";
+	os << testEncode_3D_Random_Perf(&libmorton::hilbert3D_64_encode, times) << " ms\t";
+	cout << os.str() << "64-bit Hilbert (hilbert.h)" << endl;
+	os.str("");
+	os << testEncode_3D_Batch_Linear_Perf(&libmorton::hilbert3D_64_encode_batch, times) << " ms\t";
+	os << testEncode_3D_Batch_Random_Perf(&libmorton::hilbert3D_64_encode_batch, times) << " ms\t";
+	cout << os.str() << "64-bit Hilbert Batch (hilbert.h)" << endl;
+	os.str("");
+	os << testEncode_3D_Linear_Perf(&libmorton::morton3D_128_encode, times) << " ms\t";
+	os << testEncode_3D_Random_Perf(&libmorton::morton3D_128_encode, times) << " ms\t";
+	cout << os.str() << "128-bit (morton.h)" << endl;
 	cout << "+++ (3D) Encoding 32-bit sized morton codes" << endl;
 	for (auto it = (*funcs32_encode).begin(); it != (*funcs32_encode).end(); it++) {
 		os.str("");
@@ -158,6 +415,18 @@ static void test_3D_performance(vector<encode_3D_64_wrapper>* funcs64_encode, ve
 		os << testEncode_3D_Random_Perf((*it).encode, times) << " ms\t";
 		cout << os.str() << "32-bit " << (*it).description << endl;
 	}
+	os.str("");
+	os << testEncode_3D_Batch_Linear_Perf(&libmorton::morton3D_32_encode_batch, times) << " ms\t";
+	os << testEncode_3D_Batch_Random_Perf(&libmorton::morton3D_32_encode_batch, times) << " ms\t";
+	cout << os.str() << "32-bit Batch (morton.h)" << endl;
+	os.str("");
+	os << testEncode_3D_Linear_Perf(&libmorton::hilbert3D_32_encode, times) << " ms\t";
+	os << testEncode_3D_Random_Perf(&libmorton::hilbert3D_32_encode, times) << " ms\t";
+	cout << os.str() << "32-bit Hilbert (hilbert.h)" << endl;
+	os.str("");
+	os << testEncode_3D_Batch_Linear_Perf(&libmorton::hilbert3D_32_encode_batch, times) << " ms\t";
+	os << testEncode_3D_Batch_Random_Perf(&libmorton::hilbert3D_32_encode_batch, times) << " ms\t";
+	cout << os.str() << "32-bit Hilbert Batch (hilbert.h)" << endl;
 	cout << "++ (3D) Decoding " << CURRENT_TEST_MAX << "^3 morton codes (" << total << " in total)" << endl;
 	cout << "+++ (3D) Decoding 64-bit sized morton codes" << endl;
 	for (auto it = (*funcs64_decode).begin(); it != (*funcs64_decode).end(); it++) {
@@ -166,6 +435,18 @@ static void test_3D_performance(vector<encode_3D_64_wrapper>* funcs64_encode, ve
 		os << testDecode_3D_Random_Perf((*it).decode, times) << " ms\t";
 		cout << os.str() << "64-bit " << (*it).description << endl;
 	}
+	os.str("");
+	os << testDecode_3D_Batch_Linear_Perf(&libmorton::morton3D_64_decode_batch, times) << " ms\t";
+	os << testDecode_3D_Batch_Random_Perf(&libmorton::morton3D_64_decode_batch, times) << " ms\t";
+	cout << os.str() << "64-bit Batch (morton.h)" << endl;
+	os.str("");
+	os << testDecode_3D_Linear_Perf(&libmorton::hilbert3D_64_decode, times) << " ms\t";
+	os << testDecode_3D_Random_Perf(&libmorton::hilbert3D_64_decode, times) << " ms\t";
+	cout << os.str() << "64-bit Hilbert (hilbert.h)" << endl;
+	os.str("");
+	os << testDecode_3D_Batch_Linear_Perf(&libmorton::hilbert3D_64_decode_batch, times) << " ms\t";
+	os << testDecode_3D_Batch_Random_Perf(&libmorton::hilbert3D_64_decode_batch, times) << " ms\t";
+	cout << os.str() << "64-bit Hilbert Batch (hilbert.h)" << endl;
 	cout << "+++ (3D) Decoding 32-bit sized morton codes" << endl;
 	for (auto it = (*funcs32_decode).begin(); it != (*funcs32_decode).end(); it++) {
 		os.str("");
@@ -173,4 +454,16 @@ static void test_3D_performance(vector<encode_3D_64_wrapper>* funcs64_encode, ve
 		os << testDecode_3D_Random_Perf((*it).decode, times) << " ms\t";
 		cout << os.str() << "32-bit " << (*it).description << endl;
 	}
+	os.str("");
+	os << testDecode_3D_Batch_Linear_Perf(&libmorton::morton3D_32_decode_batch, times) << " ms\t";
+	os << testDecode_3D_Batch_Random_Perf(&libmorton::morton3D_32_decode_batch, times) << " ms\t";
+	cout << os.str() << "32-bit Batch (morton.h)" << endl;
+	os.str("");
+	os << testDecode_3D_Linear_Perf(&libmorton::hilbert3D_32_decode, times) << " ms\t";
+	os << testDecode_3D_Random_Perf(&libmorton::hilbert3D_32_decode, times) << " ms\t";
+	cout << os.str() << "32-bit Hilbert (hilbert.h)" << endl;
+	os.str("");
+	os << testDecode_3D_Batch_Linear_Perf(&libmorton::hilbert3D_32_decode_batch, times) << " ms\t";
+	os << testDecode_3D_Batch_Random_Perf(&libmorton::hilbert3D_32_decode_batch, times) << " ms\t";
+	cout << os.str() << "32-bit Hilbert Batch (hilbert.h)" << endl;
 }
\ No newline at end of file
@@ -0,0 +1,205 @@
+#pragma once
+#include "libmorton_test.h"
+
+using namespace std;
+
+// CORRECTNESS CHECKS
+
+// Index lists, to pass an array of coordinates to the variadic N-dimensional methods
+template <size_t... i> struct nd_indices {};
+template <size_t n, size_t... i> struct nd_make_indices : nd_make_indices<n - 1, n - 1, i...> {};
+template <size_t... i> struct nd_make_indices<0, i...> { typedef nd_indices<i...> type; };
+
+// Encode an N-dimensional Morton code bit by bit: bit b of axis a goes to bit b * dims + a
+template <typename morton, typename coord, unsigned int dims>
+inline morton controlND_encode(const coord* c) {
+	const unsigned int fieldbits = static_cast<unsigned int>(sizeof(morton) * 8) / dims;
+	morton m = 0;
+	for (unsigned int bit = 0; bit < fieldbits; bit++) {
+		for (unsigned int axis = 0; axis < dims; axis++) {
+			m |= static_cast<morton>((static_cast<morton>(c[axis]) >> bit) & 1) << (bit * dims + axis);
+		}
+	}
+	return m;
+}
+
+template <typename morton, typename coord, unsigned int dims, size_t... i>
+inline morton checkND_encode(const unsigned int method, const coord* c, nd_indices<i...>) {
+#if defined(__BMI2__) || defined(__AVX2__)
+	if (method == 2) { return libmorton::mND_e_BMI<dims, morton, coord>(c[i]...); }
+#endif
+	return (method == 1) ? libmorton::mND_e_magicbits<dims, morton, coord>(c[i]...) : libmorton::encode<dims, morton, coord>(c[i]...);
+}
+
+template <typename morton, typename coord, unsigned int dims, size_t... i>
+inline void checkND_decode(const unsigned int method, const morton m, coord* c, nd_indices<i...>) {
+#if defined(__BMI2__) || defined(__AVX2__)
+	if (method == 2) { libmorton::mND_d_BMI<dims, morton, coord>(m, c[i]...); return; }
+#endif
+	(method == 1) ? libmorton::mND_d_magicbits<dims, morton, coord>(m, c[i]...) : libmorton::decode<dims, morton, coord>(m, c[i]...);
+}
+
+// Check the N-dimensional methods (morton.h, magic bits and BMI2) against the control encoder, and decode what they encode
+template <typename morton, typename coord, unsigned int dims>
+inline bool checkND_Correctness() {
+	printf("++ Checking correctness of %uD encode/decode (%zd bit) ... ", dims, sizeof(morton) * 8);
+	const unsigned int fieldbits = static_cast<unsigned int>(sizeof(morton) * 8) / dims;
+	const uint64_t fieldmask = (fieldbits >= 64) ? ~0ULL : (1ULL << fieldbits) - 1;
+	const typename nd_make_indices<dims>::type indices;
+	bool ok = true;
+	for (unsigned int i = 0; i < 10000; i++) {
+		coord c[dims], d[dims];
+		for (unsigned int axis = 0; axis < dims; axis++) {
+			// mix in the edges of the range
+			c[axis] = static_cast<coord>((i % 7 == 0) ? fieldmask : (static_cast<uint64_t>(rand()) << 32 ^ static_cast<uint64_t>(rand()) << 16 ^ rand()) & fieldmask);
+		}
+		const morton correct = controlND_encode<morton, coord, dims>(c);
+		for (unsigned int method = 0; method < 3; method++) {
+			const morton m = checkND_encode<morton, coord, dims>(method, c, indices);
+			checkND_decode<morton, coord, dims>(method, correct, d, indices);
+			bool same = (m == correct);
+			for (unsigned int axis = 0; axis < dims; axis++) { same = same && (d[axis] == c[axis]); }
+			if (!same) {
+				std::cout << "\n    Incorrect " << (method == 0 ? "morton.h" : method == 1 ? "magic bits" : "BMI2") << " encode/decode of code " << correct << ": " << m << "\n";
+				ok = false;
+			}
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Encode an anisotropic Morton code bit by bit: bit b of every axis that has more than b bits, in axis order, then bit b + 1
+template <typename morton, typename coord, unsigned int dims>
+inline morton controlAniso_encode(const coord* c, const unsigned int* bits) {
+	morton m = 0;
+	unsigned int out = 0;
+	for (unsigned int bit = 0; out < sizeof(morton) * 8; bit++) {
+		bool any = false;
+		for (unsigned int axis = 0; axis < dims; axis++) {
+			if (bit < bits[axis]) {
+				m |= static_cast<morton>(static_cast<morton>((static_cast<uint64_t>(c[axis]) >> bit) & 1) << out++);
+				any = true;
+			}
+		}
+		if (!any) { break; }
+	}
+	return m;
+}
+
+template <typename morton, typename coord, unsigned int... bits, size_t... i>
+inline morton checkAniso_encode(const unsigned int method, const coord* c, nd_indices<i...>) {
+#if defined(__BMI2__) || defined(__AVX2__)
+	if (method == 2) { return libmorton::mAniso_e_BMI<morton, coord, bits...>(c[i]...); }
+#endif
+	return (method == 1) ? libmorton::mAniso_e_magicbits<morton, coord, bits...>(c[i]...) : libmorton::encode_aniso<morton, coord, bits...>(c[i]...);
+}
+
+template <typename morton, typename coord, unsigned int... bits, size_t... i>
+inline void checkAniso_decode(const unsigned int method, const morton m, coord* c, nd_indices<i...>) {
+#if defined(__BMI2__) || defined(__AVX2__)
+	if (method == 2) { libmorton::mAniso_d_BMI<morton, coord, bits...>(m, c[i]...); return; }
+#endif
+	(method == 1) ? libmorton::mAniso_d_magicbits<morton, coord, bits...>(m, c[i]...) : libmorton::decode_aniso<morton, coord, bits...>(m, c[i]...);
+}
+
+// Check the anisotropic methods (morton.h, magic bits and BMI2) against the control encoder, and decode what they encode
+template <typename morton, typename coord, unsigned int... bits>
+inline bool checkAniso_Correctness() {
+	const unsigned int dims = sizeof...(bits);
+	const unsigned int fieldbits[dims] = { bits... };
+	std::string layout;
+	for (unsigned int axis = 0; axis < dims; axis++) { layout += (axis ? "/" : "") + std::to_string(fieldbits[axis]); }
+	printf("++ Checking correctness of anisotropic encode/decode (%s bits, %zd bit) ... ", layout.c_str(), sizeof(morton) * 8);
+	// the masks are compile time constants: 24/24/16 bits puts z on every third bit up to bit 47
+	static_assert(libmorton::mortonAniso_AxisMask<uint64_t, 24, 24, 16>(2) == 0x924924924924, "z mask of a 24/24/16 layout");
+	const typename nd_make_indices<dims>::type indices;
+	bool ok = true;
+	for (unsigned int i = 0; i < 10000; i++) {
+		coord c[dims], d[dims];
+		for (unsigned int axis = 0; axis < dims; axis++) {
+			const uint64_t fieldmask = (1ULL << fieldbits[axis]) - 1;
+			// mix in the edges of the range
+			c[axis] = static_cast<coord>((i % 7 == 0) ? fieldmask : (static_cast<uint64_t>(rand()) << 32 ^ static_cast<uint64_t>(rand()) << 16 ^ rand()) & fieldmask);
+		}
+		const morton correct = controlAniso_encode<morton, coord, dims>(c, fieldbits);
+		for (unsigned int method = 0; method < 3; method++) {
+			const morton m = checkAniso_encode<morton, coord, bits...>(method, c, indices);
+			checkAniso_decode<morton, coord, bits...>(method, correct, d, indices);
+			bool same = (m == correct);
+			for (unsigned int axis = 0; axis < dims; axis++) { same = same && (d[axis] == c[axis]); }
+			if (!same) {
+				std::cout << "\n    Incorrect " << (method == 0 ? "morton.h" : method == 1 ? "magic bits" : "BMI2") << " encode/decode of code " << correct << ": " << m << "\n";
+				ok = false;
+			}
+		}
+	}
+	ok ? printPassed() : printFailed();
+	return ok;
+}
+
+// Compare two points by the Morton codes of their full coordinates bit by bit, from the top bit of the highest axis
+// Signed coordinates are biased (top bit flipped), like the codes of the signed encoders.
+template <typename coord, unsigned int dims>
+inline bool controlMorton_less(const coord* a, const coord* b) {
+	typedef typename std::make_unsigned<coord>::type ucoord;
+	const unsigned int fieldbits = sizeof(coord) * 8;
+	const ucoord bias = std::is_signed<coord>::value ? static_cast<ucoord>(static_cast<ucoord>(1) << (fieldbits - 1)) : 0;
+	for (unsigned int bit = fieldbits; bit-- > 0;) {
+		for (unsigned int axis = dims; axis-- > 0;) {
+			const unsigned int abit = ((static_cast<ucoord>(a[axis]) ^ bias) >> bit) & 1;
+			const unsigned int bbit = ((static_cast<ucoord>(b[axis]) ^ bias) >> bit) & 1;
+			if (abit != bbit) { return abit < bbit; }
+		}
+	}
+	return false;
+}
+
+// Check the Morton order comparator against the bit by bit comparison (and against the control encoder where the codes
+// fit in 64 bits), on points sharing a random number of top bits, and sort points in Morton order with it
+template <typename coord, unsigned int dims>
+inline bool checkND_MortonLessCorrectness() {
+	printf("++ Checking correctness of %uD Morton order comparator (%zd bit coordinates%s) ... ", dims, sizeof(coord) * 8, std::is_signed<coord>::value ? ", signed" : "");
+	const unsigned int fieldbits = sizeof(coord) * 8;
+	const unsigned int codebits = 64 / dims;
+	bool ok = true;
+	for (unsigned int i = 0; i < 10000 && ok; i++) {
+		const unsigned int split = i % (fieldbits + 1);
+		const uint64_t low = (split == 64) ? ~0ULL : (1ULL << split) - 1;
+		coord a[dims], b[dims], ca[dims], cb[dims];
+		for (unsigned int axis = 0; axis < dims; axis++) {
+			const uint64_t r = static_cast<uint64_t>(rand()) << 48 ^ static_cast<uint64_t>(rand()) << 32 ^ static_cast<uint64_t>(rand()) << 16 ^ rand();
+			a[axis] = static_cast<coord>(r);
+			b[axis] = static_cast<coord>(static_cast<uint64_t>(a[axis]) ^ ((static_cast<uint64_t>(rand()) << 32 ^ static_cast<uint64_t>(rand()) << 16 ^ rand()) & low));
+			ca[axis] = static_cast<coord>(static_cast<uint64_t>(a[axis]) & ((1ULL << codebits) - 1));
+			cb[axis] = static_cast<coord>(static_cast<uint64_t>(b[axis]) & ((1ULL << codebits) - 1));
+		}
+		ok &= libmorton::morton_less<dims, coord>(a, b) == controlMorton_less<coord, dims>(a, b);
+		ok &= libmorton::morton_less<dims, coord>(b, a) == controlMorton_less<coord, dims>(b, a);
+		ok &= !libmorton::morton_less<dims, coord>(a, a);
+		if (!std::is_signed<coord>::value) {
+			ok &= libmorton::morton_less<dims, coord>(ca, cb) == (controlND_encode<uint64_t, coord, dims>(ca) < controlND_encode<uint64_t, coord, dims>(cb));
+		}
+		if (!ok) { std::cout << "\n    Incorrect comparison of points " << i << "\n"; }
+	}
+	// sorted points are in Morton order, and still the same points
+	std::vector<std::array<coord, dims> > points(10000);
+	for (size_t i = 0; i < points.size(); i++) {
+		for (unsigned int axis = 0; axis < dims; axis++) {
+			points[i][axis] = static_cast<coord>(static_cast<uint64_t>(rand()) << 32 ^ static_cast<uint64_t>(rand()) << 16 ^ rand());
+		}
+	}
+	// duplicates
+	for (size_t i = 0; i < 100; i++) { points[rand() % points.size()] = points[i]; }
+	std::vector<std::array<coord, dims> > sorted(points);
+	libmorton::morton_sort_points<coord, dims>(sorted.data(), sorted.size());
+	for (size_t i = 1; i < sorted.size() && ok; i++) {
+		ok &= !controlMorton_less<coord, dims>(sorted[i].data(), sorted[i - 1].data());
+		if (!ok) { std::cout << "\n    Sorted points out of Morton order at position " << i << "\n"; }
+	}
+	std::sort(points.begin(), points.end());
+	std::sort(sorted.begin(), sorted.end());
+	ok &= (points == sorted);
+	ok ? printPassed() : printFailed();
+	return ok;
+}